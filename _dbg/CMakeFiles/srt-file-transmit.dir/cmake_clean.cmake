@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/srt-file-transmit.dir/apps/srt-file-transmit.cpp.o"
+  "CMakeFiles/srt-file-transmit.dir/apps/srt-file-transmit.cpp.o.d"
+  "srt-file-transmit"
+  "srt-file-transmit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/srt-file-transmit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/srt-live-transmit.dir/apps/srt-live-transmit.cpp.o"
+  "CMakeFiles/srt-live-transmit.dir/apps/srt-live-transmit.cpp.o.d"
+  "srt-live-transmit"
+  "srt-live-transmit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/srt-live-transmit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
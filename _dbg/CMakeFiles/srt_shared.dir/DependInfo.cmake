@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/cmake_object_lib_support.c" "CMakeFiles/srt_shared.dir/cmake_object_lib_support.c.o" "gcc" "CMakeFiles/srt_shared.dir/cmake_object_lib_support.c.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_dbg/libsrt.so" "/root/repo/_dbg/libsrt.so.1.5.5"
+  "/root/repo/_dbg/libsrt.so.1.5" "/root/repo/_dbg/libsrt.so.1.5.5"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
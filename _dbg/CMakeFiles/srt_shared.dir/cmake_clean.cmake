@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/srt_shared.dir/cmake_object_lib_support.c.o"
+  "CMakeFiles/srt_shared.dir/cmake_object_lib_support.c.o.d"
+  "libsrt.pdb"
+  "libsrt.so"
+  "libsrt.so.1.5"
+  "libsrt.so.1.5.5"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/srt_shared.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/srt_static.dir/cmake_object_lib_support.c.o"
+  "CMakeFiles/srt_static.dir/cmake_object_lib_support.c.o.d"
+  "libsrt.a"
+  "libsrt.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/srt_static.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,57 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/haicrypt/cryspr-openssl-evp.c" "CMakeFiles/srt_virtual.dir/haicrypt/cryspr-openssl-evp.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/cryspr-openssl-evp.c.o.d"
+  "/root/repo/haicrypt/cryspr.c" "CMakeFiles/srt_virtual.dir/haicrypt/cryspr.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/cryspr.c.o.d"
+  "/root/repo/haicrypt/hcrypt.c" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt.c.o.d"
+  "/root/repo/haicrypt/hcrypt_ctx_rx.c" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_ctx_rx.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_ctx_rx.c.o.d"
+  "/root/repo/haicrypt/hcrypt_ctx_tx.c" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_ctx_tx.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_ctx_tx.c.o.d"
+  "/root/repo/haicrypt/hcrypt_rx.c" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_rx.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_rx.c.o.d"
+  "/root/repo/haicrypt/hcrypt_sa.c" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_sa.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_sa.c.o.d"
+  "/root/repo/haicrypt/hcrypt_tx.c" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_tx.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_tx.c.o.d"
+  "/root/repo/haicrypt/hcrypt_xpt_srt.c" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_xpt_srt.c.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_xpt_srt.c.o.d"
+  "/root/repo/srtcore/srt_compat.c" "CMakeFiles/srt_virtual.dir/srtcore/srt_compat.c.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/srt_compat.c.o.d"
+  "/root/repo/haicrypt/haicrypt_log.cpp" "CMakeFiles/srt_virtual.dir/haicrypt/haicrypt_log.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/haicrypt/haicrypt_log.cpp.o.d"
+  "/root/repo/srtcore/api.cpp" "CMakeFiles/srt_virtual.dir/srtcore/api.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/api.cpp.o.d"
+  "/root/repo/srtcore/buffer_rcv.cpp" "CMakeFiles/srt_virtual.dir/srtcore/buffer_rcv.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/buffer_rcv.cpp.o.d"
+  "/root/repo/srtcore/buffer_snd.cpp" "CMakeFiles/srt_virtual.dir/srtcore/buffer_snd.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/buffer_snd.cpp.o.d"
+  "/root/repo/srtcore/buffer_tools.cpp" "CMakeFiles/srt_virtual.dir/srtcore/buffer_tools.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/buffer_tools.cpp.o.d"
+  "/root/repo/srtcore/cache.cpp" "CMakeFiles/srt_virtual.dir/srtcore/cache.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/cache.cpp.o.d"
+  "/root/repo/srtcore/channel.cpp" "CMakeFiles/srt_virtual.dir/srtcore/channel.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/channel.cpp.o.d"
+  "/root/repo/srtcore/common.cpp" "CMakeFiles/srt_virtual.dir/srtcore/common.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/common.cpp.o.d"
+  "/root/repo/srtcore/congctl.cpp" "CMakeFiles/srt_virtual.dir/srtcore/congctl.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/congctl.cpp.o.d"
+  "/root/repo/srtcore/core.cpp" "CMakeFiles/srt_virtual.dir/srtcore/core.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/core.cpp.o.d"
+  "/root/repo/srtcore/crypto.cpp" "CMakeFiles/srt_virtual.dir/srtcore/crypto.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/crypto.cpp.o.d"
+  "/root/repo/srtcore/epoll.cpp" "CMakeFiles/srt_virtual.dir/srtcore/epoll.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/epoll.cpp.o.d"
+  "/root/repo/srtcore/fec.cpp" "CMakeFiles/srt_virtual.dir/srtcore/fec.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/fec.cpp.o.d"
+  "/root/repo/srtcore/handshake.cpp" "CMakeFiles/srt_virtual.dir/srtcore/handshake.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/handshake.cpp.o.d"
+  "/root/repo/srtcore/list.cpp" "CMakeFiles/srt_virtual.dir/srtcore/list.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/list.cpp.o.d"
+  "/root/repo/srtcore/logger_default.cpp" "CMakeFiles/srt_virtual.dir/srtcore/logger_default.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/logger_default.cpp.o.d"
+  "/root/repo/srtcore/logger_defs.cpp" "CMakeFiles/srt_virtual.dir/srtcore/logger_defs.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/logger_defs.cpp.o.d"
+  "/root/repo/srtcore/logging.cpp" "CMakeFiles/srt_virtual.dir/srtcore/logging.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/logging.cpp.o.d"
+  "/root/repo/srtcore/md5.cpp" "CMakeFiles/srt_virtual.dir/srtcore/md5.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/md5.cpp.o.d"
+  "/root/repo/srtcore/packet.cpp" "CMakeFiles/srt_virtual.dir/srtcore/packet.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/packet.cpp.o.d"
+  "/root/repo/srtcore/packetfilter.cpp" "CMakeFiles/srt_virtual.dir/srtcore/packetfilter.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/packetfilter.cpp.o.d"
+  "/root/repo/srtcore/queue.cpp" "CMakeFiles/srt_virtual.dir/srtcore/queue.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/queue.cpp.o.d"
+  "/root/repo/srtcore/socketconfig.cpp" "CMakeFiles/srt_virtual.dir/srtcore/socketconfig.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/socketconfig.cpp.o.d"
+  "/root/repo/srtcore/srt_c_api.cpp" "CMakeFiles/srt_virtual.dir/srtcore/srt_c_api.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/srt_c_api.cpp.o.d"
+  "/root/repo/srtcore/strerror_defs.cpp" "CMakeFiles/srt_virtual.dir/srtcore/strerror_defs.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/strerror_defs.cpp.o.d"
+  "/root/repo/srtcore/sync.cpp" "CMakeFiles/srt_virtual.dir/srtcore/sync.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/sync.cpp.o.d"
+  "/root/repo/srtcore/sync_posix.cpp" "CMakeFiles/srt_virtual.dir/srtcore/sync_posix.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/sync_posix.cpp.o.d"
+  "/root/repo/srtcore/tsbpd_time.cpp" "CMakeFiles/srt_virtual.dir/srtcore/tsbpd_time.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/tsbpd_time.cpp.o.d"
+  "/root/repo/srtcore/window.cpp" "CMakeFiles/srt_virtual.dir/srtcore/window.cpp.o" "gcc" "CMakeFiles/srt_virtual.dir/srtcore/window.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,85 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/srt_virtual.dir/haicrypt/cryspr-openssl-evp.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/cryspr-openssl-evp.c.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/cryspr.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/cryspr.c.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/haicrypt_log.cpp.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/haicrypt_log.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt.c.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_ctx_rx.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_ctx_rx.c.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_ctx_tx.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_ctx_tx.c.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_rx.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_rx.c.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_sa.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_sa.c.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_tx.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_tx.c.o.d"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_xpt_srt.c.o"
+  "CMakeFiles/srt_virtual.dir/haicrypt/hcrypt_xpt_srt.c.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/api.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/api.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/buffer_rcv.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/buffer_rcv.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/buffer_snd.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/buffer_snd.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/buffer_tools.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/buffer_tools.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/cache.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/cache.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/channel.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/channel.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/common.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/common.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/congctl.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/congctl.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/core.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/core.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/crypto.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/crypto.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/epoll.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/epoll.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/fec.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/fec.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/handshake.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/handshake.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/list.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/list.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/logger_default.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/logger_default.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/logger_defs.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/logger_defs.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/logging.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/logging.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/md5.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/md5.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/packet.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/packet.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/packetfilter.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/packetfilter.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/queue.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/queue.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/socketconfig.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/socketconfig.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/srt_c_api.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/srt_c_api.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/srt_compat.c.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/srt_compat.c.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/strerror_defs.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/strerror_defs.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/sync.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/sync.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/sync_posix.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/sync_posix.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/tsbpd_time.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/tsbpd_time.cpp.o.d"
+  "CMakeFiles/srt_virtual.dir/srtcore/window.cpp.o"
+  "CMakeFiles/srt_virtual.dir/srtcore/window.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C CXX)
+  include(CMakeFiles/srt_virtual.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,26 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/apps/apputil.cpp" "CMakeFiles/srtsupport_virtual.dir/apps/apputil.cpp.o" "gcc" "CMakeFiles/srtsupport_virtual.dir/apps/apputil.cpp.o.d"
+  "/root/repo/apps/logsupport.cpp" "CMakeFiles/srtsupport_virtual.dir/apps/logsupport.cpp.o" "gcc" "CMakeFiles/srtsupport_virtual.dir/apps/logsupport.cpp.o.d"
+  "/root/repo/apps/logsupport_appdefs.cpp" "CMakeFiles/srtsupport_virtual.dir/apps/logsupport_appdefs.cpp.o" "gcc" "CMakeFiles/srtsupport_virtual.dir/apps/logsupport_appdefs.cpp.o.d"
+  "/root/repo/apps/socketoptions.cpp" "CMakeFiles/srtsupport_virtual.dir/apps/socketoptions.cpp.o" "gcc" "CMakeFiles/srtsupport_virtual.dir/apps/socketoptions.cpp.o.d"
+  "/root/repo/apps/statswriter.cpp" "CMakeFiles/srtsupport_virtual.dir/apps/statswriter.cpp.o" "gcc" "CMakeFiles/srtsupport_virtual.dir/apps/statswriter.cpp.o.d"
+  "/root/repo/apps/transmitmedia.cpp" "CMakeFiles/srtsupport_virtual.dir/apps/transmitmedia.cpp.o" "gcc" "CMakeFiles/srtsupport_virtual.dir/apps/transmitmedia.cpp.o.d"
+  "/root/repo/apps/uriparser.cpp" "CMakeFiles/srtsupport_virtual.dir/apps/uriparser.cpp.o" "gcc" "CMakeFiles/srtsupport_virtual.dir/apps/uriparser.cpp.o.d"
+  "/root/repo/apps/verbose.cpp" "CMakeFiles/srtsupport_virtual.dir/apps/verbose.cpp.o" "gcc" "CMakeFiles/srtsupport_virtual.dir/apps/verbose.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
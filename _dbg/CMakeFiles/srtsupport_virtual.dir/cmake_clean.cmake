@@ -0,0 +1,23 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/srtsupport_virtual.dir/apps/apputil.cpp.o"
+  "CMakeFiles/srtsupport_virtual.dir/apps/apputil.cpp.o.d"
+  "CMakeFiles/srtsupport_virtual.dir/apps/logsupport.cpp.o"
+  "CMakeFiles/srtsupport_virtual.dir/apps/logsupport.cpp.o.d"
+  "CMakeFiles/srtsupport_virtual.dir/apps/logsupport_appdefs.cpp.o"
+  "CMakeFiles/srtsupport_virtual.dir/apps/logsupport_appdefs.cpp.o.d"
+  "CMakeFiles/srtsupport_virtual.dir/apps/socketoptions.cpp.o"
+  "CMakeFiles/srtsupport_virtual.dir/apps/socketoptions.cpp.o.d"
+  "CMakeFiles/srtsupport_virtual.dir/apps/statswriter.cpp.o"
+  "CMakeFiles/srtsupport_virtual.dir/apps/statswriter.cpp.o.d"
+  "CMakeFiles/srtsupport_virtual.dir/apps/transmitmedia.cpp.o"
+  "CMakeFiles/srtsupport_virtual.dir/apps/transmitmedia.cpp.o.d"
+  "CMakeFiles/srtsupport_virtual.dir/apps/uriparser.cpp.o"
+  "CMakeFiles/srtsupport_virtual.dir/apps/uriparser.cpp.o.d"
+  "CMakeFiles/srtsupport_virtual.dir/apps/verbose.cpp.o"
+  "CMakeFiles/srtsupport_virtual.dir/apps/verbose.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/srtsupport_virtual.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
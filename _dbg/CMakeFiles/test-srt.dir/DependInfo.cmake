@@ -0,0 +1,53 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/test/test_batch_transmission.cpp" "CMakeFiles/test-srt.dir/test/test_batch_transmission.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_batch_transmission.cpp.o.d"
+  "/root/repo/test/test_buffer_rcv.cpp" "CMakeFiles/test-srt.dir/test/test_buffer_rcv.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_buffer_rcv.cpp.o.d"
+  "/root/repo/test/test_buffer_snd.cpp" "CMakeFiles/test-srt.dir/test/test_buffer_snd.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_buffer_snd.cpp.o.d"
+  "/root/repo/test/test_common.cpp" "CMakeFiles/test-srt.dir/test/test_common.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_common.cpp.o.d"
+  "/root/repo/test/test_congctl.cpp" "CMakeFiles/test-srt.dir/test/test_congctl.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_congctl.cpp.o.d"
+  "/root/repo/test/test_connection_timeout.cpp" "CMakeFiles/test-srt.dir/test/test_connection_timeout.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_connection_timeout.cpp.o.d"
+  "/root/repo/test/test_control_packets.cpp" "CMakeFiles/test-srt.dir/test/test_control_packets.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_control_packets.cpp.o.d"
+  "/root/repo/test/test_crypto.cpp" "CMakeFiles/test-srt.dir/test/test_crypto.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_crypto.cpp.o.d"
+  "/root/repo/test/test_cryspr.cpp" "CMakeFiles/test-srt.dir/test/test_cryspr.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_cryspr.cpp.o.d"
+  "/root/repo/test/test_enforced_encryption.cpp" "CMakeFiles/test-srt.dir/test/test_enforced_encryption.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_enforced_encryption.cpp.o.d"
+  "/root/repo/test/test_epoll.cpp" "CMakeFiles/test-srt.dir/test/test_epoll.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_epoll.cpp.o.d"
+  "/root/repo/test/test_fec_rebuilding.cpp" "CMakeFiles/test-srt.dir/test/test_fec_rebuilding.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_fec_rebuilding.cpp.o.d"
+  "/root/repo/test/test_file_transmission.cpp" "CMakeFiles/test-srt.dir/test/test_file_transmission.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_file_transmission.cpp.o.d"
+  "/root/repo/test/test_idtable.cpp" "CMakeFiles/test-srt.dir/test/test_idtable.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_idtable.cpp.o.d"
+  "/root/repo/test/test_ipv6.cpp" "CMakeFiles/test-srt.dir/test/test_ipv6.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_ipv6.cpp.o.d"
+  "/root/repo/test/test_listen_callback.cpp" "CMakeFiles/test-srt.dir/test/test_listen_callback.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_listen_callback.cpp.o.d"
+  "/root/repo/test/test_losslist_rcv.cpp" "CMakeFiles/test-srt.dir/test/test_losslist_rcv.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_losslist_rcv.cpp.o.d"
+  "/root/repo/test/test_losslist_snd.cpp" "CMakeFiles/test-srt.dir/test/test_losslist_snd.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_losslist_snd.cpp.o.d"
+  "/root/repo/test/test_main.cpp" "CMakeFiles/test-srt.dir/test/test_main.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_main.cpp.o.d"
+  "/root/repo/test/test_many_connections.cpp" "CMakeFiles/test-srt.dir/test/test_many_connections.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_many_connections.cpp.o.d"
+  "/root/repo/test/test_muxer.cpp" "CMakeFiles/test-srt.dir/test/test_muxer.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_muxer.cpp.o.d"
+  "/root/repo/test/test_reuseaddr.cpp" "CMakeFiles/test-srt.dir/test/test_reuseaddr.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_reuseaddr.cpp.o.d"
+  "/root/repo/test/test_seqno.cpp" "CMakeFiles/test-srt.dir/test/test_seqno.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_seqno.cpp.o.d"
+  "/root/repo/test/test_snd_rate_estimator.cpp" "CMakeFiles/test-srt.dir/test/test_snd_rate_estimator.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_snd_rate_estimator.cpp.o.d"
+  "/root/repo/test/test_snd_scheduler.cpp" "CMakeFiles/test-srt.dir/test/test_snd_scheduler.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_snd_scheduler.cpp.o.d"
+  "/root/repo/test/test_snd_shaper.cpp" "CMakeFiles/test-srt.dir/test/test_snd_shaper.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_snd_shaper.cpp.o.d"
+  "/root/repo/test/test_socket_options.cpp" "CMakeFiles/test-srt.dir/test/test_socket_options.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_socket_options.cpp.o.d"
+  "/root/repo/test/test_socketdata.cpp" "CMakeFiles/test-srt.dir/test/test_socketdata.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_socketdata.cpp.o.d"
+  "/root/repo/test/test_sync.cpp" "CMakeFiles/test-srt.dir/test/test_sync.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_sync.cpp.o.d"
+  "/root/repo/test/test_threadname.cpp" "CMakeFiles/test-srt.dir/test/test_threadname.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_threadname.cpp.o.d"
+  "/root/repo/test/test_timer.cpp" "CMakeFiles/test-srt.dir/test/test_timer.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_timer.cpp.o.d"
+  "/root/repo/test/test_unitqueue.cpp" "CMakeFiles/test-srt.dir/test/test_unitqueue.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_unitqueue.cpp.o.d"
+  "/root/repo/test/test_utilities.cpp" "CMakeFiles/test-srt.dir/test/test_utilities.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_utilities.cpp.o.d"
+  "/root/repo/test/test_zerocopy.cpp" "CMakeFiles/test-srt.dir/test/test_zerocopy.cpp.o" "gcc" "CMakeFiles/test-srt.dir/test/test_zerocopy.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_dbg/CMakeFiles/srt_static.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,78 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-srt.dir/test/test_batch_transmission.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_batch_transmission.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_buffer_rcv.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_buffer_rcv.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_buffer_snd.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_buffer_snd.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_common.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_common.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_congctl.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_congctl.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_connection_timeout.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_connection_timeout.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_control_packets.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_control_packets.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_crypto.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_crypto.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_cryspr.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_cryspr.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_enforced_encryption.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_enforced_encryption.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_epoll.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_epoll.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_fec_rebuilding.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_fec_rebuilding.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_file_transmission.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_file_transmission.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_idtable.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_idtable.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_ipv6.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_ipv6.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_listen_callback.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_listen_callback.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_losslist_rcv.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_losslist_rcv.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_losslist_snd.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_losslist_snd.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_main.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_main.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_many_connections.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_many_connections.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_muxer.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_muxer.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_reuseaddr.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_reuseaddr.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_seqno.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_seqno.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_snd_rate_estimator.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_snd_rate_estimator.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_snd_scheduler.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_snd_scheduler.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_snd_shaper.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_snd_shaper.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_socket_options.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_socket_options.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_socketdata.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_socketdata.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_sync.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_sync.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_threadname.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_threadname.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_timer.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_timer.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_unitqueue.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_unitqueue.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_utilities.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_utilities.cpp.o.d"
+  "CMakeFiles/test-srt.dir/test/test_zerocopy.cpp.o"
+  "CMakeFiles/test-srt.dir/test/test_zerocopy.cpp.o.d"
+  "test-srt"
+  "test-srt.pdb"
+  "test-srt[1]_tests.cmake"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test-srt.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
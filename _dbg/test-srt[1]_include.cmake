@@ -0,0 +1,5 @@
+if(EXISTS "/root/repo/_dbg/test-srt[1]_tests.cmake")
+  include("/root/repo/_dbg/test-srt[1]_tests.cmake")
+else()
+  add_test(test-srt_NOT_BUILT test-srt_NOT_BUILT)
+endif()
@@ -0,0 +1,761 @@
+add_test([=[CRcvBufferReadMsg.Create]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.Create]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.Create]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.Destroy]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.Destroy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.Destroy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.FullBuffer]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.FullBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.FullBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.ReadMessageViews]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.ReadMessageViews]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.ReadMessageViews]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.ReadMessageScattered]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.ReadMessageScattered]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.ReadMessageScattered]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.StorageOnDemand]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.StorageOnDemand]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.StorageOnDemand]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.DropGapNoStorage]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.DropGapNoStorage]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.DropGapNoStorage]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.MemoryShare]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.MemoryShare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.MemoryShare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.OnePacketGap]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.OnePacketGap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.OnePacketGap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.OnePacketGapDrop]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.OnePacketGapDrop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.OnePacketGapDrop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.PacketDropBySeqNo]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.PacketDropBySeqNo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.PacketDropBySeqNo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.PacketDropLoPastBufferEnd]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.PacketDropLoPastBufferEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.PacketDropLoPastBufferEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.PacketDropByMsgNoSeqNo]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.PacketDropByMsgNoSeqNo]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.PacketDropByMsgNoSeqNo]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.OnePacket]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.OnePacket]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.OnePacket]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.AddData]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.AddData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.AddData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.MsgAcked]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.MsgAcked]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.MsgAcked]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.SmallReadBuffer]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.SmallReadBuffer]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.SmallReadBuffer]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.MsgHalfAck]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.MsgHalfAck]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.MsgHalfAck]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.OutOfOrderMsgNoACK]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.OutOfOrderMsgNoACK]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.OutOfOrderMsgNoACK]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.OutOfOrderMsgGap]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.OutOfOrderMsgGap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.OutOfOrderMsgGap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.LongMsgReadReady]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.LongMsgReadReady]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.LongMsgReadReady]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.MsgOutOfOrderDrop]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.MsgOutOfOrderDrop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.MsgOutOfOrderDrop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.MsgOutOfOrderAfterInOrder]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.MsgOutOfOrderAfterInOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.MsgOutOfOrderAfterInOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.OnePacketTSBPD]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.OnePacketTSBPD]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.OnePacketTSBPD]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadMsg.TSBPDGapBeforeValid]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadMsg.TSBPDGapBeforeValid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadMsg.TSBPDGapBeforeValid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadStream.ReadSinglePackets]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadStream.ReadSinglePackets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadStream.ReadSinglePackets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvBufferReadStream.ReadFractional]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvBufferReadStream.ReadFractional]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvBufferReadStream.ReadFractional]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.ReadAtOffset]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.ReadAtOffset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.ReadAtOffset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.IncreaseKeepsOrder]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.IncreaseKeepsOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.IncreaseKeepsOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.PacketSentTime]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.PacketSentTime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.PacketSentTime]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.AddBufferFromResetsTimes]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.AddBufferFromResetsTimes]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.AddBufferFromResetsTimes]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.AddBufferFromRexmit]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.AddBufferFromRexmit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.AddBufferFromRexmit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.MsgNoAndTTLDrop]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.MsgNoAndTTLDrop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.MsgNoAndTTLDrop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.DropLateData]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.DropLateData]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.DropLateData]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.ZeroCopyRelease]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.ZeroCopyRelease]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.ZeroCopyRelease]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.ZeroCopyDropped]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.ZeroCopyDropped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.ZeroCopyDropped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.AddBuffers]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.AddBuffers]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.AddBuffers]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.AddBufferGathered]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.AddBufferGathered]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.AddBufferGathered]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.SharedPool]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.SharedPool]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.SharedPool]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBufferTest.SharedPoolExhausted]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBufferTest.SharedPoolExhausted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBufferTest.SharedPoolExhausted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndBlockPool.Limit]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndBlockPool.Limit]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndBlockPool.Limit]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CIPAddress.IPv4_pton]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CIPAddress.IPv4_pton]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CIPAddress.IPv4_pton]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CIPAddress.IPv6_pton]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CIPAddress.IPv6_pton]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CIPAddress.IPv6_pton]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CIPAddress.IPv4_in_IPv6_pton]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CIPAddress.IPv4_in_IPv6_pton]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CIPAddress.IPv4_in_IPv6_pton]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Common.CookieContest]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=Common.CookieContest]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Common.CookieContest]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestConnectionTimeout.Nonblocking]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestConnectionTimeout.Nonblocking]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestConnectionTimeout.Nonblocking]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestConnectionTimeout.BlockingLoop]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestConnectionTimeout.BlockingLoop]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestConnectionTimeout.BlockingLoop]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestConnectionTimeout.BlockingInterrupted]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestConnectionTimeout.BlockingInterrupted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestConnectionTimeout.BlockingInterrupted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestConnectionTimeout.NonblockingInterrupted]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestConnectionTimeout.NonblockingInterrupted]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestConnectionTimeout.NonblockingInterrupted]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestConnectionAPI.Accept]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestConnectionAPI.Accept]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestConnectionAPI.Accept]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestConnectionAPI.Listen]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestConnectionAPI.Listen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestConnectionAPI.Listen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ControlPackets.DropReqRejectsShortPayload]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ControlPackets.DropReqRejectsShortPayload]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ControlPackets.DropReqRejectsShortPayload]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ControlPackets.LossReportRejectsTrailingRangeFirst]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ControlPackets.LossReportRejectsTrailingRangeFirst]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ControlPackets.LossReportRejectsTrailingRangeFirst]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CryptoKMRSP.RejectsMalformedLengths]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CryptoKMRSP.RejectsMalformedLengths]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CryptoKMRSP.RejectsMalformedLengths]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.MethodOpen]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.MethodOpen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.MethodOpen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.init]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.init]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.init]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.open]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.open]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.open]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.close]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.close]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.close]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.prng]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.prng]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.prng]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.aes_set_key]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.aes_set_key]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.aes_set_key]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.AESecb]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.AESecb]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.AESecb]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.AESctr]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.AESctr]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.AESctr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRmethods.SHA1]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRmethods.SHA1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRmethods.SHA1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.CtrlBlock]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.CtrlBlock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.CtrlBlock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.PBKDF2_tv1_k128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.PBKDF2_tv1_k128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.PBKDF2_tv1_k128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.PBKDF2_tv1_k192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.PBKDF2_tv1_k192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.PBKDF2_tv1_k192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.PBKDF2_tv1_k256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.PBKDF2_tv1_k256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.PBKDF2_tv1_k256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.PBKDF2_tv2_i1]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.PBKDF2_tv2_i1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.PBKDF2_tv2_i1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.PBKDF2_tv2_i20]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.PBKDF2_tv2_i20]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.PBKDF2_tv2_i20]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.PBKDF2_tv2_i4096]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.PBKDF2_tv2_i4096]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.PBKDF2_tv2_i4096]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.PBKDF2_tv3_0]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.PBKDF2_tv3_0]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.PBKDF2_tv3_0]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.KMWRAP_tv1_k128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.KMWRAP_tv1_k128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.KMWRAP_tv1_k128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.KMWRAP_tv1_k192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.KMWRAP_tv1_k192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.KMWRAP_tv1_k192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.KMWRAP_tv1_k256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.KMWRAP_tv1_k256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.KMWRAP_tv1_k256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.KMUNWRAP_tv1_k128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.KMUNWRAP_tv1_k128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.KMUNWRAP_tv1_k128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.KMUNWRAP_tv1_k192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.KMUNWRAP_tv1_k192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.KMUNWRAP_tv1_k192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.KMUNWRAP_tv1_k256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.KMUNWRAP_tv1_k256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.KMUNWRAP_tv1_k256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESecb_tv1_128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESecb_tv1_128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESecb_tv1_128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESecb_tv1_192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESecb_tv1_192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESecb_tv1_192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESecb_tv1_256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESecb_tv1_256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESecb_tv1_256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESecb_tv2_128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESecb_tv2_128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESecb_tv2_128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESecb_tv2_192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESecb_tv2_192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESecb_tv2_192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESecb_tv2_256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESecb_tv2_256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESecb_tv2_256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESecb_tv1_128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESecb_tv1_128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESecb_tv1_128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESecb_tv1_192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESecb_tv1_192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESecb_tv1_192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESecb_tv1_256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESecb_tv1_256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESecb_tv1_256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESecb_tv2_128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESecb_tv2_128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESecb_tv2_128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESecb_tv2_192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESecb_tv2_192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESecb_tv2_192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESecb_tv2_256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESecb_tv2_256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESecb_tv2_256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESctr_tv1_128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESctr_tv1_128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESctr_tv1_128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESctr_tv1_192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESctr_tv1_192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESctr_tv1_192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.EncryptAESctr_tv1_256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.EncryptAESctr_tv1_256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.EncryptAESctr_tv1_256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESctr_tv1_128]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESctr_tv1_128]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESctr_tv1_128]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESctr_tv1_192]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESctr_tv1_192]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESctr_tv1_192]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestCRYSPRcrypto.DecryptAESctr_tv1_256]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestCRYSPRcrypto.DecryptAESctr_tv1_256]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestCRYSPRcrypto.DecryptAESctr_tv1_256]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.PasswordLength]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.PasswordLength]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.PasswordLength]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.SetGetDefault]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.SetGetDefault]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.SetGetDefault]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_1_NonBlocking_Enforced_On_On_Pwd_Set_Set_Match]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_1_NonBlocking_Enforced_On_On_Pwd_Set_Set_Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_1_NonBlocking_Enforced_On_On_Pwd_Set_Set_Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_1_Blocking_Enforced_On_On_Pwd_Set_Set_Match]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_1_Blocking_Enforced_On_On_Pwd_Set_Set_Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_1_Blocking_Enforced_On_On_Pwd_Set_Set_Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_2_NonBlocking_Enforced_On_On_Pwd_Set_Set_Mismatch]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_2_NonBlocking_Enforced_On_On_Pwd_Set_Set_Mismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_2_NonBlocking_Enforced_On_On_Pwd_Set_Set_Mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_2_Blocking_Enforced_On_On_Pwd_Set_Set_Mismatch]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_2_Blocking_Enforced_On_On_Pwd_Set_Set_Mismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_2_Blocking_Enforced_On_On_Pwd_Set_Set_Mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_3_NonBlocking_Enforced_On_On_Pwd_Set_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_3_NonBlocking_Enforced_On_On_Pwd_Set_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_3_NonBlocking_Enforced_On_On_Pwd_Set_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_3_Blocking_Enforced_On_On_Pwd_Set_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_3_Blocking_Enforced_On_On_Pwd_Set_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_3_Blocking_Enforced_On_On_Pwd_Set_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_4_NonBlocking_Enforced_On_On_Pwd_None_Set]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_4_NonBlocking_Enforced_On_On_Pwd_None_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_4_NonBlocking_Enforced_On_On_Pwd_None_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_4_Blocking_Enforced_On_On_Pwd_None_Set]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_4_Blocking_Enforced_On_On_Pwd_None_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_4_Blocking_Enforced_On_On_Pwd_None_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_5_NonBlocking_Enforced_On_On_Pwd_None_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_5_NonBlocking_Enforced_On_On_Pwd_None_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_5_NonBlocking_Enforced_On_On_Pwd_None_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_A_5_Blocking_Enforced_On_On_Pwd_None_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_A_5_Blocking_Enforced_On_On_Pwd_None_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_A_5_Blocking_Enforced_On_On_Pwd_None_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_1_NonBlocking_Enforced_On_Off_Pwd_Set_Set_Match]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_1_NonBlocking_Enforced_On_Off_Pwd_Set_Set_Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_1_NonBlocking_Enforced_On_Off_Pwd_Set_Set_Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_1_Blocking_Enforced_On_Off_Pwd_Set_Set_Match]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_1_Blocking_Enforced_On_Off_Pwd_Set_Set_Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_1_Blocking_Enforced_On_Off_Pwd_Set_Set_Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_2_NonBlocking_Enforced_On_Off_Pwd_Set_Set_Mismatch]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_2_NonBlocking_Enforced_On_Off_Pwd_Set_Set_Mismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_2_NonBlocking_Enforced_On_Off_Pwd_Set_Set_Mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_2_Blocking_Enforced_On_Off_Pwd_Set_Set_Mismatch]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_2_Blocking_Enforced_On_Off_Pwd_Set_Set_Mismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_2_Blocking_Enforced_On_Off_Pwd_Set_Set_Mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_3_NonBlocking_Enforced_On_Off_Pwd_Set_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_3_NonBlocking_Enforced_On_Off_Pwd_Set_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_3_NonBlocking_Enforced_On_Off_Pwd_Set_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_3_Blocking_Enforced_On_Off_Pwd_Set_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_3_Blocking_Enforced_On_Off_Pwd_Set_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_3_Blocking_Enforced_On_Off_Pwd_Set_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_4_NonBlocking_Enforced_On_Off_Pwd_None_Set]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_4_NonBlocking_Enforced_On_Off_Pwd_None_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_4_NonBlocking_Enforced_On_Off_Pwd_None_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_4_Blocking_Enforced_On_Off_Pwd_None_Set]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_4_Blocking_Enforced_On_Off_Pwd_None_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_4_Blocking_Enforced_On_Off_Pwd_None_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_5_NonBlocking_Enforced_On_Off_Pwd_None_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_5_NonBlocking_Enforced_On_Off_Pwd_None_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_5_NonBlocking_Enforced_On_Off_Pwd_None_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_B_5_Blocking_Enforced_On_Off_Pwd_None_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_B_5_Blocking_Enforced_On_Off_Pwd_None_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_B_5_Blocking_Enforced_On_Off_Pwd_None_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_1_NonBlocking_Enforced_Off_On_Pwd_Set_Set_Match]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_1_NonBlocking_Enforced_Off_On_Pwd_Set_Set_Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_1_NonBlocking_Enforced_Off_On_Pwd_Set_Set_Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_1_Blocking_Enforced_Off_On_Pwd_Set_Set_Match]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_1_Blocking_Enforced_Off_On_Pwd_Set_Set_Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_1_Blocking_Enforced_Off_On_Pwd_Set_Set_Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_2_NonBlocking_Enforced_Off_On_Pwd_Set_Set_Mismatch]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_2_NonBlocking_Enforced_Off_On_Pwd_Set_Set_Mismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_2_NonBlocking_Enforced_Off_On_Pwd_Set_Set_Mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_2_Blocking_Enforced_Off_On_Pwd_Set_Set_Mismatch]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_2_Blocking_Enforced_Off_On_Pwd_Set_Set_Mismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_2_Blocking_Enforced_Off_On_Pwd_Set_Set_Mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_3_NonBlocking_Enforced_Off_On_Pwd_Set_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_3_NonBlocking_Enforced_Off_On_Pwd_Set_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_3_NonBlocking_Enforced_Off_On_Pwd_Set_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_3_Blocking_Enforced_Off_On_Pwd_Set_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_3_Blocking_Enforced_Off_On_Pwd_Set_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_3_Blocking_Enforced_Off_On_Pwd_Set_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_4_NonBlocking_Enforced_Off_On_Pwd_None_Set]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_4_NonBlocking_Enforced_Off_On_Pwd_None_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_4_NonBlocking_Enforced_Off_On_Pwd_None_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_4_Blocking_Enforced_Off_On_Pwd_None_Set]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_4_Blocking_Enforced_Off_On_Pwd_None_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_4_Blocking_Enforced_Off_On_Pwd_None_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_5_NonBlocking_Enforced_Off_On_Pwd_None_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_5_NonBlocking_Enforced_Off_On_Pwd_None_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_5_NonBlocking_Enforced_Off_On_Pwd_None_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_C_5_Blocking_Enforced_Off_On_Pwd_None_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_C_5_Blocking_Enforced_Off_On_Pwd_None_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_C_5_Blocking_Enforced_Off_On_Pwd_None_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_1_NonBlocking_Enforced_Off_Off_Pwd_Set_Set_Match]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_1_NonBlocking_Enforced_Off_Off_Pwd_Set_Set_Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_1_NonBlocking_Enforced_Off_Off_Pwd_Set_Set_Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_1_Blocking_Enforced_Off_Off_Pwd_Set_Set_Match]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_1_Blocking_Enforced_Off_Off_Pwd_Set_Set_Match]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_1_Blocking_Enforced_Off_Off_Pwd_Set_Set_Match]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_2_NonBlocking_Enforced_Off_Off_Pwd_Set_Set_Mismatch]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_2_NonBlocking_Enforced_Off_Off_Pwd_Set_Set_Mismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_2_NonBlocking_Enforced_Off_Off_Pwd_Set_Set_Mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_2_Blocking_Enforced_Off_Off_Pwd_Set_Set_Mismatch]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_2_Blocking_Enforced_Off_Off_Pwd_Set_Set_Mismatch]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_2_Blocking_Enforced_Off_Off_Pwd_Set_Set_Mismatch]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_3_NonBlocking_Enforced_Off_Off_Pwd_Set_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_3_NonBlocking_Enforced_Off_Off_Pwd_Set_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_3_NonBlocking_Enforced_Off_Off_Pwd_Set_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_3_Blocking_Enforced_Off_Off_Pwd_Set_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_3_Blocking_Enforced_Off_Off_Pwd_Set_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_3_Blocking_Enforced_Off_Off_Pwd_Set_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_4_NonBlocking_Enforced_Off_Off_Pwd_None_Set]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_4_NonBlocking_Enforced_Off_Off_Pwd_None_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_4_NonBlocking_Enforced_Off_Off_Pwd_None_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_4_Blocking_Enforced_Off_Off_Pwd_None_Set]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_4_Blocking_Enforced_Off_Off_Pwd_None_Set]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_4_Blocking_Enforced_Off_Off_Pwd_None_Set]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_5_NonBlocking_Enforced_Off_Off_Pwd_None_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_5_NonBlocking_Enforced_Off_Off_Pwd_None_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_5_NonBlocking_Enforced_Off_Off_Pwd_None_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEnforcedEncryption.CASE_D_5_Blocking_Enforced_Off_Off_Pwd_None_None]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEnforcedEncryption.CASE_D_5_Blocking_Enforced_Off_Off_Pwd_None_None]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEnforcedEncryption.CASE_D_5_Blocking_Enforced_Off_Off_Pwd_None_None]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.InfiniteWait]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.InfiniteWait]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.InfiniteWait]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.WaitNoSocketsInEpoll]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.WaitNoSocketsInEpoll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.WaitNoSocketsInEpoll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.WaitNoSocketsInEpoll2]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.WaitNoSocketsInEpoll2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.WaitNoSocketsInEpoll2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.WaitEmptyCall]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.WaitEmptyCall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.WaitEmptyCall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.UWaitEmptyCall]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.UWaitEmptyCall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.UWaitEmptyCall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.WaitAllSocketsInEpollReleased]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.WaitAllSocketsInEpollReleased]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.WaitAllSocketsInEpollReleased]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.WaitAllSocketsInEpollReleased2]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.WaitAllSocketsInEpollReleased2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.WaitAllSocketsInEpollReleased2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.WrongEpoll_idOnAddUSock]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.WrongEpoll_idOnAddUSock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.WrongEpoll_idOnAddUSock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.HandleEpollEvent]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.HandleEpollEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.HandleEpollEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.NotifyConnectionBreak]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.NotifyConnectionBreak]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.NotifyConnectionBreak]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.HandleEpollEvent2]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.HandleEpollEvent2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.HandleEpollEvent2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.HandleEpollNoEvent]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.HandleEpollNoEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.HandleEpollNoEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CEPoll.ThreadedUpdate]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CEPoll.ThreadedUpdate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CEPoll.ThreadedUpdate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestEPoll.SimpleAsync]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestEPoll.SimpleAsync]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestEPoll.SimpleAsync]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.ConfigExchange]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.ConfigExchange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.ConfigExchange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.ConfigExchangeFaux]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.ConfigExchangeFaux]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.ConfigExchangeFaux]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.Connection]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.Connection]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.Connection]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.ConnectionReorder]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.ConnectionReorder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.ConnectionReorder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.ConnectionFull1]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.ConnectionFull1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.ConnectionFull1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.ConnectionFull2]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.ConnectionFull2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.ConnectionFull2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.ConnectionMess]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.ConnectionMess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.ConnectionMess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.ConnectionForced]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.ConnectionForced]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.ConnectionForced]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.RejectionConflict]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.RejectionConflict]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.RejectionConflict]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.RejectionIncompleteEmpty]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.RejectionIncompleteEmpty]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.RejectionIncompleteEmpty]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.RejectionIncomplete]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.RejectionIncomplete]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.RejectionIncomplete]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFEC.XorKernels]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFEC.XorKernels]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFEC.XorKernels]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFECRebuilding.Prepare]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFECRebuilding.Prepare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFECRebuilding.Prepare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFECRebuilding.NoRebuild]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFECRebuilding.NoRebuild]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFECRebuilding.NoRebuild]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFECRebuilding.Rebuild]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFECRebuilding.Rebuild]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFECRebuilding.Rebuild]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestFECBench.Clip10x10]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestFECBench.DISABLED_Clip10x10]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestFECBench.Clip10x10]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[TestFECBench.Clip10x10]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Transmission.FileUpload]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=Transmission.FileUpload]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Transmission.FileUpload]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Transmission.FileDescriptor]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=Transmission.FileDescriptor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Transmission.FileDescriptor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Transmission.FileSizeOverEnd]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=Transmission.FileSizeOverEnd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Transmission.FileSizeOverEnd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CIdTable.InsertFindErase]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CIdTable.InsertFindErase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CIdTable.InsertFindErase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CIdTable.Churn]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CIdTable.Churn]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CIdTable.Churn]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CIdTable.ConcurrentReaders]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CIdTable.ConcurrentReaders]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CIdTable.ConcurrentReaders]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CIdTable.SynchronizeAgainstEnteringReader]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CIdTable.SynchronizeAgainstEnteringReader]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CIdTable.SynchronizeAgainstEnteringReader]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestIPv6.v4_calls_v6_mapped]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestIPv6.v4_calls_v6_mapped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestIPv6.v4_calls_v6_mapped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestIPv6.v6_calls_v6_mapped]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestIPv6.v6_calls_v6_mapped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestIPv6.v6_calls_v6_mapped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestIPv6.v6_calls_v6]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestIPv6.v6_calls_v6]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestIPv6.v6_calls_v6]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestIPv6.v6_calls_v4]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestIPv6.v6_calls_v4]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestIPv6.v6_calls_v4]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ListenerCallback.SecureSuccess]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ListenerCallback.SecureSuccess]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ListenerCallback.SecureSuccess]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ListenerCallback.FauxPass]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ListenerCallback.FauxPass]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ListenerCallback.FauxPass]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ListenerCallback.FauxUser]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ListenerCallback.FauxUser]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ListenerCallback.FauxUser]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ListenerCallback.FauxSyntax]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ListenerCallback.FauxSyntax]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ListenerCallback.FauxSyntax]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListTest.Create<srt::CRcvLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListTest/0.Create]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListTest.Create<srt::CRcvLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListTest.InsertRemoveOneElem<srt::CRcvLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListTest/0.InsertRemoveOneElem]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListTest.InsertRemoveOneElem<srt::CRcvLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListTest.InsertTwoElemsEdge<srt::CRcvLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListTest/0.InsertTwoElemsEdge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListTest.InsertTwoElemsEdge<srt::CRcvLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListTest.RemoveAndReport<srt::CRcvLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListTest/0.RemoveAndReport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListTest.RemoveAndReport<srt::CRcvLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListTest.Create<srt::CRcvLossRanges>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListTest/1.Create]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListTest.Create<srt::CRcvLossRanges>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListTest.InsertRemoveOneElem<srt::CRcvLossRanges>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListTest/1.InsertRemoveOneElem]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListTest.InsertRemoveOneElem<srt::CRcvLossRanges>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListTest.InsertTwoElemsEdge<srt::CRcvLossRanges>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListTest/1.InsertTwoElemsEdge]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListTest.InsertTwoElemsEdge<srt::CRcvLossRanges>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListTest.RemoveAndReport<srt::CRcvLossRanges>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListTest/1.RemoveAndReport]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListTest.RemoveAndReport<srt::CRcvLossRanges>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossRangesTest.ReceivedRanges]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossRangesTest.ReceivedRanges]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossRangesTest.ReceivedRanges]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossRangesTest.RandomAgainstModel]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossRangesTest.RandomAgainstModel]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossRangesTest.RandomAgainstModel]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvFreshLossListTest.CheckFreshLossList]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvFreshLossListTest.CheckFreshLossList]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvFreshLossListTest.CheckFreshLossList]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CRcvLossListBench.RandomLoss]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CRcvLossListBench.DISABLED_RandomLoss]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CRcvLossListBench.RandomLoss]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[CRcvLossListBench.RandomLoss]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.Create<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.Create]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.Create<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopOneElem<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertPopOneElem]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopOneElem<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertNegativeSeqno<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertNegativeSeqno]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertNegativeSeqno<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopTwoElemsRange<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertPopTwoElemsRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopTwoElemsRange<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopTwoElems<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertPopTwoElems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopTwoElems<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopTwoSerialElems<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertPopTwoSerialElems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopTwoSerialElems<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopRangeAndSingle<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertPopRangeAndSingle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopRangeAndSingle<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopFourElems<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertPopFourElems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopFourElems<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertCoalesce<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertCoalesce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertCoalesce<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNodeHead01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNodeHead01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNodeHead01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNodeHead02<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNodeHead02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNodeHead02<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNodeHead03<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNodeHead03]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNodeHead03<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNodeHead04<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNodeHead04]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNodeHead04<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead02<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead02<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead03<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead03]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead03<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead04<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead04]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead04<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead05<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead05]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead05<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead06<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead06]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead06<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead07<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead07]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead07<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead08<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead08]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead08<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead09<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead09]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead09<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead10<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead10]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead10<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead11<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.BasicRemoveInListNotInNodeHead11]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead11<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertRemoveInsert01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertRemoveInsert01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertRemoveInsert01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHead01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertHead01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHead01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHead02<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertHead02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHead02<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadIncrease01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertHeadIncrease01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadIncrease01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadOverlap01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertHeadOverlap01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadOverlap01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadOverlap02<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertHeadOverlap02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadOverlap02<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadNegativeOffset01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertHeadNegativeOffset01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadNegativeOffset01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadNegativeOffset02<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertHeadNegativeOffset02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadNegativeOffset02<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertFullListCoalesce<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertFullListCoalesce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertFullListCoalesce<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertFullListNoCoalesce<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertFullListNoCoalesce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertFullListNoCoalesce<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertFullListNegativeOffset<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertFullListNegativeOffset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertFullListNegativeOffset<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPositiveOffsetTooFar<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertPositiveOffsetTooFar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPositiveOffsetTooFar<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertNoUpdateElement01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertNoUpdateElement01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertNoUpdateElement01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertNoUpdateElement03<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertNoUpdateElement03]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertNoUpdateElement03<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertUpdateElement01<srt::CSndLossList>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/0.InsertUpdateElement01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertUpdateElement01<srt::CSndLossList>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.Create<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.Create]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.Create<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopOneElem<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertPopOneElem]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopOneElem<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertNegativeSeqno<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertNegativeSeqno]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertNegativeSeqno<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopTwoElemsRange<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertPopTwoElemsRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopTwoElemsRange<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopTwoElems<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertPopTwoElems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopTwoElems<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopTwoSerialElems<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertPopTwoSerialElems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopTwoSerialElems<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopRangeAndSingle<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertPopRangeAndSingle]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopRangeAndSingle<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPopFourElems<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertPopFourElems]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPopFourElems<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertCoalesce<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertCoalesce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertCoalesce<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNodeHead01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNodeHead01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNodeHead01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNodeHead02<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNodeHead02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNodeHead02<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNodeHead03<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNodeHead03]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNodeHead03<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNodeHead04<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNodeHead04]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNodeHead04<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead02<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead02<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead03<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead03]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead03<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead04<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead04]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead04<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead05<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead05]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead05<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead06<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead06]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead06<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead07<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead07]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead07<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead08<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead08]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead08<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead09<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead09]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead09<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead10<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead10]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead10<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.BasicRemoveInListNotInNodeHead11<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.BasicRemoveInListNotInNodeHead11]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.BasicRemoveInListNotInNodeHead11<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertRemoveInsert01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertRemoveInsert01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertRemoveInsert01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHead01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertHead01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHead01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHead02<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertHead02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHead02<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadIncrease01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertHeadIncrease01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadIncrease01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadOverlap01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertHeadOverlap01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadOverlap01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadOverlap02<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertHeadOverlap02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadOverlap02<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadNegativeOffset01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertHeadNegativeOffset01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadNegativeOffset01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertHeadNegativeOffset02<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertHeadNegativeOffset02]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertHeadNegativeOffset02<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertFullListCoalesce<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertFullListCoalesce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertFullListCoalesce<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertFullListNoCoalesce<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertFullListNoCoalesce]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertFullListNoCoalesce<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertFullListNegativeOffset<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertFullListNegativeOffset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertFullListNegativeOffset<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertPositiveOffsetTooFar<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertPositiveOffsetTooFar]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertPositiveOffsetTooFar<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertNoUpdateElement01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertNoUpdateElement01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertNoUpdateElement01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertNoUpdateElement03<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertNoUpdateElement03]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertNoUpdateElement03<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListTest.InsertUpdateElement01<srt::CSndLossSet>]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListTest/1.InsertUpdateElement01]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListTest.InsertUpdateElement01<srt::CSndLossSet>]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossSetTest.RemoveRange]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossSetTest.RemoveRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossSetTest.RemoveRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossSetTest.GetNextLostSeq]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossSetTest.GetNextLostSeq]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossSetTest.GetNextLostSeq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndLossListBench.ScatteredLoss]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndLossListBench.DISABLED_ScatteredLoss]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndLossListBench.ScatteredLoss]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[CSndLossListBench.ScatteredLoss]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestConnection.Multiple]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestConnection.Multiple]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestConnection.Multiple]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestMuxer.IPv4_and_IPv6]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestMuxer.IPv4_and_IPv6]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestMuxer.IPv4_and_IPv6]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSeqNo.constants]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSeqNo.constants]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSeqNo.constants]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSeqNo.seqcmp]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSeqNo.seqcmp]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSeqNo.seqcmp]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSeqNo.seqoff]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSeqNo.seqoff]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSeqNo.seqoff]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSeqNo.seqlen]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSeqNo.seqlen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSeqNo.seqlen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSeqNo.incseq]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSeqNo.incseq]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSeqNo.incseq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSeqNo.decseq]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSeqNo.decseq]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSeqNo.decseq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSeqNo.incseqint]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSeqNo.incseqint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSeqNo.incseqint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSeqNo.decseqint]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSeqNo.decseqint]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSeqNo.decseqint]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CUDT.getFlightSpan]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CUDT.getFlightSpan]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CUDT.getFlightSpan]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.DefaultVals]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.DefaultVals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.DefaultVals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.MaxVals]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.MaxVals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.MaxVals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.MinVals]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.MinVals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.MinVals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.InvalidVals]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.InvalidVals]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.InvalidVals]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.RestrictionBind]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.RestrictionBind]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.RestrictionBind]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.RestrictionListening]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.RestrictionListening]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.RestrictionListening]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.RestrictionConnected]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.RestrictionConnected]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.RestrictionConnected]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.TLPktDropInherits]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.TLPktDropInherits]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.TLPktDropInherits]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.Latency]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.Latency]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.Latency]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.LossMaxTTL]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.LossMaxTTL]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.LossMaxTTL]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.MinInputBWWrongLen]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.MinInputBWWrongLen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.MinInputBWWrongLen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.MinInputBWDefault]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.MinInputBWDefault]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.MinInputBWDefault]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.MinInputBWSet]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.MinInputBWSet]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.MinInputBWSet]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.MinInputBWRuntime]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.MinInputBWRuntime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.MinInputBWRuntime]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.StreamIDWrongLen]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.StreamIDWrongLen]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.StreamIDWrongLen]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.StringOptLenInvalid]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.StringOptLenInvalid]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.StringOptLenInvalid]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.StreamIDOdd]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.StreamIDOdd]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.StreamIDOdd]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.StreamIDEven]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.StreamIDEven]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.StreamIDEven]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.StreamIDAlmostFull]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.StreamIDAlmostFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.StreamIDAlmostFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.StreamIDFull]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.StreamIDFull]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.StreamIDFull]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSocketOptions.StreamIDLenListener]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSocketOptions.StreamIDLenListener]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSocketOptions.StreamIDLenListener]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.BasicChecks]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.BasicChecks]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.BasicChecks]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.DurationFrom]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.DurationFrom]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.DurationFrom]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.RelOperators]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.RelOperators]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.RelOperators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.OperatorMinus]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.OperatorMinus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.OperatorMinus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.OperatorMinusEq]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.OperatorMinusEq]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.OperatorMinusEq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.OperatorPlus]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.OperatorPlus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.OperatorPlus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.OperatorPlusEq]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.OperatorPlusEq]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.OperatorPlusEq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.OperatorMultInt]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.OperatorMultInt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.OperatorMultInt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncDuration.OperatorMultIntEq]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncDuration.OperatorMultIntEq]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncDuration.OperatorMultIntEq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncRandom.GenRandomInt]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncRandom.GenRandomInt]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncRandom.GenRandomInt]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncTimePoint.DefaultConstructorZero]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncTimePoint.DefaultConstructorZero]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncTimePoint.DefaultConstructorZero]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncTimePoint.RelOperators]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncTimePoint.RelOperators]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncTimePoint.RelOperators]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncTimePoint.OperatorMinus]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncTimePoint.OperatorMinus]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncTimePoint.OperatorMinus]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncTimePoint.OperatorEq]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncTimePoint.OperatorEq]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncTimePoint.OperatorEq]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncTimePoint.OperatorMinusPlusDuration]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncTimePoint.OperatorMinusPlusDuration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncTimePoint.OperatorMinusPlusDuration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncTimePoint.OperatorPlusEqDuration]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncTimePoint.OperatorPlusEqDuration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncTimePoint.OperatorPlusEqDuration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncTimePoint.OperatorMinusEqDuration]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncTimePoint.OperatorMinusEqDuration]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncTimePoint.OperatorMinusEqDuration]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncUniqueLock.LockUnlock]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncUniqueLock.LockUnlock]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncUniqueLock.LockUnlock]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncUniqueLock.Scope]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncUniqueLock.Scope]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncUniqueLock.Scope]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncEvent.WaitFor]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncEvent.WaitFor]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncEvent.WaitFor]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncEvent.WaitForNotifyOne]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncEvent.WaitForNotifyOne]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncEvent.WaitForNotifyOne]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncEvent.WaitNotifyOne]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncEvent.WaitNotifyOne]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncEvent.WaitNotifyOne]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncEvent.WaitForTwoNotifyOne]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncEvent.WaitForTwoNotifyOne]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncEvent.WaitForTwoNotifyOne]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncEvent.WaitForTwoNotifyAll]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncEvent.WaitForTwoNotifyAll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncEvent.WaitForTwoNotifyAll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncEvent.WaitForNotifyAll]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncEvent.WaitForNotifyAll]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncEvent.WaitForNotifyAll]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SyncThread.Joinable]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SyncThread.Joinable]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SyncThread.Joinable]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Sync.FormatTime]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=Sync.FormatTime]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Sync.FormatTime]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[Sync.FormatTimeSys]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=Sync.FormatTimeSys]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[Sync.FormatTimeSys]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadName.GetSet]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ThreadName.GetSet]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadName.GetSet]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ThreadName.AutoReset]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ThreadName.AutoReset]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ThreadName.AutoReset]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CTimer.SleeptoAccuracy]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CTimer.DISABLED_SleeptoAccuracy]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CTimer.SleeptoAccuracy]=]  PROPERTIES DISABLED TRUE)
+set_tests_properties([=[CTimer.SleeptoAccuracy]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CTimer.PacingStats]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CTimer.PacingStats]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CTimer.PacingStats]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CUnitQueue.Increase]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CUnitQueue.Increase]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CUnitQueue.Increase]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CUnitQueue.IncreaseAndFree]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CUnitQueue.IncreaseAndFree]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CUnitQueue.IncreaseAndFree]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CUnitQueue.IncreaseAndFreeGrouped]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CUnitQueue.IncreaseAndFreeGrouped]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CUnitQueue.IncreaseAndFreeGrouped]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CircularBuffer.Overall]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CircularBuffer.Overall]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CircularBuffer.Overall]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CircularBitmap.FindWithWrap]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CircularBitmap.FindWithWrap]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CircularBitmap.FindWithWrap]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CircularBitmap.SetRange]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CircularBitmap.SetRange]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CircularBitmap.SetRange]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ConfigString.Setting]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ConfigString.Setting]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ConfigString.Setting]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.SameAddr1]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.SameAddr1]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.SameAddr1]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.SameAddr2]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.SameAddr2]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.SameAddr2]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.SameAddrV6]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.SameAddrV6]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.SameAddrV6]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.DiffAddr]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.DiffAddr]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.DiffAddr]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.UDPOptions]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.UDPOptions]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.UDPOptions]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.Wildcard]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.Wildcard]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.Wildcard]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.Wildcard6]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.Wildcard6]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.Wildcard6]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.ProtocolVersion6]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.ProtocolVersion6]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.ProtocolVersion6]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[ReuseAddr.ProtocolVersionFaux6]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=ReuseAddr.ProtocolVersionFaux6]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[ReuseAddr.ProtocolVersionFaux6]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SendMsgZeroCopy.LiveTransmission]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SendMsgZeroCopy.LiveTransmission]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SendMsgZeroCopy.LiveTransmission]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecvMsgZeroCopy.LiveTransmission]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=RecvMsgZeroCopy.LiveTransmission]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RecvMsgZeroCopy.LiveTransmission]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SendMMsg.LiveTransmission]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SendMMsg.LiveTransmission]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SendMMsg.LiveTransmission]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[RecvMMsg.LiveTransmission]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=RecvMMsg.LiveTransmission]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[RecvMMsg.LiveTransmission]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[SocketData.PeerName]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=SocketData.PeerName]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[SocketData.PeerName]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.LEDBATBaseDelay]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.LEDBATBaseDelay]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.LEDBATBaseDelay]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.LEDBATWindow]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.LEDBATWindow]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.LEDBATWindow]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.CUBICWindowGrowth]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.CUBICWindowGrowth]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.CUBICWindowGrowth]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.CUBICRenoFriendly]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.CUBICRenoFriendly]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.CUBICRenoFriendly]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.CUBICFastConvergence]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.CUBICFastConvergence]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.CUBICFastConvergence]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.CUBICLossEvent]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.CUBICLossEvent]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.CUBICLossEvent]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.FileOverLossyLink]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.FileOverLossyLink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.FileOverLossyLink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.BBROverLossyLink]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.BBROverLossyLink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.BBROverLossyLink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.CUBICOverLossyLink]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.CUBICOverLossyLink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.CUBICOverLossyLink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.LEDBATOverLossyLink]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.LEDBATOverLossyLink]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.LEDBATOverLossyLink]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CongestionControl.UserDefined]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CongestionControl.UserDefined]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CongestionControl.UserDefined]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndShaper.AggregateRate]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndShaper.AggregateRate]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndShaper.AggregateRate]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndShaper.Weights]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndShaper.Weights]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndShaper.Weights]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndShaper.Guarantee]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndShaper.Guarantee]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndShaper.Guarantee]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[CSndShaper.UnusedShare]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=CSndShaper.UnusedShare]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[CSndShaper.UnusedShare]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSndScheduler.DeficitRoundRobin]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSndScheduler.DeficitRoundRobin]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSndScheduler.DeficitRoundRobin]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSndScheduler.DeficitSmallPackets]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSndScheduler.DeficitSmallPackets]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSndScheduler.DeficitSmallPackets]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+add_test([=[TestSndScheduler.TimeOrder]=]  /root/repo/_dbg/test-srt [==[--gtest_filter=TestSndScheduler.TimeOrder]==] --gtest_also_run_disabled_tests)
+set_tests_properties([=[TestSndScheduler.TimeOrder]=]  PROPERTIES WORKING_DIRECTORY /root/repo/_dbg SKIP_REGULAR_EXPRESSION [==[\[  SKIPPED \]]==])
+set(  test-srt_TESTS CRcvBufferReadMsg.Create CRcvBufferReadMsg.Destroy CRcvBufferReadMsg.FullBuffer CRcvBufferReadMsg.ReadMessageViews CRcvBufferReadMsg.ReadMessageScattered CRcvBufferReadMsg.StorageOnDemand CRcvBufferReadMsg.DropGapNoStorage CRcvBufferReadMsg.MemoryShare CRcvBufferReadMsg.OnePacketGap CRcvBufferReadMsg.OnePacketGapDrop CRcvBufferReadMsg.PacketDropBySeqNo CRcvBufferReadMsg.PacketDropLoPastBufferEnd CRcvBufferReadMsg.PacketDropByMsgNoSeqNo CRcvBufferReadMsg.OnePacket CRcvBufferReadMsg.AddData CRcvBufferReadMsg.MsgAcked CRcvBufferReadMsg.SmallReadBuffer CRcvBufferReadMsg.MsgHalfAck CRcvBufferReadMsg.OutOfOrderMsgNoACK CRcvBufferReadMsg.OutOfOrderMsgGap CRcvBufferReadMsg.LongMsgReadReady CRcvBufferReadMsg.MsgOutOfOrderDrop CRcvBufferReadMsg.MsgOutOfOrderAfterInOrder CRcvBufferReadMsg.OnePacketTSBPD CRcvBufferReadMsg.TSBPDGapBeforeValid CRcvBufferReadStream.ReadSinglePackets CRcvBufferReadStream.ReadFractional CSndBufferTest.ReadAtOffset CSndBufferTest.IncreaseKeepsOrder CSndBufferTest.PacketSentTime CSndBufferTest.AddBufferFromResetsTimes CSndBufferTest.AddBufferFromRexmit CSndBufferTest.MsgNoAndTTLDrop CSndBufferTest.DropLateData CSndBufferTest.ZeroCopyRelease CSndBufferTest.ZeroCopyDropped CSndBufferTest.AddBuffers CSndBufferTest.AddBufferGathered CSndBufferTest.SharedPool CSndBufferTest.SharedPoolExhausted CSndBlockPool.Limit CIPAddress.IPv4_pton CIPAddress.IPv6_pton CIPAddress.IPv4_in_IPv6_pton Common.CookieContest TestConnectionTimeout.Nonblocking TestConnectionTimeout.BlockingLoop TestConnectionTimeout.BlockingInterrupted TestConnectionTimeout.NonblockingInterrupted TestConnectionAPI.Accept TestConnectionAPI.Listen ControlPackets.DropReqRejectsShortPayload ControlPackets.LossReportRejectsTrailingRangeFirst CryptoKMRSP.RejectsMalformedLengths TestCRYSPRmethods.MethodOpen TestCRYSPRmethods.init TestCRYSPRmethods.open TestCRYSPRmethods.close TestCRYSPRmethods.prng TestCRYSPRmethods.aes_set_key TestCRYSPRmethods.AESecb TestCRYSPRmethods.AESctr TestCRYSPRmethods.SHA1 TestCRYSPRcrypto.CtrlBlock TestCRYSPRcrypto.PBKDF2_tv1_k128 TestCRYSPRcrypto.PBKDF2_tv1_k192 TestCRYSPRcrypto.PBKDF2_tv1_k256 TestCRYSPRcrypto.PBKDF2_tv2_i1 TestCRYSPRcrypto.PBKDF2_tv2_i20 TestCRYSPRcrypto.PBKDF2_tv2_i4096 TestCRYSPRcrypto.PBKDF2_tv3_0 TestCRYSPRcrypto.KMWRAP_tv1_k128 TestCRYSPRcrypto.KMWRAP_tv1_k192 TestCRYSPRcrypto.KMWRAP_tv1_k256 TestCRYSPRcrypto.KMUNWRAP_tv1_k128 TestCRYSPRcrypto.KMUNWRAP_tv1_k192 TestCRYSPRcrypto.KMUNWRAP_tv1_k256 TestCRYSPRcrypto.EncryptAESecb_tv1_128 TestCRYSPRcrypto.EncryptAESecb_tv1_192 TestCRYSPRcrypto.EncryptAESecb_tv1_256 TestCRYSPRcrypto.EncryptAESecb_tv2_128 TestCRYSPRcrypto.EncryptAESecb_tv2_192 TestCRYSPRcrypto.EncryptAESecb_tv2_256 TestCRYSPRcrypto.DecryptAESecb_tv1_128 TestCRYSPRcrypto.DecryptAESecb_tv1_192 TestCRYSPRcrypto.DecryptAESecb_tv1_256 TestCRYSPRcrypto.DecryptAESecb_tv2_128 TestCRYSPRcrypto.DecryptAESecb_tv2_192 TestCRYSPRcrypto.DecryptAESecb_tv2_256 TestCRYSPRcrypto.EncryptAESctr_tv1_128 TestCRYSPRcrypto.EncryptAESctr_tv1_192 TestCRYSPRcrypto.EncryptAESctr_tv1_256 TestCRYSPRcrypto.DecryptAESctr_tv1_128 TestCRYSPRcrypto.DecryptAESctr_tv1_192 TestCRYSPRcrypto.DecryptAESctr_tv1_256 TestEnforcedEncryption.PasswordLength TestEnforcedEncryption.SetGetDefault TestEnforcedEncryption.CASE_A_1_NonBlocking_Enforced_On_On_Pwd_Set_Set_Match TestEnforcedEncryption.CASE_A_1_Blocking_Enforced_On_On_Pwd_Set_Set_Match TestEnforcedEncryption.CASE_A_2_NonBlocking_Enforced_On_On_Pwd_Set_Set_Mismatch TestEnforcedEncryption.CASE_A_2_Blocking_Enforced_On_On_Pwd_Set_Set_Mismatch TestEnforcedEncryption.CASE_A_3_NonBlocking_Enforced_On_On_Pwd_Set_None TestEnforcedEncryption.CASE_A_3_Blocking_Enforced_On_On_Pwd_Set_None TestEnforcedEncryption.CASE_A_4_NonBlocking_Enforced_On_On_Pwd_None_Set TestEnforcedEncryption.CASE_A_4_Blocking_Enforced_On_On_Pwd_None_Set TestEnforcedEncryption.CASE_A_5_NonBlocking_Enforced_On_On_Pwd_None_None TestEnforcedEncryption.CASE_A_5_Blocking_Enforced_On_On_Pwd_None_None TestEnforcedEncryption.CASE_B_1_NonBlocking_Enforced_On_Off_Pwd_Set_Set_Match TestEnforcedEncryption.CASE_B_1_Blocking_Enforced_On_Off_Pwd_Set_Set_Match TestEnforcedEncryption.CASE_B_2_NonBlocking_Enforced_On_Off_Pwd_Set_Set_Mismatch TestEnforcedEncryption.CASE_B_2_Blocking_Enforced_On_Off_Pwd_Set_Set_Mismatch TestEnforcedEncryption.CASE_B_3_NonBlocking_Enforced_On_Off_Pwd_Set_None TestEnforcedEncryption.CASE_B_3_Blocking_Enforced_On_Off_Pwd_Set_None TestEnforcedEncryption.CASE_B_4_NonBlocking_Enforced_On_Off_Pwd_None_Set TestEnforcedEncryption.CASE_B_4_Blocking_Enforced_On_Off_Pwd_None_Set TestEnforcedEncryption.CASE_B_5_NonBlocking_Enforced_On_Off_Pwd_None_None TestEnforcedEncryption.CASE_B_5_Blocking_Enforced_On_Off_Pwd_None_None TestEnforcedEncryption.CASE_C_1_NonBlocking_Enforced_Off_On_Pwd_Set_Set_Match TestEnforcedEncryption.CASE_C_1_Blocking_Enforced_Off_On_Pwd_Set_Set_Match TestEnforcedEncryption.CASE_C_2_NonBlocking_Enforced_Off_On_Pwd_Set_Set_Mismatch TestEnforcedEncryption.CASE_C_2_Blocking_Enforced_Off_On_Pwd_Set_Set_Mismatch TestEnforcedEncryption.CASE_C_3_NonBlocking_Enforced_Off_On_Pwd_Set_None TestEnforcedEncryption.CASE_C_3_Blocking_Enforced_Off_On_Pwd_Set_None TestEnforcedEncryption.CASE_C_4_NonBlocking_Enforced_Off_On_Pwd_None_Set TestEnforcedEncryption.CASE_C_4_Blocking_Enforced_Off_On_Pwd_None_Set TestEnforcedEncryption.CASE_C_5_NonBlocking_Enforced_Off_On_Pwd_None_None TestEnforcedEncryption.CASE_C_5_Blocking_Enforced_Off_On_Pwd_None_None TestEnforcedEncryption.CASE_D_1_NonBlocking_Enforced_Off_Off_Pwd_Set_Set_Match TestEnforcedEncryption.CASE_D_1_Blocking_Enforced_Off_Off_Pwd_Set_Set_Match TestEnforcedEncryption.CASE_D_2_NonBlocking_Enforced_Off_Off_Pwd_Set_Set_Mismatch TestEnforcedEncryption.CASE_D_2_Blocking_Enforced_Off_Off_Pwd_Set_Set_Mismatch TestEnforcedEncryption.CASE_D_3_NonBlocking_Enforced_Off_Off_Pwd_Set_None TestEnforcedEncryption.CASE_D_3_Blocking_Enforced_Off_Off_Pwd_Set_None TestEnforcedEncryption.CASE_D_4_NonBlocking_Enforced_Off_Off_Pwd_None_Set TestEnforcedEncryption.CASE_D_4_Blocking_Enforced_Off_Off_Pwd_None_Set TestEnforcedEncryption.CASE_D_5_NonBlocking_Enforced_Off_Off_Pwd_None_None TestEnforcedEncryption.CASE_D_5_Blocking_Enforced_Off_Off_Pwd_None_None CEPoll.InfiniteWait CEPoll.WaitNoSocketsInEpoll CEPoll.WaitNoSocketsInEpoll2 CEPoll.WaitEmptyCall CEPoll.UWaitEmptyCall CEPoll.WaitAllSocketsInEpollReleased CEPoll.WaitAllSocketsInEpollReleased2 CEPoll.WrongEpoll_idOnAddUSock CEPoll.HandleEpollEvent CEPoll.NotifyConnectionBreak CEPoll.HandleEpollEvent2 CEPoll.HandleEpollNoEvent CEPoll.ThreadedUpdate TestEPoll.SimpleAsync TestFEC.ConfigExchange TestFEC.ConfigExchangeFaux TestFEC.Connection TestFEC.ConnectionReorder TestFEC.ConnectionFull1 TestFEC.ConnectionFull2 TestFEC.ConnectionMess TestFEC.ConnectionForced TestFEC.RejectionConflict TestFEC.RejectionIncompleteEmpty TestFEC.RejectionIncomplete TestFEC.XorKernels TestFECRebuilding.Prepare TestFECRebuilding.NoRebuild TestFECRebuilding.Rebuild TestFECBench.Clip10x10 Transmission.FileUpload Transmission.FileDescriptor Transmission.FileSizeOverEnd CIdTable.InsertFindErase CIdTable.Churn CIdTable.ConcurrentReaders CIdTable.SynchronizeAgainstEnteringReader TestIPv6.v4_calls_v6_mapped TestIPv6.v6_calls_v6_mapped TestIPv6.v6_calls_v6 TestIPv6.v6_calls_v4 ListenerCallback.SecureSuccess ListenerCallback.FauxPass ListenerCallback.FauxUser ListenerCallback.FauxSyntax [==[CRcvLossListTest.Create<srt::CRcvLossList>]==] [==[CRcvLossListTest.InsertRemoveOneElem<srt::CRcvLossList>]==] [==[CRcvLossListTest.InsertTwoElemsEdge<srt::CRcvLossList>]==] [==[CRcvLossListTest.RemoveAndReport<srt::CRcvLossList>]==] [==[CRcvLossListTest.Create<srt::CRcvLossRanges>]==] [==[CRcvLossListTest.InsertRemoveOneElem<srt::CRcvLossRanges>]==] [==[CRcvLossListTest.InsertTwoElemsEdge<srt::CRcvLossRanges>]==] [==[CRcvLossListTest.RemoveAndReport<srt::CRcvLossRanges>]==] CRcvLossRangesTest.ReceivedRanges CRcvLossRangesTest.RandomAgainstModel CRcvFreshLossListTest.CheckFreshLossList CRcvLossListBench.RandomLoss [==[CSndLossListTest.Create<srt::CSndLossList>]==] [==[CSndLossListTest.InsertPopOneElem<srt::CSndLossList>]==] [==[CSndLossListTest.InsertNegativeSeqno<srt::CSndLossList>]==] [==[CSndLossListTest.InsertPopTwoElemsRange<srt::CSndLossList>]==] [==[CSndLossListTest.InsertPopTwoElems<srt::CSndLossList>]==] [==[CSndLossListTest.InsertPopTwoSerialElems<srt::CSndLossList>]==] [==[CSndLossListTest.InsertPopRangeAndSingle<srt::CSndLossList>]==] [==[CSndLossListTest.InsertPopFourElems<srt::CSndLossList>]==] [==[CSndLossListTest.InsertCoalesce<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNodeHead01<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNodeHead02<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNodeHead03<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNodeHead04<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead01<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead02<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead03<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead04<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead05<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead06<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead07<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead08<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead09<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead10<srt::CSndLossList>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead11<srt::CSndLossList>]==] [==[CSndLossListTest.InsertRemoveInsert01<srt::CSndLossList>]==] [==[CSndLossListTest.InsertHead01<srt::CSndLossList>]==] [==[CSndLossListTest.InsertHead02<srt::CSndLossList>]==] [==[CSndLossListTest.InsertHeadIncrease01<srt::CSndLossList>]==] [==[CSndLossListTest.InsertHeadOverlap01<srt::CSndLossList>]==] [==[CSndLossListTest.InsertHeadOverlap02<srt::CSndLossList>]==] [==[CSndLossListTest.InsertHeadNegativeOffset01<srt::CSndLossList>]==] [==[CSndLossListTest.InsertHeadNegativeOffset02<srt::CSndLossList>]==] [==[CSndLossListTest.InsertFullListCoalesce<srt::CSndLossList>]==] [==[CSndLossListTest.InsertFullListNoCoalesce<srt::CSndLossList>]==] [==[CSndLossListTest.InsertFullListNegativeOffset<srt::CSndLossList>]==] [==[CSndLossListTest.InsertPositiveOffsetTooFar<srt::CSndLossList>]==] [==[CSndLossListTest.InsertNoUpdateElement01<srt::CSndLossList>]==] [==[CSndLossListTest.InsertNoUpdateElement03<srt::CSndLossList>]==] [==[CSndLossListTest.InsertUpdateElement01<srt::CSndLossList>]==] [==[CSndLossListTest.Create<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertPopOneElem<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertNegativeSeqno<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertPopTwoElemsRange<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertPopTwoElems<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertPopTwoSerialElems<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertPopRangeAndSingle<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertPopFourElems<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertCoalesce<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNodeHead01<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNodeHead02<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNodeHead03<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNodeHead04<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead01<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead02<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead03<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead04<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead05<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead06<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead07<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead08<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead09<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead10<srt::CSndLossSet>]==] [==[CSndLossListTest.BasicRemoveInListNotInNodeHead11<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertRemoveInsert01<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertHead01<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertHead02<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertHeadIncrease01<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertHeadOverlap01<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertHeadOverlap02<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertHeadNegativeOffset01<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertHeadNegativeOffset02<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertFullListCoalesce<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertFullListNoCoalesce<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertFullListNegativeOffset<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertPositiveOffsetTooFar<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertNoUpdateElement01<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertNoUpdateElement03<srt::CSndLossSet>]==] [==[CSndLossListTest.InsertUpdateElement01<srt::CSndLossSet>]==] CSndLossSetTest.RemoveRange CSndLossSetTest.GetNextLostSeq CSndLossListBench.ScatteredLoss TestConnection.Multiple TestMuxer.IPv4_and_IPv6 CSeqNo.constants CSeqNo.seqcmp CSeqNo.seqoff CSeqNo.seqlen CSeqNo.incseq CSeqNo.decseq CSeqNo.incseqint CSeqNo.decseqint CUDT.getFlightSpan TestSocketOptions.DefaultVals TestSocketOptions.MaxVals TestSocketOptions.MinVals TestSocketOptions.InvalidVals TestSocketOptions.RestrictionBind TestSocketOptions.RestrictionListening TestSocketOptions.RestrictionConnected TestSocketOptions.TLPktDropInherits TestSocketOptions.Latency TestSocketOptions.LossMaxTTL TestSocketOptions.MinInputBWWrongLen TestSocketOptions.MinInputBWDefault TestSocketOptions.MinInputBWSet TestSocketOptions.MinInputBWRuntime TestSocketOptions.StreamIDWrongLen TestSocketOptions.StringOptLenInvalid TestSocketOptions.StreamIDOdd TestSocketOptions.StreamIDEven TestSocketOptions.StreamIDAlmostFull TestSocketOptions.StreamIDFull TestSocketOptions.StreamIDLenListener SyncDuration.BasicChecks SyncDuration.DurationFrom SyncDuration.RelOperators SyncDuration.OperatorMinus SyncDuration.OperatorMinusEq SyncDuration.OperatorPlus SyncDuration.OperatorPlusEq SyncDuration.OperatorMultInt SyncDuration.OperatorMultIntEq SyncRandom.GenRandomInt SyncTimePoint.DefaultConstructorZero SyncTimePoint.RelOperators SyncTimePoint.OperatorMinus SyncTimePoint.OperatorEq SyncTimePoint.OperatorMinusPlusDuration SyncTimePoint.OperatorPlusEqDuration SyncTimePoint.OperatorMinusEqDuration SyncUniqueLock.LockUnlock SyncUniqueLock.Scope SyncEvent.WaitFor SyncEvent.WaitForNotifyOne SyncEvent.WaitNotifyOne SyncEvent.WaitForTwoNotifyOne SyncEvent.WaitForTwoNotifyAll SyncEvent.WaitForNotifyAll SyncThread.Joinable Sync.FormatTime Sync.FormatTimeSys ThreadName.GetSet ThreadName.AutoReset CTimer.SleeptoAccuracy CTimer.PacingStats CUnitQueue.Increase CUnitQueue.IncreaseAndFree CUnitQueue.IncreaseAndFreeGrouped CircularBuffer.Overall CircularBitmap.FindWithWrap CircularBitmap.SetRange ConfigString.Setting ReuseAddr.SameAddr1 ReuseAddr.SameAddr2 ReuseAddr.SameAddrV6 ReuseAddr.DiffAddr ReuseAddr.UDPOptions ReuseAddr.Wildcard ReuseAddr.Wildcard6 ReuseAddr.ProtocolVersion6 ReuseAddr.ProtocolVersionFaux6 SendMsgZeroCopy.LiveTransmission RecvMsgZeroCopy.LiveTransmission SendMMsg.LiveTransmission RecvMMsg.LiveTransmission SocketData.PeerName CongestionControl.LEDBATBaseDelay CongestionControl.LEDBATWindow CongestionControl.CUBICWindowGrowth CongestionControl.CUBICRenoFriendly CongestionControl.CUBICFastConvergence CongestionControl.CUBICLossEvent CongestionControl.FileOverLossyLink CongestionControl.BBROverLossyLink CongestionControl.CUBICOverLossyLink CongestionControl.LEDBATOverLossyLink CongestionControl.UserDefined CSndShaper.AggregateRate CSndShaper.Weights CSndShaper.Guarantee CSndShaper.UnusedShare TestSndScheduler.DeficitRoundRobin TestSndScheduler.DeficitSmallPackets TestSndScheduler.TimeOrder)
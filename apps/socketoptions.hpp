@@ -259,6 +259,13 @@ const SocketOption srt_options [] {
     { "bindtodevice", 0, SRTO_BINDTODEVICE, SocketOption::PRE, SocketOption::STRING, nullptr},
 #endif
     { "retransmitalgo", 0, SRTO_RETRANSMITALGO, SocketOption::PRE, SocketOption::INT, nullptr }
+    ,{ "sndmemlimit", 0, SRTO_SNDMEMLIMIT, SocketOption::PRE, SocketOption::INT64, nullptr }
+    ,{ "rcvmemlimit", 0, SRTO_RCVMEMLIMIT, SocketOption::PRE, SocketOption::INT64, nullptr }
+    ,{ "pacing", 0, SRTO_PACING, SocketOption::PRE, SocketOption::INT, nullptr }
+    ,{ "muxmaxbw", 0, SRTO_MUXMAXBW, SocketOption::PRE, SocketOption::INT64, nullptr }
+    ,{ "sndminbw", 0, SRTO_SNDMINBW, SocketOption::PRE, SocketOption::INT64, nullptr }
+    ,{ "sndweight", 0, SRTO_SNDWEIGHT, SocketOption::PRE, SocketOption::INT, nullptr }
+    ,{ "scheduler", 0, SRTO_SCHEDULER, SocketOption::PRE, SocketOption::INT, nullptr }
 #ifdef ENABLE_AEAD_API_PREVIEW
     ,{ "cryptomode", 0, SRTO_CRYPTOMODE, SocketOption::PRE, SocketOption::INT, nullptr }
 #endif
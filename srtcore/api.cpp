@@ -57,6 +57,7 @@ modified by
 #include <typeinfo>
 #include <iterator>
 #include <vector>
+#include <limits>
 
 #include <cstring>
 #include "utilities.h"
@@ -311,6 +312,7 @@ void srt::CUDTUnited::cleanupAllSockets()
         delete(s);
     }
     m_Sockets.clear();
+    m_SocketIndex.resetAtFork();
 
 #if ENABLE_BONDING
     for (groups_t::iterator j = m_Groups.begin(); j != m_Groups.end(); ++j)
@@ -377,6 +379,7 @@ void srt::CUDTUnited::closeAllSockets()
             leaveCS(ls->second->m_AcceptLock);
         }
         m_Sockets.clear();
+        m_SocketIndex.clear();
 
         for (sockets_t::iterator j = m_ClosedSockets.begin(); j != m_ClosedSockets.end(); ++j)
         {
@@ -595,7 +598,7 @@ SRTSOCKET srt::CUDTUnited::newSocket(CUDTSocket** pps)
 
         // protect the m_Sockets structure.
         ExclusiveLock cs(m_GlobControlLock);
-        m_Sockets[ns->m_SocketID] = ns;
+        mapSocket_LOCKED(ns);
     }
     catch (...)
     {
@@ -758,7 +761,7 @@ int srt::CUDTUnited::newConnection(const SRTSOCKET     listen,
                 "newConnection: incoming " << peer.str() << ", mapping socket " << ns->m_SocketID);
         {
             ExclusiveLock cg(m_GlobControlLock);
-            m_Sockets[ns->m_SocketID] = ns;
+            mapSocket_LOCKED(ns);
         }
 
         if (ls->core().m_cbAcceptHook)
@@ -991,7 +994,7 @@ ERR_ROLLBACK:
                 ns->removeFromGroup(true);
             }
 #endif
-            m_Sockets.erase(id);
+            unmapSocket_LOCKED(id);
             m_ClosedSockets[id] = ns;
         }
 
@@ -1052,6 +1055,31 @@ int srt::CUDTUnited::installConnectHook(const SRTSOCKET u, srt_connect_callback_
     return 0;
 }
 
+int srt::CUDT::installSendCompleteHook(SRTSOCKET u, srt_send_complete_callback_fn* hook, void* opaq)
+{
+    return uglobal().installSendCompleteHook(u, hook, opaq);
+}
+
+int srt::CUDTUnited::installSendCompleteHook(const SRTSOCKET u, srt_send_complete_callback_fn* hook, void* opaq)
+{
+    try
+    {
+        // Zero-copy sending is not supported for groups.
+        if (u & SRTGROUP_MASK)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        CUDTSocket* s = locateSocket(u, ERH_THROW);
+        s->core().installSendCompleteHook(hook, opaq);
+    }
+    catch (CUDTException& e)
+    {
+        SetThreadLocalError(e);
+        return SRT_ERROR;
+    }
+
+    return 0;
+}
+
 SRT_SOCKSTATUS srt::CUDTUnited::getStatus(const SRTSOCKET u)
 {
     // protects the m_Sockets structure
@@ -1659,8 +1687,9 @@ int srt::CUDTUnited::groupConnect(CUDTGroup* pg, SRT_SOCKGROUPCONFIG* targets, i
             else
             {
                 targets[tii].id = CUDT::INVALID_SOCK;
+                unmapSocket_LOCKED(sid);
+                m_SocketIndex.synchronize();
                 delete ns;
-                m_Sockets.erase(sid);
 
                 // If failed to set options, then do not continue
                 // neither with binding, nor with connecting.
@@ -1724,7 +1753,8 @@ int srt::CUDTUnited::groupConnect(CUDTGroup* pg, SRT_SOCKGROUPCONFIG* targets, i
 
             ExclusiveLock cl(m_GlobControlLock);
             ns->removeFromGroup(false);
-            m_Sockets.erase(ns->m_SocketID);
+            unmapSocket_LOCKED(ns->m_SocketID);
+            m_SocketIndex.synchronize();
             // Intercept to delete the socket on failure.
             delete ns;
             continue;
@@ -1736,7 +1766,8 @@ int srt::CUDTUnited::groupConnect(CUDTGroup* pg, SRT_SOCKGROUPCONFIG* targets, i
             targets[tii].id        = CUDT::INVALID_SOCK;
             ExclusiveLock cl(m_GlobControlLock);
             ns->removeFromGroup(false);
-            m_Sockets.erase(ns->m_SocketID);
+            unmapSocket_LOCKED(ns->m_SocketID);
+            m_SocketIndex.synchronize();
             // Intercept to delete the socket on failure.
             delete ns;
 
@@ -2236,7 +2267,7 @@ int srt::CUDTUnited::close(CUDTSocket* s)
         }
 #endif
 
-        m_Sockets.erase(s->m_SocketID);
+        unmapSocket_LOCKED(s->m_SocketID);
         m_ClosedSockets[s->m_SocketID] = s;
         HLOGC(smlog.Debug, log << "@" << u << "U::close: Socket MOVED TO CLOSED for collecting later.");
 
@@ -2680,7 +2711,7 @@ int srt::CUDTUnited::epoll_release(const int eid)
 
 srt::CUDTSocket* srt::CUDTUnited::locateSocket(const SRTSOCKET u, ErrorHandling erh)
 {
-    SharedLock cg(m_GlobControlLock);
+    CIdTable<CUDTSocket>::ReadGuard rg(m_SocketIndex);
     CUDTSocket* s = locateSocket_LOCKED(u);
     if (!s)
     {
@@ -2693,16 +2724,17 @@ srt::CUDTSocket* srt::CUDTUnited::locateSocket(const SRTSOCKET u, ErrorHandling
 }
 
 // [[using locked(m_GlobControlLock)]];
+// or with a read guard on m_SocketIndex.
 srt::CUDTSocket* srt::CUDTUnited::locateSocket_LOCKED(SRTSOCKET u)
 {
-    sockets_t::iterator i = m_Sockets.find(u);
+    CUDTSocket* s = m_SocketIndex.find(u);
 
-    if ((i == m_Sockets.end()) || (i->second->m_Status == SRTS_CLOSED))
+    if (!s || s->m_Status == SRTS_CLOSED)
     {
         return NULL;
     }
 
-    return i->second;
+    return s;
 }
 
 #if ENABLE_BONDING
@@ -2739,7 +2771,10 @@ srt::CUDTGroup* srt::CUDTUnited::acquireSocketsGroup(CUDTSocket* s)
 
 srt::CUDTSocket* srt::CUDTUnited::locateAcquireSocket(SRTSOCKET u, ErrorHandling erh)
 {
-    SharedLock cg(m_GlobControlLock);
+    // The socket can't be deleted before the guard is released:
+    // removeSocket() waits for it after the socket was unmapped,
+    // and then it finds the busy flag set.
+    CIdTable<CUDTSocket>::ReadGuard rg(m_SocketIndex);
 
     CUDTSocket* s = locateSocket_LOCKED(u);
     if (!s)
@@ -2952,7 +2987,7 @@ void srt::CUDTUnited::checkBrokenSockets()
 
     // move closed sockets to the ClosedSockets structure
     for (vector<SRTSOCKET>::iterator k = tbc.begin(); k != tbc.end(); ++k)
-        m_Sockets.erase(*k);
+        unmapSocket_LOCKED(*k);
 
     // remove those timeout sockets
     for (vector<SRTSOCKET>::iterator l = tbr.begin(); l != tbr.end(); ++l)
@@ -2984,6 +3019,11 @@ void srt::CUDTUnited::removeSocket(const SRTSOCKET u)
     if (rn && rn->m_bOnList)
         return;
 
+    // Lookups through m_SocketIndex don't lock m_GlobControlLock, so make
+    // sure none of them is still in progress with this socket found before
+    // it was unmapped; such a lookup could still make it busy.
+    m_SocketIndex.synchronize();
+
     if (s->isStillBusy())
     {
         HLOGC(smlog.Debug, log << "@" << s->m_SocketID << " is still busy, NOT deleting");
@@ -3025,7 +3065,7 @@ void srt::CUDTUnited::removeSocket(const SRTSOCKET u)
 
             as->breakSocket_LOCKED();
             m_ClosedSockets[q->first] = as;
-            m_Sockets.erase(q->first);
+            unmapSocket_LOCKED(q->first);
         }
     }
 
@@ -3434,10 +3474,15 @@ void srt::CUDTUnited::updateMux(CUDTSocket* s, const sockaddr_any& reqaddr, cons
         }
 
         m.m_pTimer    = new CTimer;
+        m.m_pTimer->setPacing(m.m_mcfg.iPacing);
         m.m_pSndQueue = new CSndQueue;
         m.m_pSndQueue->init(m.m_pChannel, m.m_pTimer);
+        m.m_pSndQueue->m_BlockPool.setLimit(m.m_mcfg.llSndMemLimit);
+        m.m_pSndQueue->m_Shaper.setRate(m.m_mcfg.llMuxMaxBW);
+        m.m_pSndQueue->m_pSndUList->setScheduler(m.m_mcfg.iScheduler);
         m.m_pRcvQueue = new CRcvQueue;
         m.m_pRcvQueue->init(128, s->core().maxPayloadSize(), m.m_iIPversion, 1024, m.m_pChannel, m.m_pTimer);
+        m.m_pRcvQueue->m_pUnitQueue->setMemoryLimit(m.m_mcfg.llRcvMemLimit);
 
         // Rewrite the port here, as it might be only known upon return
         // from CChannel::open.
@@ -4098,6 +4143,96 @@ int srt::CUDT::sendmsg2(SRTSOCKET u, const char* buf, int len, SRT_MSGCTRL& w_m)
     }
 }
 
+int srt::CUDT::sendmsgv(SRTSOCKET u, const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL& w_m)
+{
+    try
+    {
+#if ENABLE_BONDING
+        if (u & SRTGROUP_MASK)
+        {
+            if (iovcnt <= 0 || !iov)
+                throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+            // The group keeps its own copy of every message for backup
+            // sending anyway, so it gets the message joined.
+            std::vector<char> buf;
+            for (int i = 0; i < iovcnt; ++i)
+                buf.insert(buf.end(), static_cast<const char*>(iov[i].iov_base),
+                           static_cast<const char*>(iov[i].iov_base) + iov[i].iov_len);
+
+            CUDTUnited::GroupKeeper k(uglobal(), u, CUDTUnited::ERH_THROW);
+            return k.group->send(buf.empty() ? NULL : &buf[0], int(buf.size()), (w_m));
+        }
+#endif
+
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().sendmsgv(iov, iovcnt, (w_m));
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (bad_alloc&)
+    {
+        return APIError(MJ_SYSTEMRES, MN_MEMORY, 0);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "sendmsgv: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
+int srt::CUDT::sendmsg_zc(SRTSOCKET u, const char* buf, int len, SRT_MSGCTRL& w_m)
+{
+    try
+    {
+        // Groups keep their own copy of the message for backup sending,
+        // so there's nothing to gain there.
+        if (u & SRTGROUP_MASK)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().sendmsg_zc(buf, len, (w_m));
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (bad_alloc&)
+    {
+        return APIError(MJ_SYSTEMRES, MN_MEMORY, 0);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "sendmsg_zc: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
+int srt::CUDT::sendmmsg(SRTSOCKET u, SRT_MSGVEC* msgs, int n)
+{
+    try
+    {
+        // Group sending distributes every message separately.
+        if (u & SRTGROUP_MASK)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().sendmmsg(msgs, n);
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (bad_alloc&)
+    {
+        return APIError(MJ_SYSTEMRES, MN_MEMORY, 0);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "sendmmsg: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
 int srt::CUDT::recv(SRTSOCKET u, char* buf, int len, int)
 {
     SRT_MSGCTRL mctrl = srt_msgctrl_default;
@@ -4138,6 +4273,117 @@ int srt::CUDT::recvmsg2(SRTSOCKET u, char* buf, int len, SRT_MSGCTRL& w_m)
     }
 }
 
+int srt::CUDT::recvmsgv(SRTSOCKET u, const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL& w_m)
+{
+    try
+    {
+#if ENABLE_BONDING
+        if (u & SRTGROUP_MASK)
+        {
+            if (iovcnt <= 0 || !iov)
+                throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+            // The group delivers the message from its own buffer,
+            // so it's read at once and scattered afterwards.
+            size_t total = 0;
+            for (int i = 0; i < iovcnt; ++i)
+                total += iov[i].iov_len;
+            if (total == 0)
+                throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+            if (total > size_t(std::numeric_limits<int>::max()))
+                total = size_t(std::numeric_limits<int>::max());
+
+            std::vector<char> buf(total);
+            CUDTUnited::GroupKeeper k(uglobal(), u, CUDTUnited::ERH_THROW);
+            const int res = k.group->recv(&buf[0], int(total), (w_m));
+            size_t off = 0;
+            for (int i = 0; i < iovcnt && off < size_t(res); ++i)
+            {
+                const size_t n = std::min(iov[i].iov_len, size_t(res) - off);
+                memcpy(iov[i].iov_base, &buf[off], n);
+                off += n;
+            }
+            return res;
+        }
+#endif
+
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().recvmsgv(iov, iovcnt, (w_m));
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (bad_alloc&)
+    {
+        return APIError(MJ_SYSTEMRES, MN_MEMORY, 0);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "recvmsgv: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
+int srt::CUDT::recvmsg_zc(SRTSOCKET u, SRT_PKTVIEW* views, int nviews, SRT_MSGCTRL& w_m)
+{
+    try
+    {
+        if (u & SRTGROUP_MASK)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().recvmsg_zc(views, nviews, (w_m));
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "recvmsg_zc: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
+int srt::CUDT::recvmsg_zc_release(SRTSOCKET u, const SRT_PKTVIEW* views, int nviews)
+{
+    try
+    {
+        if (u & SRTGROUP_MASK)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().releaseRecvViews(views, nviews);
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "recvmsg_zc_release: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
+int srt::CUDT::recvmmsg(SRTSOCKET u, SRT_MSGVEC* msgs, int n, int msTimeOut)
+{
+    try
+    {
+        if (u & SRTGROUP_MASK)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().recvmmsg(msgs, n, msTimeOut);
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "recvmmsg: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
 int64_t srt::CUDT::sendfile(SRTSOCKET u, fstream& ifs, int64_t& offset, int64_t size, int block)
 {
     try
@@ -4177,6 +4423,48 @@ int64_t srt::CUDT::recvfile(SRTSOCKET u, fstream& ofs, int64_t& offset, int64_t
     }
 }
 
+int64_t srt::CUDT::sendfile(SRTSOCKET u, int fd, int64_t& offset, int64_t size, int block)
+{
+    try
+    {
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().sendfile(fd, offset, size, block);
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (bad_alloc&)
+    {
+        return APIError(MJ_SYSTEMRES, MN_MEMORY, 0);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "sendfile: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
+int64_t srt::CUDT::recvfile(SRTSOCKET u, int fd, int64_t& offset, int64_t size, int block)
+{
+    try
+    {
+        return uglobal().locateSocket(u, CUDTUnited::ERH_THROW)->core().recvfile(fd, offset, size, block);
+    }
+    catch (const CUDTException& e)
+    {
+        return APIError(e);
+    }
+    catch (bad_alloc&)
+    {
+        return APIError(MJ_SYSTEMRES, MN_MEMORY, 0);
+    }
+    catch (const std::exception& ee)
+    {
+        LOGC(aclog.Fatal, log << "recvfile: UNEXPECTED EXCEPTION: " << typeid(ee).name() << ": " << ee.what());
+        return APIError(MJ_UNKNOWN, MN_NONE, 0);
+    }
+}
+
 int srt::CUDT::select(int, UDT::UDSET* readfds, UDT::UDSET* writefds, UDT::UDSET* exceptfds, const timeval* timeout)
 {
     if ((!readfds) && (!writefds) && (!exceptfds))
@@ -64,6 +64,7 @@ modified by
 #include "epoll.h"
 #include "handshake.h"
 #include "core.h"
+#include "idtable.h"
 #if ENABLE_BONDING
 #include "group.h"
 #endif
@@ -295,6 +296,7 @@ public:
 
     int installAcceptHook(const SRTSOCKET lsn, srt_listen_callback_fn* hook, void* opaq);
     int installConnectHook(const SRTSOCKET lsn, srt_connect_callback_fn* hook, void* opaq);
+    int installSendCompleteHook(const SRTSOCKET u, srt_send_complete_callback_fn* hook, void* opaq);
 
     /// Check the status of the UDT socket.
     /// @param [in] u the UDT socket ID.
@@ -408,6 +410,24 @@ private:
     SRT_ATTR_GUARDED_BY(m_GlobControlLock)
     sockets_t m_Sockets;
 
+    // Lock-free lookup index mirroring m_Sockets. Modified only together
+    // with m_Sockets (under exclusive m_GlobControlLock), read without lock.
+    CIdTable<CUDTSocket> m_SocketIndex;
+
+    // [[using locked(m_GlobControlLock)]]
+    void mapSocket_LOCKED(CUDTSocket* s)
+    {
+        m_Sockets[s->m_SocketID] = s;
+        m_SocketIndex.insert(s->m_SocketID, s);
+    }
+
+    // [[using locked(m_GlobControlLock)]]
+    void unmapSocket_LOCKED(SRTSOCKET id)
+    {
+        m_Sockets.erase(id);
+        m_SocketIndex.erase(id);
+    }
+
 #if ENABLE_BONDING
     typedef std::map<SRTSOCKET, CUDTGroup*> groups_t;
     SRT_ATTR_GUARDED_BY(m_GlobControlLock)
@@ -428,6 +448,8 @@ private:
 private:
     friend struct FLookupSocketWithEvent_LOCKED;
 
+    // Note: locateSocket and locateAcquireSocket don't lock m_GlobControlLock;
+    // they use the lock-free m_SocketIndex instead.
     CUDTSocket* locateSocket(SRTSOCKET u, ErrorHandling erh = ERH_RETURN);
     // This function does the same as locateSocket, except that:
     // - lock on m_GlobControlLock is expected (so that you don't unlock between finding and using)
@@ -507,6 +529,14 @@ public:
             return caught;
         }
 
+        // Take over a socket that has been already acquired by the caller
+        // (e.g. by CSndUList::pop()). It will be released in the destructor.
+        void adopt(CUDTSocket* s)
+        {
+            SRT_ASSERT(s->isStillBusy() > 0);
+            socket = s;
+        }
+
         ~SocketKeeper()
         {
             if (socket)
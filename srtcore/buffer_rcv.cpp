@@ -43,10 +43,16 @@ NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
 SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 *****************************************************************************/
 
+#include <cerrno>
 #include <cmath>
 #include <limits>
+#include <vector>
+#ifdef _WIN32
+#include <io.h> // _write, _lseeki64
+#endif
 #include "buffer_rcv.h"
 #include "logging.h"
+#include "srt_compat.h"
 
 using namespace std;
 
@@ -116,7 +122,12 @@ namespace {
  */
 
 CRcvBuffer::CRcvBuffer(int initSeqNo, size_t size, CUnitQueue* unitqueue, bool bMessageAPI)
-    : m_entries(size)
+    : m_entries(size, ENTRIES_CHUNK_SIZE)
+    , m_bmAvail(size)
+    , m_bmMsgFirst(size)
+    , m_bmMsgLast(size)
+    , m_bmOutOfOrder(size)
+    , m_bmDropped(size)
     , m_szSize(size) // TODO: maybe just use m_entries.size()
     , m_pUnitQueue(unitqueue)
     , m_iStartSeqNo(initSeqNo)
@@ -131,20 +142,69 @@ CRcvBuffer::CRcvBuffer(int initSeqNo, size_t size, CUnitQueue* unitqueue, bool b
     , m_iBytesCount(0)
     , m_iPktsCount(0)
     , m_uAvgPayloadSz(0)
+    , m_iUnitsHeld(0)
 {
     SRT_ASSERT(size < size_t(std::numeric_limits<int>::max())); // All position pointers are integers
+    m_pUnitQueue->addUser();
 }
 
 CRcvBuffer::~CRcvBuffer()
 {
-    // Can be optimized by only iterating m_iMaxPosOff from m_iStartPos.
-    for (FixedArray<Entry>::iterator it = m_entries.begin(); it != m_entries.end(); ++it)
+    for (int i = 0, pos = m_iStartPos; i < m_iMaxPosOff; ++i, pos = incPos(pos))
     {
-        if (!it->pUnit)
+        if (!m_bmAvail.test(pos))
             continue;
-        
-        m_pUnitQueue->makeUnitFree(it->pUnit);
-        it->pUnit = NULL;
+
+        freeUnit(m_entries[pos].pUnit);
+        m_entries[pos].pUnit = NULL;
+    }
+
+    for (std::deque<CUnit*>::iterator it = m_HeldUnits.begin(); it != m_HeldUnits.end(); ++it)
+        freeUnit(*it);
+
+    m_pUnitQueue->removeUser();
+}
+
+void CRcvBuffer::takeUnit(CUnit* unit)
+{
+    m_pUnitQueue->makeUnitTaken(unit);
+    ++m_iUnitsHeld;
+}
+
+void CRcvBuffer::freeUnit(CUnit* unit)
+{
+    m_pUnitQueue->makeUnitFree(unit);
+    --m_iUnitsHeld;
+}
+
+int CRcvBuffer::getMemShare() const
+{
+    return m_pUnitQueue->maxUnits() == 0 ? 0 : m_pUnitQueue->fairShare();
+}
+
+int CRcvBuffer::getMemShareLeft() const
+{
+    if (!m_pUnitQueue->underPressure())
+        return std::numeric_limits<int>::max();
+
+    return std::max(0, m_pUnitQueue->fairShare() - m_iUnitsHeld.load());
+}
+
+size_t CRcvBuffer::getMemoryUsage() const
+{
+    return m_entries.capacity() * sizeof(Entry) + m_bmAvail.memsize() + m_bmMsgFirst.memsize()
+        + m_bmMsgLast.memsize() + m_bmOutOfOrder.memsize()
+        + m_bmDropped.memsize();
+}
+
+void CRcvBuffer::releaseIdleStorage()
+{
+    // All entries outside the range in use are in the empty state.
+    const size_t nfreed = m_entries.releaseIdle(m_iStartPos, m_iMaxPosOff);
+    if (nfreed > 0)
+    {
+        HLOGC(rbuflog.Debug, log << "CRcvBuffer: released " << nfreed << " idle chunks, "
+            << m_entries.capacity() << " of " << m_szSize << " entries remain allocated");
     }
 }
 
@@ -181,21 +241,23 @@ int CRcvBuffer::insert(CUnit* unit)
 
     // Packet already exists
     SRT_ASSERT(pos >= 0 && pos < int(m_szSize));
-    if (m_entries[pos].status != EntryState_Empty)
+    if (statusAt(pos) != EntryState_Empty)
     {
         IF_RCVBUF_DEBUG(scoped_log.ss << " returns -1");
         return -1;
     }
     SRT_ASSERT(m_entries[pos].pUnit == NULL);
 
-    m_pUnitQueue->makeUnitTaken(unit);
+    takeUnit(unit);
     m_entries[pos].pUnit  = unit;
     m_entries[pos].status = EntryState_Avail;
     countBytes(1, (int)unit->m_Packet.getLength());
 
     // If packet "in order" flag is zero, it can be read out of order.
     // With TSBPD enabled packets are always assumed in order (the flag is ignored).
-    if (!m_tsbpd.isEnabled() && m_bMessageAPI && !unit->m_Packet.getMsgOrderFlag())
+    const bool outOfOrder = !m_tsbpd.isEnabled() && m_bMessageAPI && !unit->m_Packet.getMsgOrderFlag();
+    markUnitInPos(pos, outOfOrder);
+    if (outOfOrder)
     {
         ++m_numOutOfOrderPackets;
         onInsertNotInOrderPacket(pos);
@@ -228,13 +290,18 @@ std::pair<int, int> CRcvBuffer::dropUpTo(int32_t seqno)
     {
         // Note! Dropping a EntryState_Read must not be counted as a drop because it was read.
         // Note! Dropping a EntryState_Drop must not be counted as a drop because it was already dropped and counted earlier.
-        if (m_entries[m_iStartPos].status == EntryState_Avail)
+        // Empty entries are not touched, so that no storage gets allocated for them.
+        const EntryStatus status = statusAt(m_iStartPos);
+        if (status == EntryState_Avail)
 			++iNumDiscarded;
-        else if (m_entries[m_iStartPos].status == EntryState_Empty)
+        else if (status == EntryState_Empty)
 			++iNumDropped;
-        dropUnitInPos(m_iStartPos);
-        m_entries[m_iStartPos].status = EntryState_Empty;
-        SRT_ASSERT(m_entries[m_iStartPos].pUnit == NULL && m_entries[m_iStartPos].status == EntryState_Empty);
+        if (status != EntryState_Empty)
+        {
+            dropUnitInPos(m_iStartPos);
+            releaseUnitInPos(m_iStartPos);
+        }
+        SRT_ASSERT(!m_bmAvail.test(m_iStartPos) && statusAt(m_iStartPos) == EntryState_Empty);
         m_iStartPos = incPos(m_iStartPos);
         --len;
     }
@@ -294,10 +361,10 @@ int CRcvBuffer::dropMessage(int32_t seqnolo, int32_t seqnohi, int32_t msgno, Dro
     for (int i = start_pos; i != end_pos; i = incPos(i))
     {
         // Check if the unit was already dropped earlier.
-        if (m_entries[i].status == EntryState_Drop)
+        if (statusAt(i) == EntryState_Drop)
             continue;
 
-        if (m_entries[i].pUnit)
+        if (m_bmAvail.test(i))
         {
             const PacketBoundary bnd = packetAt(i).getMsgBoundary();
 
@@ -325,9 +392,8 @@ int CRcvBuffer::dropMessage(int32_t seqnolo, int32_t seqnohi, int32_t msgno, Dro
             }
         }
 
-        dropUnitInPos(i);
+        markDroppedInPos(i);
         ++iDropCnt;
-        m_entries[i].status = EntryState_Drop;
         if (minDroppedOffset == -1)
             minDroppedOffset = offPos(m_iStartPos, i);
     }
@@ -343,7 +409,7 @@ int CRcvBuffer::dropMessage(int32_t seqnolo, int32_t seqnohi, int32_t msgno, Dro
         for (int i = start_pos; i != stop_pos; i = decPos(i))
         {
             // Can't drop if message number is not known.
-            if (!m_entries[i].pUnit) // also dropped earlier.
+            if (!m_bmAvail.test(i)) // also dropped earlier.
                 continue;
 
             const PacketBoundary bnd = packetAt(i).getMsgBoundary();
@@ -360,8 +426,7 @@ int CRcvBuffer::dropMessage(int32_t seqnolo, int32_t seqnohi, int32_t msgno, Dro
             }
 
             ++iDropCnt;
-            dropUnitInPos(i);
-            m_entries[i].status = EntryState_Drop;
+            markDroppedInPos(i);
             // As the search goes backward, i is always earlier than minDroppedOffset.
             minDroppedOffset = offPos(m_iStartPos, i);
 
@@ -391,6 +456,64 @@ int CRcvBuffer::dropMessage(int32_t seqnolo, int32_t seqnohi, int32_t msgno, Dro
 }
 
 int CRcvBuffer::readMessage(char* data, size_t len, SRT_MSGCTRL* msgctrl)
+{
+    SRT_IOVEC iov;
+    iov.iov_base = data;
+    iov.iov_len  = len;
+    return readMessageTo(&iov, 1, NULL, msgctrl);
+}
+
+int CRcvBuffer::readMessagev(const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL* msgctrl)
+{
+    return readMessageTo(iov, iovcnt, NULL, msgctrl);
+}
+
+int CRcvBuffer::readMessageViews(SRT_PKTVIEW* w_views, int nviews, SRT_MSGCTRL* msgctrl)
+{
+    const bool canReadInOrder = hasReadableInorderPkts();
+    if (!canReadInOrder && m_iFirstReadableOutOfOrder < 0)
+        return 0;
+
+    // Check the size first so that the message stays in the buffer if it doesn't fit.
+    int npkts = 0;
+    for (int i = canReadInOrder ? m_iStartPos : m_iFirstReadableOutOfOrder; m_bmAvail.test(i); i = incPos(i))
+    {
+        ++npkts;
+        if (packetAt(i).getMsgBoundary() & PB_LAST)
+            break;
+    }
+
+    if (npkts > nviews)
+    {
+        LOGC(rbuflog.Error, log << "readMessageViews: message has " << npkts << " packets, only " << nviews << " views given.");
+        return -1;
+    }
+
+    return readMessageTo(NULL, 0, w_views, msgctrl);
+}
+
+int CRcvBuffer::releaseViews(const SRT_PKTVIEW* views, int nviews)
+{
+    int released = 0;
+    for (int v = 0; v < nviews; ++v)
+    {
+        // The views are normally released in the order of reading,
+        // so the unit is found at the beginning.
+        for (std::deque<CUnit*>::iterator i = m_HeldUnits.begin(); i != m_HeldUnits.end(); ++i)
+        {
+            if ((*i)->m_Packet.m_pcData != views[v].data)
+                continue;
+
+            freeUnit(*i);
+            m_HeldUnits.erase(i);
+            ++released;
+            break;
+        }
+    }
+    return released;
+}
+
+int CRcvBuffer::readMessageTo(const SRT_IOVEC* iov, int iovcnt, SRT_PKTVIEW* w_views, SRT_MSGCTRL* msgctrl)
 {
     const bool canReadInOrder = hasReadableInorderPkts();
     if (!canReadInOrder && m_iFirstReadableOutOfOrder < 0)
@@ -404,8 +527,9 @@ int CRcvBuffer::readMessage(char* data, size_t len, SRT_MSGCTRL* msgctrl)
     IF_RCVBUF_DEBUG(ScopedLog scoped_log);
     IF_RCVBUF_DEBUG(scoped_log.ss << "CRcvBuffer::readMessage. m_iStartSeqNo " << m_iStartSeqNo << " m_iStartPos " << m_iStartPos << " readPos " << readPos);
 
-    size_t remain = len;
-    char* dst = data;
+    int    seg = 0;      // The current user buffer and the position in it.
+    size_t segoff = 0;
+    int    bytes_read = 0;
     int    pkts_read = 0;
     int    bytes_extracted = 0; // The total number of bytes extracted from the buffer.
     const bool updateStartPos = (readPos == m_iStartPos); // Indicates if the m_iStartPos can be changed
@@ -422,11 +546,30 @@ int CRcvBuffer::readMessage(char* data, size_t len, SRT_MSGCTRL* msgctrl)
         const size_t   pktsize = packet.getLength();
         const int32_t pktseqno = packet.getSeqNo();
 
-        // unitsize can be zero
-        const size_t unitsize = std::min(remain, pktsize);
-        memcpy(dst, packet.m_pcData, unitsize);
-        remain -= unitsize;
-        dst += unitsize;
+        if (w_views)
+        {
+            // Hand out the unit instead of copying; it's freed in releaseViews.
+            w_views[pkts_read].data = packet.m_pcData;
+            w_views[pkts_read].len  = (int) pktsize;
+            m_HeldUnits.push_back(m_entries[i].pUnit);
+        }
+        else
+        {
+            for (size_t pktoff = 0; pktoff < pktsize && seg < iovcnt;)
+            {
+                // unitsize can be zero
+                const size_t unitsize = std::min(pktsize - pktoff, iov[seg].iov_len - segoff);
+                memcpy(static_cast<char*>(iov[seg].iov_base) + segoff, packet.m_pcData + pktoff, unitsize);
+                pktoff += unitsize;
+                segoff += unitsize;
+                bytes_read += (int) unitsize;
+                if (segoff == iov[seg].iov_len)
+                {
+                    ++seg;
+                    segoff = 0;
+                }
+            }
+        }
 
         ++pkts_read;
         bytes_extracted += (int) pktsize;
@@ -449,6 +592,8 @@ int CRcvBuffer::readMessage(char* data, size_t len, SRT_MSGCTRL* msgctrl)
         if (msgctrl)
             msgctrl->pktseq = pktseqno;
 
+        if (w_views)
+            m_entries[i].pUnit = NULL; // held, not to be freed
         releaseUnitInPos(i);
         if (updateStartPos)
         {
@@ -486,13 +631,15 @@ int CRcvBuffer::readMessage(char* data, size_t len, SRT_MSGCTRL* msgctrl)
         // in case readable inorder packets are all read out.
         updateFirstReadableOutOfOrder();
 
-    const int bytes_read = int(dst - data);
+    if (w_views)
+        return pkts_read;
+
     if (bytes_read < bytes_extracted)
     {
         LOGC(rbuflog.Error, log << "readMessage: small dst buffer, copied only " << bytes_read << "/" << bytes_extracted << " bytes.");
     }
 
-    IF_RCVBUF_DEBUG(scoped_log.ss << " pldi64 " << *reinterpret_cast<uint64_t*>(data));
+    IF_RCVBUF_DEBUG(scoped_log.ss << " pldi64 " << *reinterpret_cast<uint64_t*>(iov[0].iov_base));
 
     return bytes_read;
 }
@@ -523,6 +670,49 @@ namespace {
         memcpy(dst, data, len);
         return true;
     }
+
+    /// @brief Accepts the bytes without copying them (already written out).
+    bool skipBytes(char*, int, int, void*) { return true; }
+
+    /// @brief Writes the chunks of data to the file at given position
+    /// in one call (pwritev) where available.
+    /// @return the number of bytes written, -1 on failure.
+    int64_t writeChunksAt(int fd, const std::vector<std::pair<char*, int> >& chunks, int64_t offset)
+    {
+#if defined(__linux__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)
+        std::vector<iovec> iov(chunks.size());
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+            iov[i].iov_base = chunks[i].first;
+            iov[i].iov_len  = size_t(chunks[i].second);
+        }
+        ssize_t wr;
+        do
+            wr = ::pwritev(fd, &iov[0], int(iov.size()), off_t(offset));
+        while (wr < 0 && errno == EINTR);
+        return int64_t(wr);
+#else
+#ifdef _WIN32
+        if (_lseeki64(fd, offset, SEEK_SET) < 0)
+            return -1;
+#endif
+        int64_t total = 0;
+        for (size_t i = 0; i < chunks.size(); ++i)
+        {
+#ifdef _WIN32
+            const int wr = _write(fd, chunks[i].first, unsigned(chunks[i].second));
+#else
+            const ssize_t wr = ::pwrite(fd, chunks[i].first, size_t(chunks[i].second), off_t(offset + total));
+#endif
+            if (wr < 0)
+                return total > 0 ? total : -1;
+            total += wr;
+            if (wr < chunks[i].second)
+                break;
+        }
+        return total;
+#endif
+    }
 }
 
 int CRcvBuffer::readBufferTo(int len, copy_to_dst_f funcCopyToDst, void* arg)
@@ -611,6 +801,54 @@ int CRcvBuffer::readBufferToFile(fstream& ofs, int len)
     return readBufferTo(len, writeBytesToFile, reinterpret_cast<void*>(&ofs));
 }
 
+int CRcvBuffer::readBufferToFd(int fd, int64_t offset, int len)
+{
+    // Maximum number of units written out with a single call.
+    static const size_t MAX_CHUNKS = 256;
+
+    std::vector<std::pair<char*, int> > chunks;
+    chunks.reserve(MAX_CHUNKS);
+
+    int total = 0;
+    while (total < len)
+    {
+        // Collect the readable units starting from the read position,
+        // then write them out and release only what has been written.
+        chunks.clear();
+        int notch = m_iNotch;
+        int batch = 0;
+        for (int p = m_iStartPos; p != m_iFirstNonreadPos && chunks.size() < MAX_CHUNKS && total + batch < len; p = incPos(p))
+        {
+            if (!m_entries[p].pUnit)
+                break;
+
+            const CPacket& pkt = packetAt(p);
+            const int size = std::min(int(pkt.getLength()) - notch, len - total - batch);
+            chunks.push_back(std::make_pair(pkt.m_pcData + notch, size));
+            batch += size;
+            notch = 0;
+        }
+
+        if (chunks.empty())
+            break;
+
+        const int64_t written = writeChunksAt(fd, chunks, offset + total);
+        if (written < 0)
+        {
+            LOGC(rbuflog.Error, log << "readBufferToFd: write failed: " << SysStrError(errno));
+            return total > 0 ? total : -1;
+        }
+
+        if (written > 0)
+            total += readBufferTo(int(written), skipBytes, NULL);
+
+        if (written < batch)
+            break;
+    }
+
+    return total;
+}
+
 bool CRcvBuffer::hasAvailablePackets() const
 {
     return hasReadableInorderPkts() || (m_numOutOfOrderPackets > 0 && m_iFirstReadableOutOfOrder != -1);
@@ -637,23 +875,14 @@ int CRcvBuffer::getTimespan_ms() const
     // if TSBPD is enabled (reading out of order is not allowed).
     // However if decryption of the last packet fails, it may be dropped
     // from the buffer (AES-GCM), and the position will be empty.
-    SRT_ASSERT(m_entries[lastpos].pUnit != NULL || m_entries[lastpos].status == EntryState_Drop);
-    while (m_entries[lastpos].pUnit == NULL && lastpos != m_iStartPos)
-    {
-        lastpos = decPos(lastpos);
-    }
-    
-    if (m_entries[lastpos].pUnit == NULL)
+    SRT_ASSERT(m_bmAvail.test(lastpos) || statusAt(lastpos) == EntryState_Drop);
+    const int lastoff = m_bmAvail.findPrev(lastpos, m_iMaxPosOff, true);
+    if (lastoff < 0)
         return 0;
+    lastpos = (lastpos - lastoff + int(m_szSize)) % int(m_szSize);
 
-    int startpos = m_iStartPos;
-    while (m_entries[startpos].pUnit == NULL && startpos != lastpos)
-    {
-        startpos = incPos(startpos);
-    }
-
-    if (m_entries[startpos].pUnit == NULL)
-        return 0;
+    // There's at least the unit at lastpos.
+    const int startpos = findNextPos(m_bmAvail, m_iStartPos, offPos(m_iStartPos, lastpos) + 1, true);
 
     const steady_clock::time_point startstamp =
         getPktTsbPdTime(packetAt(startpos).getMsgTimeStamp());
@@ -676,13 +905,9 @@ int CRcvBuffer::getRcvDataSize(int& bytes, int& timespan) const
 
 CRcvBuffer::PacketInfo CRcvBuffer::getFirstValidPacketInfo() const
 {
-    const int end_pos = incPos(m_iStartPos, m_iMaxPosOff);
-    for (int i = m_iStartPos; i != end_pos; i = incPos(i))
+    const int i = findNextPos(m_bmAvail, m_iStartPos, m_iMaxPosOff, true);
+    if (i >= 0)
     {
-        // TODO: Maybe check status?
-        if (!m_entries[i].pUnit)
-            continue;
-
         const CPacket& packet = packetAt(i);
         const PacketInfo info = { packet.getSeqNo(), i != m_iStartPos, getPktTsbPdTime(packet.getMsgTimeStamp()) };
         return info;
@@ -780,17 +1005,43 @@ void CRcvBuffer::countBytes(int pkts, int bytes)
     }
 }
 
+void CRcvBuffer::markUnitInPos(int pos, bool outOfOrder)
+{
+    const PacketBoundary boundary = packetAt(pos).getMsgBoundary();
+    m_bmAvail.set(pos);
+    m_bmMsgFirst.set(pos, boundary & PB_FIRST);
+    m_bmMsgLast.set(pos, boundary & PB_LAST);
+    m_bmOutOfOrder.set(pos, outOfOrder);
+}
+
 void CRcvBuffer::releaseUnitInPos(int pos)
 {
+    m_bmDropped.clear(pos);
+    // A gap that was dropped has no storage to clear.
+    if (!m_entries.isAllocated(pos))
+        return;
+
     CUnit* tmp = m_entries[pos].pUnit;
     m_entries[pos] = Entry(); // pUnit = NULL; status = Empty
+    m_bmAvail.clear(pos);
+    m_bmMsgFirst.clear(pos);
+    m_bmMsgLast.clear(pos);
+    m_bmOutOfOrder.clear(pos);
     if (tmp != NULL)
-        m_pUnitQueue->makeUnitFree(tmp);
+        freeUnit(tmp);
+}
+
+void CRcvBuffer::markDroppedInPos(int pos)
+{
+    // The entry of a unit is reset when it's released, and
+    // the status of a gap is not written into its entry.
+    dropUnitInPos(pos);
+    m_bmDropped.set(pos);
 }
 
 bool CRcvBuffer::dropUnitInPos(int pos)
 {
-    if (!m_entries[pos].pUnit)
+    if (!m_bmAvail.test(pos))
         return false;
     if (m_tsbpd.isEnabled())
     {
@@ -809,7 +1060,7 @@ bool CRcvBuffer::dropUnitInPos(int pos)
 void CRcvBuffer::releaseNextFillerEntries()
 {
     int pos = m_iStartPos;
-    while (m_entries[pos].status == EntryState_Read || m_entries[pos].status == EntryState_Drop)
+    while (statusAt(pos) == EntryState_Read || statusAt(pos) == EntryState_Drop)
     {
         m_iStartSeqNo = CSeqNo::incseq(m_iStartSeqNo);
         releaseUnitInPos(pos);
@@ -830,29 +1081,27 @@ void CRcvBuffer::updateNonreadPos()
     const int end_pos = incPos(m_iStartPos, m_iMaxPosOff); // The empty position right after the last valid entry.
 
     int pos = m_iFirstNonreadPos;
-    while (m_entries[pos].pUnit && m_entries[pos].status == EntryState_Avail)
+    while (pos != end_pos && m_bmAvail.test(pos))
     {
-        if (m_bMessageAPI && (packetAt(pos).getMsgBoundary() & PB_FIRST) == 0)
-            break;
-
-        for (int i = pos; i != end_pos; i = incPos(i))
+        // Up to the first gap (or the end) everything is readable in stream mode.
+        const int remain = offPos(pos, end_pos);
+        const int gapoff = m_bmAvail.findNext(pos, remain, false);
+        const int availlen = gapoff < 0 ? remain : gapoff;
+        if (!m_bMessageAPI)
         {
-            if (!m_entries[i].pUnit || m_entries[pos].status != EntryState_Avail)
-            {
-                break;
-            }
-
-            // Check PB_LAST only in message mode.
-            if (!m_bMessageAPI || packetAt(i).getMsgBoundary() & PB_LAST)
-            {
-                m_iFirstNonreadPos = incPos(i);
-                break;
-            }
+            m_iFirstNonreadPos = incPos(pos, availlen);
+            break;
         }
 
-        if (pos == m_iFirstNonreadPos || !m_entries[m_iFirstNonreadPos].pUnit)
+        // In message mode only whole messages, starting at pos, are readable.
+        if (!m_bmMsgFirst.test(pos))
             break;
 
+        const int lastoff = m_bmMsgLast.findNext(pos, availlen, true);
+        if (lastoff < 0)
+            break;
+
+        m_iFirstNonreadPos = incPos(pos, lastoff + 1);
         pos = m_iFirstNonreadPos;
     }
 }
@@ -922,26 +1171,22 @@ bool CRcvBuffer::checkFirstReadableOutOfOrder()
         return false;
 
     const int endPos = incPos(m_iStartPos, m_iMaxPosOff);
-    int msgno = -1;
-    for (int pos = m_iFirstReadableOutOfOrder; pos != endPos; pos = incPos(pos))
-    {
-        if (!m_entries[pos].pUnit)
-            return false;
-
-        const CPacket& pkt = packetAt(pos);
-        if (pkt.getMsgOrderFlag())
-            return false;
-
-        if (msgno == -1)
-            msgno = pkt.getMsgSeq(m_bPeerRexmitFlag);
-        else if (msgno != pkt.getMsgSeq(m_bPeerRexmitFlag))
-            return false;
+    const int pos    = m_iFirstReadableOutOfOrder;
+    const int remain = offPos(pos, endPos);
+
+    // The message must be complete within the run of out-of-order packets.
+    const int gapoff = m_bmOutOfOrder.findNext(pos, remain, false);
+    const int runlen = gapoff < 0 ? remain : gapoff;
+    const int lastpos = findNextPos(m_bmMsgLast, pos, runlen, true);
+    if (lastpos < 0)
+        return false;
 
-        if (pkt.getMsgBoundary() & PB_LAST)
-            return true;
-    }
+    // No other message may start in between.
+    const int nextfirst = findNextPos(m_bmMsgFirst, incPos(pos), offPos(pos, lastpos), true);
+    if (nextfirst >= 0)
+        return false;
 
-    return false;
+    return packetAt(pos).getMsgSeq(m_bPeerRexmitFlag) == packetAt(lastpos).getMsgSeq(m_bPeerRexmitFlag);
 }
 
 void CRcvBuffer::updateFirstReadableOutOfOrder()
@@ -952,59 +1197,50 @@ void CRcvBuffer::updateFirstReadableOutOfOrder()
     if (m_iMaxPosOff == 0)
         return;
 
-    // TODO: unused variable outOfOrderPktsRemain?
-    int outOfOrderPktsRemain = (int) m_numOutOfOrderPackets;
-
-    // Search further packets to the right.
-    // First check if there are packets to the right.
-    const int lastPos = (m_iStartPos + m_iMaxPosOff - 1) % m_szSize;
-
-    int posFirst = -1;
-    int posLast = -1;
-    int msgNo = -1;
-
-    for (int pos = m_iStartPos; outOfOrderPktsRemain; pos = incPos(pos))
+    // Go over the runs of out-of-order packets and look for
+    // the first message that is complete in one of them.
+    int off = 0;
+    while (off < m_iMaxPosOff)
     {
-        if (!m_entries[pos].pUnit)
-        {
-            posFirst = posLast = msgNo = -1;
-            continue;
-        }
+        const int runoff = m_bmOutOfOrder.findNext(incPos(m_iStartPos, off), m_iMaxPosOff - off, true);
+        if (runoff < 0)
+            return;
+        off += runoff;
 
-        const CPacket& pkt = packetAt(pos);
+        const int runpos = incPos(m_iStartPos, off);
+        const int gapoff = m_bmOutOfOrder.findNext(runpos, m_iMaxPosOff - off, false);
+        const int runlen = gapoff < 0 ? m_iMaxPosOff - off : gapoff;
 
-        if (pkt.getMsgOrderFlag())   // Skip in order packet
+        int firstoff = m_bmMsgFirst.findNext(runpos, runlen, true);
+        while (firstoff >= 0)
         {
-            posFirst = posLast = msgNo = -1;
-            continue;
-        }
-
-        --outOfOrderPktsRemain;
+            const int posFirst = incPos(runpos, firstoff);
+            const int lastoff  = m_bmMsgLast.findNext(posFirst, runlen - firstoff, true);
+            if (lastoff < 0)
+                break;
 
-        const PacketBoundary boundary = pkt.getMsgBoundary();
-        if (boundary & PB_FIRST)
-        {
-            posFirst = pos;
-            msgNo = pkt.getMsgSeq(m_bPeerRexmitFlag);
-        }
+            // The next message starting before this one ends means a missing PB_LAST.
+            const int nextoff = lastoff == 0 ? -1 : m_bmMsgFirst.findNext(incPos(posFirst), lastoff, true);
+            if (nextoff >= 0)
+            {
+                firstoff += 1 + nextoff;
+                continue;
+            }
 
-        if (pkt.getMsgSeq(m_bPeerRexmitFlag) != msgNo)
-        {
-            posFirst = posLast = msgNo = -1;
-            continue;
-        }
+            const int posLast = incPos(posFirst, lastoff);
+            if (packetAt(posFirst).getMsgSeq(m_bPeerRexmitFlag) == packetAt(posLast).getMsgSeq(m_bPeerRexmitFlag))
+            {
+                m_iFirstReadableOutOfOrder = posFirst;
+                return;
+            }
 
-        if (boundary & PB_LAST)
-        {
-            m_iFirstReadableOutOfOrder = posFirst;
-            return;
+            const int after = firstoff + lastoff + 1;
+            const int nf    = after < runlen ? m_bmMsgFirst.findNext(incPos(runpos, after), runlen - after, true) : -1;
+            firstoff = nf < 0 ? -1 : after + nf;
         }
 
-        if (pos == lastPos)
-            break;
+        off += runlen;
     }
-
-    return;
 }
 
 int CRcvBuffer::scanNotInOrderMessageRight(const int startPos, int msgNo) const
@@ -1015,27 +1251,21 @@ int CRcvBuffer::scanNotInOrderMessageRight(const int startPos, int msgNo) const
     if (startPos == lastPos)
         return -1;
 
-    int pos = startPos;
-    do
-    {
-        pos = incPos(pos);
-        if (!m_entries[pos].pUnit)
-            break;
-
-        const CPacket& pkt = packetAt(pos);
-
-        if (pkt.getMsgSeq(m_bPeerRexmitFlag) != msgNo)
-        {
-            LOGC(rbuflog.Error, log << "Missing PB_LAST packet for msgNo " << msgNo);
-            return -1;
-        }
+    // The last packet of the message must come before the first gap.
+    const int from   = incPos(startPos);
+    const int remain = offPos(startPos, lastPos);
+    const int gapoff = m_bmAvail.findNext(from, remain, false);
+    const int pos    = findNextPos(m_bmMsgLast, from, gapoff < 0 ? remain : gapoff, true);
+    if (pos < 0)
+        return -1;
 
-        const PacketBoundary boundary = pkt.getMsgBoundary();
-        if (boundary & PB_LAST)
-            return pos;
-    } while (pos != lastPos);
+    if (packetAt(pos).getMsgSeq(m_bPeerRexmitFlag) != msgNo)
+    {
+        LOGC(rbuflog.Error, log << "Missing PB_LAST packet for msgNo " << msgNo);
+        return -1;
+    }
 
-    return -1;
+    return pos;
 }
 
 int CRcvBuffer::scanNotInOrderMessageLeft(const int startPos, int msgNo) const
@@ -1045,28 +1275,22 @@ int CRcvBuffer::scanNotInOrderMessageLeft(const int startPos, int msgNo) const
     if (startPos == m_iStartPos)
         return -1;
 
-    int pos = startPos;
-    do
-    {
-        pos = decPos(pos);
-
-        if (!m_entries[pos].pUnit)
-            return -1;
-
-        const CPacket& pkt = packetAt(pos);
-
-        if (pkt.getMsgSeq(m_bPeerRexmitFlag) != msgNo)
-        {
-            LOGC(rbuflog.Error, log << "Missing PB_FIRST packet for msgNo " << msgNo);
-            return -1;
-        }
+    // The first packet of the message must come after the closest gap.
+    const int from    = decPos(startPos);
+    const int remain  = offPos(m_iStartPos, startPos);
+    const int gapoff  = m_bmAvail.findPrev(from, remain, false);
+    const int firstoff = m_bmMsgFirst.findPrev(from, gapoff < 0 ? remain : gapoff, true);
+    if (firstoff < 0)
+        return -1;
 
-        const PacketBoundary boundary = pkt.getMsgBoundary();
-        if (boundary & PB_FIRST)
-            return pos;
-    } while (pos != m_iStartPos);
+    const int pos = (from - firstoff + int(m_szSize)) % int(m_szSize);
+    if (packetAt(pos).getMsgSeq(m_bPeerRexmitFlag) != msgNo)
+    {
+        LOGC(rbuflog.Error, log << "Missing PB_FIRST packet for msgNo " << msgNo);
+        return -1;
+    }
 
-    return -1;
+    return pos;
 }
 
 bool CRcvBuffer::addRcvTsbPdDriftSample(uint32_t usTimestamp, const time_point& tsPktArrival, int usRTTSample)
@@ -1121,7 +1345,7 @@ string CRcvBuffer::strFullnessState(int iFirstUnackSeqNo, const time_point& tsNo
         {
             ss << count_milliseconds(nextValidPkt.tsbpd_time - tsNow) << "ms";
             const int iLastPos = incPos(m_iStartPos, m_iMaxPosOff - 1);
-            if (m_entries[iLastPos].pUnit)
+            if (m_bmAvail.test(iLastPos))
             {
                 ss << ", timespan ";
                 const uint32_t usPktTimestamp = packetAt(iLastPos).getMsgTimeStamp();
@@ -11,6 +11,7 @@
 #ifndef INC_SRT_BUFFER_RCV_H
 #define INC_SRT_BUFFER_RCV_H
 
+#include <deque>
 #include "buffer_tools.h" // AvgBufSize
 #include "common.h"
 #include "queue.h"
@@ -109,6 +110,37 @@ public:
     ///         -1 on failure.
     int readMessage(char* data, size_t len, SRT_MSGCTRL* msgctrl = NULL);
 
+    /// Read the whole message, scattering it over several buffers
+    /// (filled in order, each one up to its length).
+    ///
+    /// @param [in] iov buffers to write the message into.
+    /// @param [in] iovcnt number of buffers in @a iov.
+    /// @param [in,out] message control data
+    ///
+    /// @return actual number of bytes extracted from the buffer.
+    ///          0 if nothing to read.
+    int readMessagev(const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL* msgctrl = NULL);
+
+    /// Read the whole message without copying the payload. The units holding
+    /// the packets are taken out of the buffer, but not freed until they are
+    /// given back with @a releaseViews (or the buffer is deleted).
+    ///
+    /// @param [out] w_views payload of every packet of the message, in order.
+    /// @param [in] nviews capacity of @a w_views.
+    /// @param [in,out] message control data
+    ///
+    /// @return number of packets (views) of the message.
+    ///          0 if nothing to read.
+    ///         -1 if the message has more packets than @a nviews (nothing is read).
+    int readMessageViews(SRT_PKTVIEW* w_views, int nviews, SRT_MSGCTRL* msgctrl = NULL);
+
+    /// Free the units of the packets read by @a readMessageViews.
+    /// @return number of views found and released.
+    int releaseViews(const SRT_PKTVIEW* views, int nviews);
+
+    /// Number of units read by @a readMessageViews and not yet released.
+    size_t countHeldUnits() const { return m_HeldUnits.size(); }
+
     /// Read acknowledged data into a user buffer.
     /// @param [in, out] dst pointer to the target user buffer.
     /// @param [in] len length of user buffer.
@@ -121,6 +153,15 @@ public:
     /// @return size of data read. -1 on error.
     int readBufferToFile(std::fstream& ofs, int len);
 
+    /// Write acknowledged data directly into the file at given position,
+    /// gathering the payloads of several units into one write (pwritev).
+    /// The file offset of @a fd is not changed.
+    /// @param [in] fd file descriptor open for writing.
+    /// @param [in] offset position in the file to write to.
+    /// @param [in] len expected length of data to write into the file.
+    /// @return size of data written. -1 on error.
+    int readBufferToFd(int fd, int64_t offset, int len);
+
 public:
     /// Get the starting position of the buffer as a packet sequence number.
     int getStartSeqNo() const { return m_iStartSeqNo; }
@@ -228,6 +269,27 @@ public:
         return m_szSize - 1;
     }
 
+    /// Return the memory taken by the bookkeeping of the buffer in bytes
+    /// (the packets themselves are held in the units of the unit queue).
+    size_t getMemoryUsage() const;
+
+    /// Give back the storage of the entries that has not been used since
+    /// the previous call. To be called periodically. Requires locking.
+    void releaseIdleStorage();
+
+    /// Return the number of units of the shared unit queue held by this buffer
+    /// (packets stored in the buffer and packets lent out as views).
+    int getUnitsHeld() const { return m_iUnitsHeld; }
+
+    /// Return how many more units this buffer may take before exceeding its
+    /// fair share of the shared unit queue. INT_MAX if the queue is not
+    /// short of memory (no memory limit or enough units left).
+    int getMemShareLeft() const;
+
+    /// Return the fair share of the units for this buffer, 0 if the memory
+    /// of the unit queue is not limited.
+    int getMemShare() const;
+
     int64_t getDrift() const { return m_tsbpd.drift(); }
 
     // TODO: make thread safe?
@@ -312,6 +374,11 @@ private:
     /// @return size of data read.
     int readBufferTo(int len, copy_to_dst_f funcCopyToDst, void* arg);
 
+    /// Read the message either into @a iov or, if @a w_views is not NULL,
+    /// by handing out the units (see @a readMessageViews).
+    /// @return number of bytes copied, or the number of views filled.
+    int readMessageTo(const SRT_IOVEC* iov, int iovcnt, SRT_PKTVIEW* w_views, SRT_MSGCTRL* msgctrl);
+
     /// @brief Estimate timespan of the stored packets (acknowledged and unacknowledged).
     /// @return timespan in milliseconds
     int getTimespan_ms() const;
@@ -352,9 +419,46 @@ private:
         EntryStatus status;
     };
 
-    typedef FixedArray<Entry> entries_t;
+    // The entries are allocated in chunks on demand, so that a buffer
+    // configured for a high bitrate and latency doesn't take the memory
+    // for the whole capacity while carrying a low bitrate stream.
+    static const size_t ENTRIES_CHUNK_SIZE = 256;
+
+    typedef ChunkedArray<Entry> entries_t;
     entries_t m_entries;
 
+    // Bitmaps kept alongside m_entries, so that scans over the buffer
+    // (gaps, message boundaries) can be done word-wide.
+    CircularBitmap m_bmAvail;      // The entry has a unit (EntryState_Avail).
+    CircularBitmap m_bmMsgFirst;   // The packet has PB_FIRST.
+    CircularBitmap m_bmMsgLast;    // The packet has PB_LAST.
+    CircularBitmap m_bmOutOfOrder; // The packet is counted in m_numOutOfOrderPackets.
+    CircularBitmap m_bmDropped;    // The entry was dropped (EntryState_Drop), kept
+                                   // here only, so that dropping a gap takes no storage.
+
+    /// Status of the entry; doesn't allocate the storage for it.
+    EntryStatus statusAt(int pos) const { return m_bmDropped.test(pos) ? EntryState_Drop : m_entries[pos].status; }
+
+    /// Drop the unit at @a pos, if any, and mark the entry dropped.
+    void markDroppedInPos(int pos);
+
+    /// Update the bitmaps for the unit just put at @a pos.
+    void markUnitInPos(int pos, bool outOfOrder);
+
+    /// Position of the first entry with given bit value in @a bitmap among
+    /// @a len entries starting from @a pos, or -1 if not found.
+    int findNextPos(const CircularBitmap& bitmap, int pos, int len, bool value) const
+    {
+        const int off = bitmap.findNext(pos, len, value);
+        return off < 0 ? -1 : incPos(pos, off);
+    }
+
+    /// Take a unit from the shared unit queue and count it as held by this buffer.
+    void takeUnit(CUnit* unit);
+
+    /// Give the unit back to the shared unit queue.
+    void freeUnit(CUnit* unit);
+
     const size_t m_szSize;     // size of the array of units (buffer)
     CUnitQueue*  m_pUnitQueue; // the shared unit queue
 
@@ -370,6 +474,8 @@ private:
     bool m_bPeerRexmitFlag;         // Needed to read message number correctly
     const bool m_bMessageAPI;       // Operation mode flag: message or stream.
 
+    std::deque<CUnit*> m_HeldUnits; // Units handed out by readMessageViews, in the order of reading
+
 public: // TSBPD public functions
     /// Set TimeStamp-Based Packet Delivery Rx Mode
     /// @param [in] timebase localtime base (uSec) of packet time stamps including buffering delay
@@ -409,6 +515,8 @@ private: // Statistics
     int         m_iBytesCount;      // Number of payload bytes in the buffer
     int         m_iPktsCount;       // Number of payload bytes in the buffer
     unsigned    m_uAvgPayloadSz;    // Average payload size for dropped bytes estimation
+
+    sync::atomic<int> m_iUnitsHeld; // Units of the shared unit queue held by this buffer
 };
 
 } // namespace srt
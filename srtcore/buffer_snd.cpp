@@ -52,7 +52,13 @@ modified by
 
 #include "platform_sys.h"
 
+#include <algorithm>
+#include <cerrno>
 #include <cmath>
+#include <limits>
+#ifdef _WIN32
+#include <io.h> // _read, _lseeki64
+#endif
 #include "buffer_snd.h"
 #include "packet.h"
 #include "core.h" // provides some constants
@@ -64,14 +70,117 @@ using namespace std;
 using namespace srt_logging;
 using namespace sync;
 
-CSndBuffer::CSndBuffer(int ip_family, int size, int maxpld, int authtag)
+CSndBlockPool::CSndBlockPool()
+    : m_zCachedChunks(0)
+    , m_llCachedBytes(0)
+    , m_llUsedBytes(0)
+    , m_llLimit(0)
+{
+    setupMutex(m_Lock, "SndBlockPool");
+}
+
+CSndBlockPool::~CSndBlockPool()
+{
+    freeCached(std::numeric_limits<size_t>::max());
+    releaseMutex(m_Lock);
+}
+
+void CSndBlockPool::setLimit(int64_t limit)
+{
+    m_llLimit = limit;
+}
+
+char* CSndBlockPool::allocate(size_t size, bool force)
+{
+    ScopedLock lk(m_Lock);
+    const int64_t limit = m_llLimit;
+    if (!force && limit > 0 && m_llUsedBytes + int64_t(size) > limit)
+    {
+        HLOGC(bslog.Debug, log << "CSndBlockPool: limit " << limit << " reached, used " << m_llUsedBytes
+                << ", refusing " << size << " bytes");
+        return NULL;
+    }
+
+    char* chunk = NULL;
+    std::map<size_t, std::vector<char*> >::iterator i = m_FreeChunks.find(size);
+    if (i != m_FreeChunks.end() && !i->second.empty())
+    {
+        chunk = i->second.back();
+        i->second.pop_back();
+        --m_zCachedChunks;
+        m_llCachedBytes -= size;
+    }
+    else
+    {
+        // Cached chunks of other sizes count to the limit, too.
+        if (limit > 0)
+            freeCached(size_t(std::max<int64_t>(0, m_llUsedBytes + m_llCachedBytes + int64_t(size) - limit)));
+        chunk = new char[size];
+    }
+
+    m_llUsedBytes += size;
+    return chunk;
+}
+
+void CSndBlockPool::release(char* chunk, size_t size)
+{
+    ScopedLock lk(m_Lock);
+    m_llUsedBytes -= size;
+    if (m_zCachedChunks >= MAX_CACHED_CHUNKS)
+    {
+        delete[] chunk;
+        return;
+    }
+
+    m_FreeChunks[size].push_back(chunk);
+    ++m_zCachedChunks;
+    m_llCachedBytes += size;
+}
+
+int64_t CSndBlockPool::available() const
+{
+    const int64_t limit = m_llLimit;
+    if (limit <= 0)
+        return std::numeric_limits<int64_t>::max();
+
+    ScopedLock lk(m_Lock);
+    return std::max<int64_t>(0, limit - m_llUsedBytes);
+}
+
+int64_t CSndBlockPool::used() const
+{
+    ScopedLock lk(m_Lock);
+    return m_llUsedBytes;
+}
+
+void CSndBlockPool::freeCached(size_t need)
+{
+    for (std::map<size_t, std::vector<char*> >::iterator i = m_FreeChunks.begin();
+            i != m_FreeChunks.end() && m_llCachedBytes > 0 && need > 0; ++i)
+    {
+        while (!i->second.empty() && need > 0)
+        {
+            delete[] i->second.back();
+            i->second.pop_back();
+            --m_zCachedChunks;
+            m_llCachedBytes -= i->first;
+            need = need > i->first ? need - i->first : 0;
+        }
+    }
+}
+
+CSndBuffer::CSndBuffer(int ip_family, int size, int maxpld, int authtag, CSndBlockPool* pool)
     : m_BufLock()
-    , m_pBlock(NULL)
-    , m_pFirstBlock(NULL)
-    , m_pCurrBlock(NULL)
-    , m_pLastBlock(NULL)
+    , m_pBlocks(NULL)
+    , m_iStartPos(0)
+    , m_iCurrPos(0)
+    , m_iEndPos(0)
+    , m_llBytesAdded(0)
     , m_pBuffer(NULL)
+    , m_pPool(pool)
+    , m_bUsedSinceCheck(false)
     , m_iNextMsgNo(1)
+    , m_bUserBuffersReleased(false)
     , m_iSize(size)
     , m_iBlockLen(maxpld)
     , m_iAuthTagSize(authtag)
@@ -81,58 +190,118 @@ CSndBuffer::CSndBuffer(int ip_family, int size, int maxpld, int authtag)
 {
     // initial physical buffer of "size"
     m_pBuffer           = new Buffer;
-    m_pBuffer->m_pcData = new char[m_iSize * m_iBlockLen];
+    m_pBuffer->m_pcData = allocChunk(m_iSize, true);
     m_pBuffer->m_iSize  = m_iSize;
     m_pBuffer->m_pNext  = NULL;
 
-    // circular linked list for out bound packets
-    m_pBlock  = new Block;
-    Block* pb = m_pBlock;
+    // ring of blocks for out bound packets
+    m_pBlocks = new Block[m_iSize];
     char* pc  = m_pBuffer->m_pcData;
 
     for (int i = 0; i < m_iSize; ++i)
     {
-        pb->m_iMsgNoBitset = 0;
-        pb->m_pcData       = pc;
-        pc                += m_iBlockLen;
-
-        if (i < m_iSize - 1)
-        {
-            pb->m_pNext        = new Block;
-            pb                 = pb->m_pNext;
-        }
+        m_pBlocks[i].m_iMsgNoBitset = 0;
+        m_pBlocks[i].m_pcData       = pc;
+        m_pBlocks[i].m_pcUserData   = NULL;
+        pc                         += m_iBlockLen;
     }
-    pb->m_pNext = m_pBlock;
-
-    m_pFirstBlock = m_pCurrBlock = m_pLastBlock = m_pBlock;
 
     setupMutex(m_BufLock, "Buf");
 }
 
 CSndBuffer::~CSndBuffer()
 {
-    Block* pb = m_pBlock->m_pNext;
-    while (pb != m_pBlock)
-    {
-        Block* temp = pb;
-        pb          = pb->m_pNext;
-        delete temp;
-    }
-    delete m_pBlock;
+    delete[] m_pBlocks;
 
     while (m_pBuffer != NULL)
     {
         Buffer* temp = m_pBuffer;
         m_pBuffer    = m_pBuffer->m_pNext;
-        delete[] temp->m_pcData;
+        freeChunk(temp->m_pcData, temp->m_iSize);
         delete temp;
     }
 
     releaseMutex(m_BufLock);
 }
 
-void CSndBuffer::addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl)
+bool CSndBuffer::reserve(int iNumBlocks)
+{
+    ScopedLock bufferguard(m_BufLock);
+    return reserveLocked(iNumBlocks);
+}
+
+bool CSndBuffer::reserveLocked(int iNumBlocks)
 {
+    // Dynamically increase sender buffer if there is not enough room.
+    while (iNumBlocks + m_iCount >= m_iSize)
+    {
+        HLOGC(bslog.Debug, log << "reserve: ... still lacking " << (iNumBlocks + m_iCount - m_iSize) << " buffers...");
+        if (!increase())
+            return false;
+    }
+    m_bUsedSinceCheck = true;
+    return true;
+}
+
+void CSndBuffer::addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl, bool zerocopy)
+{
+    // Retrieve current time before locking the mutex to be closer to packet submission event.
+    const steady_clock::time_point tnow = steady_clock::now();
+
+    SRT_IOVEC iov;
+    iov.iov_base = const_cast<char*>(data);
+    iov.iov_len  = len;
+
+    ScopedLock bufferguard(m_BufLock);
+    addBufferLocked(&iov, 1, len, (w_mctrl), zerocopy, tnow);
+}
+
+void CSndBuffer::addBufferv(const SRT_IOVEC* iov, int iovcnt, int len, SRT_MSGCTRL& w_mctrl)
+{
+    const steady_clock::time_point tnow = steady_clock::now();
+
+    ScopedLock bufferguard(m_BufLock);
+    addBufferLocked(iov, iovcnt, len, (w_mctrl), false, tnow);
+}
+
+int32_t CSndBuffer::addBuffers(SRT_MSGVEC* w_msgs, int n, int32_t seqno)
+{
+    const steady_clock::time_point tnow = steady_clock::now();
+
+    ScopedLock bufferguard(m_BufLock);
+
+    // Take the space for the whole batch first, so that
+    // it is either added completely or not at all.
+    const int iPktLen = getMaxPacketLen();
+    int iNumBlocks = 0;
+    for (int i = 0; i < n; ++i)
+        iNumBlocks += countNumPacketsRequired(w_msgs[i].len, iPktLen);
+    if (!reserveLocked(iNumBlocks))
+        throw CUDTException(MJ_AGAIN, MN_WRAVAIL, 0);
+
+    for (int i = 0; i < n; ++i)
+    {
+        SRT_MSGCTRL&  w_mctrl = w_msgs[i].mctrl;
+        const int32_t first   = seqno;
+        w_mctrl.pktseq        = seqno;
+        SRT_IOVEC iov;
+        iov.iov_base = w_msgs[i].buf;
+        iov.iov_len  = w_msgs[i].len;
+        addBufferLocked(&iov, 1, w_msgs[i].len, (w_mctrl), false, tnow);
+        seqno          = w_mctrl.pktseq;
+        w_mctrl.pktseq = first;
+    }
+    return seqno;
+}
+
+void CSndBuffer::addBufferLocked(const SRT_IOVEC* iov, int iovcnt, int len, SRT_MSGCTRL& w_mctrl, bool zerocopy, const time_point& tnow)
+{
+    // Zero-copy refers to a single user buffer.
+    SRT_ASSERT(!zerocopy || iovcnt == 1);
+    const char* data = static_cast<const char*>(iov[0].iov_base);
+    int    seg    = 0; // The current piece of the user data and the position in it.
+    size_t segoff = 0;
+
     int32_t& w_msgno     = w_mctrl.msgno;
     int32_t& w_seqno     = w_mctrl.pktseq;
     int64_t& w_srctime   = w_mctrl.srctime;
@@ -142,16 +311,10 @@ void CSndBuffer::addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl)
 
     HLOGC(bslog.Debug,
           log << "addBuffer: needs=" << iNumBlocks << " buffers for " << len << " bytes. Taken=" << m_iCount << "/" << m_iSize);
-    // Retrieve current time before locking the mutex to be closer to packet submission event.
-    const steady_clock::time_point tnow = steady_clock::now();
 
-    ScopedLock bufferguard(m_BufLock);
-    // Dynamically increase sender buffer if there is not enough room.
-    while (iNumBlocks + m_iCount >= m_iSize)
-    {
-        HLOGC(bslog.Debug, log << "addBuffer: ... still lacking " << (iNumBlocks + m_iCount - m_iSize) << " buffers...");
-        increase();
-    }
+    // Nothing is written before all blocks for the message are there.
+    if (!reserveLocked(iNumBlocks))
+        throw CUDTException(MJ_AGAIN, MN_WRAVAIL, 0);
 
     const int32_t inorder = w_mctrl.inorder ? MSGNO_PACKET_INORDER::mask : 0;
     HLOGC(bslog.Debug,
@@ -169,7 +332,7 @@ void CSndBuffer::addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl)
     // If there's more than one packet, this function must increase it by itself
     // and then return the accordingly modified sequence number in the reference.
 
-    Block* s = m_pLastBlock;
+    int pos = m_iEndPos;
 
     if (w_msgno == SRT_MSGNO_NONE) // DEFAULT-UNCHANGED msgno supplied
     {
@@ -184,14 +347,38 @@ void CSndBuffer::addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl)
 
     for (int i = 0; i < iNumBlocks; ++i)
     {
+        Block* s = &m_pBlocks[pos];
+
         int pktlen = len - i * iPktLen;
         if (pktlen > iPktLen)
             pktlen = iPktLen;
 
+        if (zerocopy)
+        {
+            // The payload is never modified on the sending path
+            // (zero-copy is not allowed with encryption).
+            s->m_pcUserData = const_cast<char*>(data + i * iPktLen);
+        }
+        else
+        {
+            // Gather the packet payload from the pieces of the user data.
+            for (size_t pktoff = 0; pktoff < size_t(pktlen) && seg < iovcnt;)
+            {
+                const size_t n = std::min(size_t(pktlen) - pktoff, iov[seg].iov_len - segoff);
+                memcpy(s->m_pcData + pktoff, static_cast<const char*>(iov[seg].iov_base) + segoff, n);
+                pktoff += n;
+                segoff += n;
+                if (segoff == iov[seg].iov_len)
+                {
+                    ++seg;
+                    segoff = 0;
+                }
+            }
+            s->m_pcUserData = NULL;
+        }
         HLOGC(bslog.Debug,
               log << "addBuffer: %" << w_seqno << " #" << w_msgno << " offset=" << (i * iPktLen)
-                  << " size=" << pktlen << " TO BUFFER:" << (void*)s->m_pcData);
-        memcpy((s->m_pcData), data + i * iPktLen, pktlen);
+                  << " size=" << pktlen << " TO BUFFER:" << (void*)s->payload());
         s->m_iLength = pktlen;
 
         s->m_iSeqNo = w_seqno;
@@ -211,13 +398,20 @@ void CSndBuffer::addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl)
 
         s->m_iTTL = ttl;
         s->m_tsRexmitTime = time_point();
+        s->m_tsSentTime = time_point();
         s->m_tsOriginTime = m_tsLastOriginTime;
-        
-        // Should never happen, as the call to increase() should ensure enough buffers.
-        SRT_ASSERT(s->m_pNext);
-        s = s->m_pNext;
+        s->m_llBytesBefore = m_llBytesAdded;
+        m_llBytesAdded += pktlen;
+
+        pos = incPos(pos);
+    }
+    m_iEndPos = pos;
+
+    if (zerocopy)
+    {
+        const UserBuffer ub = {data, len, m_llBytesAdded, SRT_ZC_ACKED};
+        m_UserBuffers.push_back(ub);
     }
-    m_pLastBlock = s;
 
     m_iCount = m_iCount + iNumBlocks;
     m_iBytesCount += len;
@@ -236,44 +430,113 @@ void CSndBuffer::addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl)
     m_iNextMsgNo = nextmsgno;
 }
 
-int CSndBuffer::addBufferFromFile(fstream& ifs, int len)
+namespace {
+    /// @brief Reads bytes from file stream.
+    /// @param dst pointer to the buffer to read into.
+    /// @param len the number of bytes to read
+    /// @param arg a void pointer to the fstream to read from.
+    /// @return the number of bytes read, 0 at the end of the file, -1 on failure
+    int readBytesFromFile(char* dst, int len, void* arg)
+    {
+        fstream* pifs = reinterpret_cast<fstream*>(arg);
+        // A short read at the end of the file sets both eofbit and failbit,
+        // so failbit is an error only without eofbit.
+        if (pifs->eof() && !pifs->bad())
+            return 0;
+        if (pifs->bad() || pifs->fail())
+            return -1;
+        pifs->read(dst, len);
+        const int rd = int(pifs->gcount());
+        if (pifs->bad() || (pifs->fail() && !pifs->eof()))
+            return rd > 0 ? rd : -1;
+        return rd;
+    }
+
+    struct FdReadPos
+    {
+        int     fd;
+        int64_t offset;
+    };
+
+    /// @brief Reads bytes from file descriptor at the position given in @a arg,
+    /// without changing the file offset.
+    /// @param dst pointer to the buffer to read into.
+    /// @param len the number of bytes to read
+    /// @param arg a pointer to the FdReadPos, whose offset is advanced.
+    /// @return the number of bytes read, 0 at the end of the file, -1 on failure
+    int readBytesFromFd(char* dst, int len, void* arg)
+    {
+        FdReadPos* src = reinterpret_cast<FdReadPos*>(arg);
+#ifdef _WIN32
+        if (_lseeki64(src->fd, src->offset, SEEK_SET) < 0)
+            return -1;
+        const int rd = _read(src->fd, dst, unsigned(len));
+#else
+        ssize_t rd;
+        do
+            rd = ::pread(src->fd, dst, size_t(len), off_t(src->offset));
+        while (rd < 0 && errno == EINTR);
+#endif
+        if (rd > 0)
+            src->offset += rd;
+        return int(rd);
+    }
+}
+
+int CSndBuffer::addBufferFromFile(fstream& ifs, int len, int32_t& w_seqno)
+{
+    return addBufferFrom(len, readBytesFromFile, reinterpret_cast<void*>(&ifs), (w_seqno));
+}
+
+int CSndBuffer::addBufferFromFd(int fd, int64_t offset, int len, int32_t& w_seqno)
+{
+    FdReadPos src = { fd, offset };
+    return addBufferFrom(len, readBytesFromFd, reinterpret_cast<void*>(&src), (w_seqno));
+}
+
+int CSndBuffer::addBufferFrom(int len, copy_from_src_f funcCopyFromSrc, void* arg, int32_t& w_seqno)
 {
     const int iPktLen    = getMaxPacketLen();
     const int iNumBlocks = countNumPacketsRequired(len, iPktLen);
 
     HLOGC(bslog.Debug,
-          log << "addBufferFromFile: size=" << m_iCount << " reserved=" << m_iSize << " needs=" << iPktLen
+          log << "addBufferFrom: size=" << m_iCount << " reserved=" << m_iSize << " needs=" << iPktLen
               << " buffers for " << len << " bytes");
 
-    // dynamically increase sender buffer
-    while (iNumBlocks + m_iCount >= m_iSize)
-    {
-        HLOGC(bslog.Debug,
-              log << "addBufferFromFile: ... still lacking " << (iNumBlocks + m_iCount - m_iSize) << " buffers...");
-        increase();
-    }
+    // Nothing is read before all blocks for the data are there.
+    if (!reserve(iNumBlocks))
+        throw CUDTException(MJ_AGAIN, MN_WRAVAIL, 0);
 
     HLOGC(bslog.Debug,
-          log << CONID() << "addBufferFromFile: adding " << iPktLen << " packets (" << len
+          log << CONID() << "addBufferFrom: adding " << iPktLen << " packets (" << len
               << " bytes) to send, msgno=" << m_iNextMsgNo);
 
-    Block* s     = m_pLastBlock;
-    int    total = 0;
+    // The blocks past the end position are not accessed by the sending
+    // thread and the buffer can only be reallocated by the thread adding
+    // data (see releaseIdleStorage()), so the data can be read into them
+    // without locking.
+    int     pos   = m_iEndPos;
+    int64_t added = m_llBytesAdded;
+    int32_t seqno = w_seqno;
+    int     total = 0;
+    bool failed = false;
     for (int i = 0; i < iNumBlocks; ++i)
     {
-        if (ifs.bad() || ifs.fail() || ifs.eof())
-            break;
+        Block* s = &m_pBlocks[pos];
 
         int pktlen = len - i * iPktLen;
         if (pktlen > iPktLen)
             pktlen = iPktLen;
 
         HLOGC(bslog.Debug,
-              log << "addBufferFromFile: reading from=" << (i * iPktLen) << " size=" << pktlen
+              log << "addBufferFrom: reading from=" << (i * iPktLen) << " size=" << pktlen
                   << " TO BUFFER:" << (void*)s->m_pcData);
-        ifs.read(s->m_pcData, pktlen);
-        if ((pktlen = int(ifs.gcount())) <= 0)
+        pktlen = funcCopyFromSrc(s->m_pcData, pktlen, arg);
+        if (pktlen <= 0)
+        {
+            failed = (pktlen < 0);
             break;
+        }
 
         // currently file transfer is only available in streaming mode, message is always in order, ttl = infinite
         s->m_iMsgNoBitset = m_iNextMsgNo | MSGNO_PACKET_INORDER::mask;
@@ -284,24 +547,37 @@ int CSndBuffer::addBufferFromFile(fstream& ifs, int len)
         // NOTE: PB_FIRST | PB_LAST == PB_SOLO.
         // none of PB_FIRST & PB_LAST == PB_SUBSEQUENT.
 
-        s->m_iLength = pktlen;
-        s->m_iTTL    = SRT_MSGTTL_INF;
-        s            = s->m_pNext;
+        s->m_iSeqNo        = seqno;
+        seqno              = CSeqNo::incseq(seqno);
+        s->m_pcUserData    = NULL;
+        s->m_iLength       = pktlen;
+        s->m_iTTL          = SRT_MSGTTL_INF;
+        s->m_tsRexmitTime  = time_point();
+        s->m_tsSentTime    = time_point();
+        s->m_llBytesBefore = added;
+        added += pktlen;
+        pos = incPos(pos);
 
         total += pktlen;
     }
-    m_pLastBlock = s;
 
     enterCS(m_BufLock);
-    m_iCount = m_iCount + iNumBlocks;
+    m_iCount       = m_iCount + offPos(m_iEndPos, pos);
+    m_iEndPos      = pos;
+    m_llBytesAdded = added;
     m_iBytesCount += total;
 
     leaveCS(m_BufLock);
 
+    w_seqno = seqno;
+
     m_iNextMsgNo++;
     if (m_iNextMsgNo == int32_t(MSGNO_SEQ::mask))
         m_iNextMsgNo = 1;
 
+    if (total == 0 && failed)
+        return -1;
+
     return total;
 }
 
@@ -311,13 +587,15 @@ int CSndBuffer::readData(CPacket& w_packet, steady_clock::time_point& w_srctime,
     w_seqnoinc = 0;
 
     ScopedLock bufferguard(m_BufLock);
-    while (m_pCurrBlock != m_pLastBlock)
+    while (m_iCurrPos != m_iEndPos)
     {
+        Block* p = &m_pBlocks[m_iCurrPos];
+
         // Make the packet REFLECT the data stored in the buffer.
-        w_packet.m_pcData = m_pCurrBlock->m_pcData;
-        readlen = m_pCurrBlock->m_iLength;
+        w_packet.m_pcData = p->payload();
+        readlen = p->m_iLength;
         w_packet.setLength(readlen, m_iBlockLen);
-        w_packet.set_seqno(m_pCurrBlock->m_iSeqNo);
+        w_packet.set_seqno(p->m_iSeqNo);
 
         // 1. On submission (addBuffer), the KK flag is set to EK_NOENC (0).
         // 2. The readData() is called to get the original (unique) payload not ever sent yet.
@@ -339,18 +617,19 @@ int CSndBuffer::readData(CPacket& w_packet, steady_clock::time_point& w_srctime,
         }
         else
         {
-            m_pCurrBlock->m_iMsgNoBitset |= MSGNO_ENCKEYSPEC::wrap(kflgs);
+            p->m_iMsgNoBitset |= MSGNO_ENCKEYSPEC::wrap(kflgs);
         }
 
-        Block* p = m_pCurrBlock;
-        w_packet.set_msgflags(m_pCurrBlock->m_iMsgNoBitset);
-        w_srctime = m_pCurrBlock->m_tsOriginTime;
-        m_pCurrBlock = m_pCurrBlock->m_pNext;
+        w_packet.set_msgflags(p->m_iMsgNoBitset);
+        w_srctime = p->m_tsOriginTime;
+        p->m_tsSentTime = steady_clock::now();
+        m_iCurrPos = incPos(m_iCurrPos);
 
         if ((p->m_iTTL >= 0) && (count_milliseconds(steady_clock::now() - w_srctime) > p->m_iTTL))
         {
             LOGC(bslog.Warn, log << CONID() << "CSndBuffer: skipping packet %" << p->m_iSeqNo << " #" << p->getMsgSeq() << " with TTL=" << p->m_iTTL);
             // Skip this packet due to TTL expiry.
+            markUserBufferDropped(int(p - m_pBlocks));
             readlen = 0;
             ++w_seqnoinc;
             continue;
@@ -370,26 +649,17 @@ int CSndBuffer::readData(CPacket& w_packet, steady_clock::time_point& w_srctime,
 CSndBuffer::time_point CSndBuffer::peekNextOriginal() const
 {
     ScopedLock bufferguard(m_BufLock);
-    if (m_pCurrBlock == m_pLastBlock)
+    if (m_iCurrPos == m_iEndPos)
         return time_point();
 
-    return m_pCurrBlock->m_tsOriginTime;
+    return m_pBlocks[m_iCurrPos].m_tsOriginTime;
 }
 
 int32_t CSndBuffer::getMsgNoAt(const int offset)
 {
     ScopedLock bufferguard(m_BufLock);
 
-    Block* p = m_pFirstBlock;
-
-    if (p)
-    {
-        HLOGC(bslog.Debug,
-              log << "CSndBuffer::getMsgNoAt: FIRST MSG: size=" << p->m_iLength << " %" << p->m_iSeqNo << " #"
-                  << p->getMsgSeq() << " !" << BufferStamp(p->m_pcData, p->m_iLength));
-    }
-
-    if (offset >= m_iCount)
+    if (offset < 0 || offset >= m_iCount)
     {
         // Prevent accessing the last "marker" block
         LOGC(bslog.Error,
@@ -397,27 +667,11 @@ int32_t CSndBuffer::getMsgNoAt(const int offset)
         return SRT_MSGNO_CONTROL;
     }
 
-    // XXX Suboptimal procedure to keep the blocks identifiable
-    // by sequence number. Consider using some circular buffer.
-    int       i;
-    Block* ee SRT_ATR_UNUSED = 0;
-    for (i = 0; i < offset && p; ++i)
-    {
-        ee = p;
-        p  = p->m_pNext;
-    }
-
-    if (!p)
-    {
-        LOGC(bslog.Error,
-             log << "CSndBuffer::getMsgNoAt: IPE: offset=" << offset << " not found, stopped at " << i << " with #"
-                 << (ee ? ee->getMsgSeq() : SRT_MSGNO_NONE));
-        return SRT_MSGNO_CONTROL;
-    }
+    Block* p = &m_pBlocks[incPos(m_iStartPos, offset)];
 
     HLOGC(bslog.Debug,
           log << "CSndBuffer::getMsgNoAt: offset=" << offset << " found, size=" << p->m_iLength << " %" << p->m_iSeqNo
-              << " #" << p->getMsgSeq() << " !" << BufferStamp(p->m_pcData, p->m_iLength));
+              << " #" << p->getMsgSeq() << " !" << BufferStamp(p->payload(), p->m_iLength));
 
     return p->getMsgSeq();
 }
@@ -429,19 +683,14 @@ int CSndBuffer::readData(const int offset, CPacket& w_packet, steady_clock::time
 
     ScopedLock bufferguard(m_BufLock);
 
-    Block* p = m_pFirstBlock;
-
-    // XXX Suboptimal procedure to keep the blocks identifiable
-    // by sequence number. Consider using some circular buffer.
-    for (int i = 0; i < offset && p != m_pLastBlock; ++i)
-    {
-        p = p->m_pNext;
-    }
-    if (p == m_pLastBlock)
+    if (offset < 0 || offset >= m_iCount)
     {
         LOGC(qslog.Error, log << "CSndBuffer::readData: offset " << offset << " too large!");
         return READ_NONE;
     }
+
+    int    pos = incPos(m_iStartPos, offset);
+    Block* p   = &m_pBlocks[pos];
 #if ENABLE_HEAVY_LOGGING
     const int32_t first_seq = p->m_iSeqNo;
     int32_t last_seq = p->m_iSeqNo;
@@ -451,10 +700,10 @@ int CSndBuffer::readData(const int offset, CPacket& w_packet, steady_clock::time
     // already set when it was once sent uniquely.
     SRT_ASSERT(p->m_iSeqNo == w_packet.seqno());
 
-    // Check if the block that is the next candidate to send (m_pCurrBlock pointing) is stale.
+    // Check if the block that is the next candidate to send (m_iCurrPos pointing) is stale.
 
     // If so, then inform the caller that it should first take care of the whole
-    // message (all blocks with that message id). Shift the m_pCurrBlock pointer
+    // message (all blocks with that message id). Shift the m_iCurrPos position
     // to the position past the last of them. Then return -1 and set the
     // msgno bitset packet field to the message id that should be dropped as
     // a whole.
@@ -468,20 +717,21 @@ int CSndBuffer::readData(const int offset, CPacket& w_packet, steady_clock::time
 
     if ((p->m_iTTL >= 0) && (count_milliseconds(steady_clock::now() - p->m_tsOriginTime) > p->m_iTTL))
     {
+        markUserBufferDropped(pos);
         w_drop.msgno = p->getMsgSeq();
         int msglen   = 1;
-        p            = p->m_pNext;
+        pos          = incPos(pos);
         bool move    = false;
-        while (p != m_pLastBlock && w_drop.msgno == p->getMsgSeq())
+        while (pos != m_iEndPos && w_drop.msgno == m_pBlocks[pos].getMsgSeq())
         {
 #if ENABLE_HEAVY_LOGGING
-            last_seq = p->m_iSeqNo;
+            last_seq = m_pBlocks[pos].m_iSeqNo;
 #endif
-            if (p == m_pCurrBlock)
+            if (pos == m_iCurrPos)
                 move = true;
-            p = p->m_pNext;
+            pos = incPos(pos);
             if (move)
-                m_pCurrBlock = p;
+                m_iCurrPos = pos;
             msglen++;
         }
 
@@ -496,16 +746,16 @@ int CSndBuffer::readData(const int offset, CPacket& w_packet, steady_clock::time
         w_drop.seqno[DropRange::BEGIN] = w_packet.seqno();
         w_drop.seqno[DropRange::END] = CSeqNo::incseq(w_packet.seqno(), msglen - 1);
 
-        // Note the rules: here `p` is pointing to the first block AFTER the
+        // Note the rules: here `pos` is pointing to the first block AFTER the
         // message to be dropped, so the end sequence should be one behind
-        // the one for p. Note that the loop rolls until hitting the first
-        // packet that doesn't belong to the message or m_pLastBlock, which
+        // the one for pos. Note that the loop rolls until hitting the first
+        // packet that doesn't belong to the message or m_iEndPos, which
         // is past-the-end for the occupied range in the sender buffer.
-        SRT_ASSERT(w_drop.seqno[DropRange::END] == CSeqNo::decseq(p->m_iSeqNo));
+        SRT_ASSERT(pos == m_iEndPos || w_drop.seqno[DropRange::END] == CSeqNo::decseq(m_pBlocks[pos].m_iSeqNo));
         return READ_DROP;
     }
 
-    w_packet.m_pcData = p->m_pcData;
+    w_packet.m_pcData = p->payload();
     const int readlen = p->m_iLength;
     w_packet.setLength(readlen, m_iBlockLen);
 
@@ -521,6 +771,7 @@ int CSndBuffer::readData(const int offset, CPacket& w_packet, steady_clock::time
     // This function is called when packet retransmission is triggered.
     // Therefore we are setting the rexmit time.
     p->m_tsRexmitTime = steady_clock::now();
+    p->m_tsSentTime = p->m_tsRexmitTime;
 
     HLOGC(qslog.Debug,
           log << CONID() << "CSndBuffer: getting packet %" << p->m_iSeqNo << " as per %" << w_packet.seqno()
@@ -532,38 +783,100 @@ int CSndBuffer::readData(const int offset, CPacket& w_packet, steady_clock::time
 sync::steady_clock::time_point CSndBuffer::getPacketRexmitTime(const int offset)
 {
     ScopedLock bufferguard(m_BufLock);
-    const Block* p = m_pFirstBlock;
+    SRT_ASSERT(offset >= 0 && offset < m_iCount);
+    if (offset < 0 || offset >= m_iCount)
+        return time_point();
 
-    // XXX Suboptimal procedure to keep the blocks identifiable
-    // by sequence number. Consider using some circular buffer.
-    for (int i = 0; i < offset; ++i)
-    {
-        SRT_ASSERT(p);
-        p = p->m_pNext;
-    }
+    return m_pBlocks[incPos(m_iStartPos, offset)].m_tsRexmitTime;
+}
 
-    SRT_ASSERT(p);
-    return p->m_tsRexmitTime;
+sync::steady_clock::time_point CSndBuffer::getPacketSentTime(const int offset)
+{
+    ScopedLock bufferguard(m_BufLock);
+    if (offset < 0 || offset >= m_iCount)
+        return time_point();
+
+    return m_pBlocks[incPos(m_iStartPos, offset)].m_tsSentTime;
 }
 
 void CSndBuffer::ackData(int offset)
 {
     ScopedLock bufferguard(m_BufLock);
 
-    bool move = false;
-    for (int i = 0; i < offset; ++i)
+    releaseFirst(offset);
+
+    updAvgBufSize(steady_clock::now());
+}
+
+void CSndBuffer::releaseFirst(int n, int status)
+{
+    SRT_ASSERT(n >= 0 && n <= m_iCount);
+
+    const int newstart = incPos(m_iStartPos, n);
+
+    // The current position is moved, if it was passed over.
+    if (offPos(m_iStartPos, m_iCurrPos) < n)
+        m_iCurrPos = newstart;
+
+    const int64_t released_bytes = bytesBefore(newstart);
+    m_iBytesCount -= int(released_bytes - bytesBefore(m_iStartPos));
+    m_iStartPos = newstart;
+    m_iCount    = m_iCount - n;
+
+    // User buffers whose all packets have been released are no longer referenced.
+    while (!m_UserBuffers.empty() && m_UserBuffers.front().endbytes <= released_bytes)
     {
-        m_iBytesCount -= m_pFirstBlock->m_iLength;
-        if (m_pFirstBlock == m_pCurrBlock)
-            move = true;
-        m_pFirstBlock = m_pFirstBlock->m_pNext;
+        UserBuffer& ub = m_UserBuffers.front();
+        if (ub.status == SRT_ZC_ACKED)
+            ub.status = status;
+        m_ReleasedUserBuffers.push_back(ub);
+        m_UserBuffers.pop_front();
+        m_bUserBuffersReleased = true;
     }
-    if (move)
-        m_pCurrBlock = m_pFirstBlock;
+}
 
-    m_iCount = m_iCount - offset;
+namespace {
+struct UserBufferEndsBefore
+{
+    bool operator()(int64_t bytes, const CSndBuffer::UserBuffer& ub) const { return bytes < ub.endbytes; }
+};
+}
 
-    updAvgBufSize(steady_clock::now());
+void CSndBuffer::markUserBufferDropped(int pos)
+{
+    if (!m_pBlocks[pos].m_pcUserData)
+        return;
+
+    // The message holding this block is the first one that ends past its beginning.
+    std::deque<UserBuffer>::iterator i =
+        std::upper_bound(m_UserBuffers.begin(), m_UserBuffers.end(), m_pBlocks[pos].m_llBytesBefore, UserBufferEndsBefore());
+    if (i != m_UserBuffers.end())
+        i->status = SRT_ZC_DROPPED;
+}
+
+void CSndBuffer::takeReleasedUserBuffers(std::vector<UserBuffer>& w_released)
+{
+    ScopedLock bufferguard(m_BufLock);
+    w_released.insert(w_released.end(), m_ReleasedUserBuffers.begin(), m_ReleasedUserBuffers.end());
+    m_ReleasedUserBuffers.clear();
+    m_bUserBuffersReleased = false;
+}
+
+void CSndBuffer::releaseAllUserBuffers()
+{
+    ScopedLock bufferguard(m_BufLock);
+    for (std::deque<UserBuffer>::iterator i = m_UserBuffers.begin(); i != m_UserBuffers.end(); ++i)
+    {
+        if (i->status == SRT_ZC_ACKED)
+            i->status = SRT_ZC_CLOSED;
+        m_ReleasedUserBuffers.push_back(*i);
+    }
+    m_bUserBuffersReleased = !m_ReleasedUserBuffers.empty();
+    m_UserBuffers.clear();
+
+    // The blocks must not refer to the user memory anymore.
+    for (int pos = m_iStartPos; pos != m_iEndPos; pos = incPos(pos))
+        m_pBlocks[pos].m_pcUserData = NULL;
 }
 
 int CSndBuffer::getCurrBufSize() const
@@ -571,6 +884,78 @@ int CSndBuffer::getCurrBufSize() const
     return m_iCount;
 }
 
+int CSndBuffer::getFreeBlocks() const
+{
+    ScopedLock bufferguard(m_BufLock);
+
+    // One block is always kept free to tell the full buffer from the empty one.
+    const int free_blocks = m_iSize - 1 - m_iCount;
+    if (!m_pPool)
+        return std::numeric_limits<int>::max();
+
+    const int64_t avail = m_pPool->available();
+    const int64_t chunk_bytes = int64_t(m_pBuffer->m_iSize) * m_iBlockLen;
+    const int64_t more = (avail / chunk_bytes) * m_pBuffer->m_iSize;
+    return int(std::min<int64_t>(std::numeric_limits<int>::max(), free_blocks + more));
+}
+
+void CSndBuffer::releaseIdleStorage()
+{
+    ScopedLock bufferguard(m_BufLock);
+
+    const bool used = m_bUsedSinceCheck;
+    m_bUsedSinceCheck = false;
+    if (used || m_iCount > 0 || m_pBuffer->m_pNext == NULL)
+        return;
+
+    // The buffer is empty: keep only the initial chunk.
+    Buffer* p = m_pBuffer->m_pNext;
+    m_pBuffer->m_pNext = NULL;
+    while (p)
+    {
+        Buffer* next = p->m_pNext;
+        freeChunk(p->m_pcData, p->m_iSize);
+        delete p;
+        p = next;
+    }
+
+    const int size = m_pBuffer->m_iSize;
+    delete[] m_pBlocks;
+    m_pBlocks = new Block[size];
+    char* pc  = m_pBuffer->m_pcData;
+    for (int i = 0; i < size; ++i)
+    {
+        m_pBlocks[i].m_iMsgNoBitset = 0;
+        m_pBlocks[i].m_pcData       = pc;
+        m_pBlocks[i].m_pcUserData   = NULL;
+        pc                         += m_iBlockLen;
+    }
+
+    HLOGC(bslog.Debug, log << "CSndBuffer: idle, shrinking from " << m_iSize << " to " << size << " blocks");
+    m_iSize     = size;
+    m_iStartPos = 0;
+    m_iCurrPos  = 0;
+    m_iEndPos   = 0;
+}
+
+char* CSndBuffer::allocChunk(int blocks, bool force)
+{
+    const size_t size = size_t(blocks) * m_iBlockLen;
+    if (!m_pPool)
+        return new char[size];
+    return m_pPool->allocate(size, force);
+}
+
+void CSndBuffer::freeChunk(char* chunk, int blocks)
+{
+    if (!m_pPool)
+    {
+        delete[] chunk;
+        return;
+    }
+    m_pPool->release(chunk, size_t(blocks) * m_iBlockLen);
+}
+
 int CSndBuffer::getMaxPacketLen() const
 {
     return m_iBlockLen - m_iAuthTagSize;
@@ -629,7 +1014,7 @@ int CSndBuffer::getCurrBufSize(int& w_bytes, int& w_timespan) const
      * Also, if there is only one pkt in buffer, the time difference will be 0.
      * Therefore, always add 1 ms if not empty.
      */
-    w_timespan = 0 < m_iCount ? (int) count_milliseconds(m_tsLastOriginTime - m_pFirstBlock->m_tsOriginTime) + 1 : 0;
+    w_timespan = 0 < m_iCount ? (int) count_milliseconds(m_tsLastOriginTime - m_pBlocks[m_iStartPos].m_tsOriginTime) + 1 : 0;
 
     return m_iCount;
 }
@@ -637,40 +1022,27 @@ int CSndBuffer::getCurrBufSize(int& w_bytes, int& w_timespan) const
 CSndBuffer::duration CSndBuffer::getBufferingDelay(const time_point& tnow) const
 {
     ScopedLock lck(m_BufLock);
-    SRT_ASSERT(m_pFirstBlock);
     if (m_iCount == 0)
         return duration(0);
 
-    return tnow - m_pFirstBlock->m_tsOriginTime;
+    return tnow - m_pBlocks[m_iStartPos].m_tsOriginTime;
 }
 
 int CSndBuffer::dropLateData(int& w_bytes, int32_t& w_first_msgno, const steady_clock::time_point& too_late_time)
 {
     int     dpkts  = 0;
-    int     dbytes = 0;
-    bool    move   = false;
     int32_t msgno  = 0;
 
     ScopedLock bufferguard(m_BufLock);
-    for (int i = 0; i < m_iCount && m_pFirstBlock->m_tsOriginTime < too_late_time; ++i)
+    for (int pos = m_iStartPos; dpkts < m_iCount && m_pBlocks[pos].m_tsOriginTime < too_late_time; pos = incPos(pos))
     {
         dpkts++;
-        dbytes += m_pFirstBlock->m_iLength;
-        msgno = m_pFirstBlock->getMsgSeq();
-
-        if (m_pFirstBlock == m_pCurrBlock)
-            move = true;
-        m_pFirstBlock = m_pFirstBlock->m_pNext;
-    }
-
-    if (move)
-    {
-        m_pCurrBlock = m_pFirstBlock;
+        msgno = m_pBlocks[pos].getMsgSeq();
     }
-    m_iCount = m_iCount - dpkts;
 
-    m_iBytesCount -= dbytes;
-    w_bytes = dbytes;
+    const int bytes_before = m_iBytesCount;
+    releaseFirst(dpkts, SRT_ZC_DROPPED);
+    w_bytes = bytes_before - m_iBytesCount;
 
     // We report the increased number towards the last ever seen
     // by the loop, as this last one is the last received. So remained
@@ -682,19 +1054,29 @@ int CSndBuffer::dropLateData(int& w_bytes, int32_t& w_first_msgno, const steady_
     return (dpkts);
 }
 
-void CSndBuffer::increase()
+bool CSndBuffer::increase()
 {
     int unitsize = m_pBuffer->m_iSize;
 
-    // new physical buffer
+    // new physical buffer and the reallocated ring of blocks
     Buffer* nbuf = NULL;
+    Block*  nblk = NULL;
     try
     {
-        nbuf           = new Buffer;
-        nbuf->m_pcData = new char[unitsize * m_iBlockLen];
+        nbuf           = new Buffer();
+        nbuf->m_pcData = allocChunk(unitsize, false);
+        if (!nbuf->m_pcData)
+        {
+            delete nbuf;
+            LOGC(bslog.Warn, log << "CSndBuffer: can't grow over " << m_iSize << " blocks, memory limit reached");
+            return false;
+        }
+        nblk           = new Block[m_iSize + unitsize];
     }
     catch (...)
     {
+        if (nbuf && nbuf->m_pcData)
+            freeChunk(nbuf->m_pcData, unitsize);
         delete nbuf;
         throw CUDTException(MJ_SYSTEMRES, MN_MEMORY, 0);
     }
@@ -707,43 +1089,35 @@ void CSndBuffer::increase()
         p = p->m_pNext;
     p->m_pNext = nbuf;
 
-    // new packet blocks
-    Block* nblk = NULL;
-    try
-    {
-        nblk = new Block;
-    }
-    catch (...)
-    {
-        delete nblk;
-        throw CUDTException(MJ_SYSTEMRES, MN_MEMORY, 0);
-    }
-    Block* pb = nblk;
-    for (int i = 1; i < unitsize; ++i)
-    {
-        pb->m_pNext = new Block;
-        pb          = pb->m_pNext;
-    }
-
-    // insert the new blocks onto the existing one
-    pb->m_pNext           = m_pLastBlock->m_pNext;
-    m_pLastBlock->m_pNext = nblk;
+    // Copy all existing blocks starting from the first one, so that the
+    // used blocks land at the beginning of the new ring in the same order.
+    // The free blocks keep their payload memory, too.
+    for (int i = 0; i < m_iSize; ++i)
+        nblk[i] = m_pBlocks[incPos(m_iStartPos, i)];
 
-    pb       = nblk;
     char* pc = nbuf->m_pcData;
-    for (int i = 0; i < unitsize; ++i)
+    for (int i = m_iSize; i < m_iSize + unitsize; ++i)
     {
-        pb->m_pcData = pc;
-        pb           = pb->m_pNext;
+        nblk[i].m_iMsgNoBitset = 0;
+        nblk[i].m_pcData       = pc;
+        nblk[i].m_pcUserData   = NULL;
         pc += m_iBlockLen;
     }
 
+    const int curroff = offPos(m_iStartPos, m_iCurrPos);
+    delete[] m_pBlocks;
+    m_pBlocks   = nblk;
+    m_iStartPos = 0;
+    m_iCurrPos  = curroff;
+    m_iEndPos   = m_iCount;
+
     m_iSize += unitsize;
 
     HLOGC(bslog.Debug,
           log << "CSndBuffer: BUFFER FULL - adding " << (unitsize * m_iBlockLen) << " bytes spread to " << unitsize
               << " blocks"
               << " (total size: " << m_iSize << " bytes)");
+    return true;
 }
 
 } // namespace srt
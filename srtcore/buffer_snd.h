@@ -53,6 +53,9 @@ modified by
 #ifndef INC_SRT_BUFFER_SND_H
 #define INC_SRT_BUFFER_SND_H
 
+#include <deque>
+#include <map>
+#include <vector>
 #include "srt.h"
 #include "packet.h"
 #include "buffer_tools.h"
@@ -71,6 +74,51 @@ modified by
 
 namespace srt {
 
+/// Payload memory for the sender buffers of the sockets sharing
+/// a multiplexer. Chunks given back are kept for reuse by other sockets.
+/// The total memory can be limited: beyond the limit the sender buffers
+/// can't grow until some other socket gives its chunks back.
+class CSndBlockPool
+{
+public:
+    CSndBlockPool();
+    ~CSndBlockPool();
+
+    /// Set the memory limit in bytes (0 for no limit).
+    void setLimit(int64_t limit);
+    int64_t limit() const { return m_llLimit; }
+
+    /// Take a chunk of @a size bytes.
+    /// @param force if true, the limit is not applied (used for the initial
+    ///        chunk of a sender buffer, so that every socket can send).
+    /// @return the chunk or NULL if the limit would be exceeded.
+    char* allocate(size_t size, bool force = false);
+
+    /// Give back a chunk taken with @a allocate().
+    void release(char* chunk, size_t size);
+
+    /// Number of bytes that can still be taken (INT64_MAX if unlimited).
+    int64_t available() const;
+
+    /// Number of bytes currently taken.
+    int64_t used() const;
+
+private:
+    static const size_t MAX_CACHED_CHUNKS = 32;
+
+    void freeCached(size_t need);
+
+    mutable sync::Mutex m_Lock;
+    std::map<size_t, std::vector<char*> > m_FreeChunks; // chunks kept for reuse, by size
+    size_t  m_zCachedChunks;
+    int64_t m_llCachedBytes;
+    int64_t m_llUsedBytes;
+    sync::atomic<int64_t> m_llLimit;
+
+    CSndBlockPool(const CSndBlockPool&);
+    CSndBlockPool& operator=(const CSndBlockPool&);
+};
+
 class CSndBuffer
 {
     typedef sync::steady_clock::time_point time_point;
@@ -87,7 +135,8 @@ public:
     /// @param size initial number of blocks (each block to store one packet payload).
     /// @param maxpld maximum packet payload (including auth tag).
     /// @param authtag auth tag length in bytes (16 for GCM, 0 otherwise).
-    CSndBuffer(int ip_family, int size, int maxpld, int authtag);
+    /// @param pool the pool to take the payload memory from (NULL to allocate it directly).
+    CSndBuffer(int ip_family, int size, int maxpld, int authtag, CSndBlockPool* pool = NULL);
     ~CSndBuffer();
 
 public:
@@ -106,15 +155,58 @@ public:
     /// @param [in] data pointer to the user data block.
     /// @param [in] len size of the block.
     /// @param [inout] w_mctrl Message control data
+    /// @param [in] zerocopy if true, @a data is referenced instead of copied; it must
+    ///             stay valid until reported by @a takeReleasedUserBuffers().
     SRT_ATTR_EXCLUDES(m_BufLock)
-    void addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl);
+    void addBuffer(const char* data, int len, SRT_MSGCTRL& w_mctrl, bool zerocopy = false);
+
+    /// Insert a user buffer gathered from several pieces into the sending list.
+    /// The same as @a addBuffer(), except that the data are taken from
+    /// the consecutive buffers of @a iov, up to @a len bytes in total.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    void addBufferv(const SRT_IOVEC* iov, int iovcnt, int len, SRT_MSGCTRL& w_mctrl);
+
+    /// Insert several user buffers into the sending list at once, like
+    /// @a addBuffer() called for each of them. The @a pktseq field of every
+    /// message is set to the sequence number of its first packet.
+    /// @param [inout] w_msgs messages to add (mctrl is used as in @a addBuffer())
+    /// @param [in] n number of messages
+    /// @param [in] seqno sequence number for the first packet of the first message
+    /// @return sequence number to be stamped on the next packet
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    int32_t addBuffers(SRT_MSGVEC* w_msgs, int n, int32_t seqno);
 
     /// Read a block of data from file and insert it into the sending list.
     /// @param [in] ifs input file stream.
     /// @param [in] len size of the block.
+    /// @param [inout] w_seqno sequence number for the first packet, on output
+    ///                the sequence number to be stamped on the next packet.
     /// @return actual size of data added from the file.
     SRT_ATTR_EXCLUDES(m_BufLock)
-    int addBufferFromFile(std::fstream& ifs, int len);
+    int addBufferFromFile(std::fstream& ifs, int len, int32_t& w_seqno);
+
+    /// Read a block of data from a file descriptor at given position and insert
+    /// it into the sending list. The data are read directly into the blocks and
+    /// the file offset of @a fd is not changed (pread).
+    /// @param [in] fd input file descriptor.
+    /// @param [in] offset position in the file to read from.
+    /// @param [in] len size of the block.
+    /// @param [inout] w_seqno as in @a addBufferFromFile().
+    /// @return actual size of data added from the file, -1 if reading failed.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    int addBufferFromFd(int fd, int64_t offset, int len, int32_t& w_seqno);
+
+    /// Reads up to @a len bytes into @a dst.
+    /// @return the number of bytes read, 0 at the end of data, -1 on error.
+    typedef int copy_from_src_f(char* dst, int len, void* arg);
+
+    /// Read a block of data with @a funcCopyFromSrc directly into the blocks
+    /// and insert it into the sending list as one message. The packets are
+    /// stamped with the sequence numbers starting from @a w_seqno, which is
+    /// then set to the sequence number to be stamped on the next packet.
+    /// @return actual size of data added, -1 if nothing was added because of an error.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    int addBufferFrom(int len, copy_from_src_f funcCopyFromSrc, void* arg, int32_t& w_seqno);
 
     // Special values that can be returned by readData.
     static const int READ_NONE = 0;
@@ -165,6 +257,14 @@ public:
     SRT_ATTR_EXCLUDES(m_BufLock)
     time_point getPacketRexmitTime(const int offset);
 
+    /// Get the time of the latest transmission (original or retransmission) of the DATA packet.
+    /// @param [in] offset offset from the last ACK point (backward sequence number difference)
+    ///
+    /// @return The latest transmission time, or zero time if the packet was never
+    ///         sent or the offset is out of the buffer.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    time_point getPacketSentTime(const int offset);
+
     /// Update the ACK point and may release/unmap/return the user data according to the flag.
     /// @param [in] offset number of packets acknowledged.
     int32_t getMsgNoAt(const int offset);
@@ -175,9 +275,46 @@ public:
     /// @return Current size of the data in the sending list.
     int getCurrBufSize() const;
 
+    /// Number of blocks that can still be added, considering the free
+    /// blocks and the memory the buffer may still take from the pool.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    int getFreeBlocks() const;
+
+    /// Grow the buffer so that @a iNumBlocks blocks can be added.
+    /// @return false if the memory limit of the pool does not allow it.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    bool reserve(int iNumBlocks);
+
+    /// Give back the memory taken for growing, if the buffer has been
+    /// empty since the previous call. To be called periodically, but
+    /// never concurrently with adding the data, as @a addBufferFrom()
+    /// writes to the blocks without the lock.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    void releaseIdleStorage();
+
     SRT_ATTR_EXCLUDES(m_BufLock)
     int dropLateData(int& bytes, int32_t& w_first_msgno, const time_point& too_late_time);
 
+    /// A user buffer added in the zero-copy mode that is no longer referenced.
+    struct UserBuffer
+    {
+        const char* data;
+        int         len;
+        int64_t     endbytes; // value of m_llBytesAdded after this message was added
+        int         status;   // SRT_ZC_STATUS
+    };
+
+    bool hasReleasedUserBuffers() const { return m_bUserBuffersReleased; }
+
+    /// Move out the user buffers released since the last call.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    void takeReleasedUserBuffers(std::vector<UserBuffer>& w_released);
+
+    /// Release all user buffers still referenced, reporting them as SRT_ZC_CLOSED.
+    /// The buffer must not be used for sending after this call.
+    SRT_ATTR_EXCLUDES(m_BufLock)
+    void releaseAllUserBuffers();
+
     void updAvgBufSize(const time_point& time);
     int  getAvgBufSize(int& bytes, int& timespan);
     int  getCurrBufSize(int& bytes, int& timespan) const;
@@ -214,23 +351,53 @@ public:
     void setRateEstimator(const CRateEstimator& other) { m_rateEstimator = other; }
 
 private:
-    void increase();
+    /// Add one more chunk of blocks.
+    /// @return false if the pool limit is reached.
+    bool increase();
+
+    SRT_ATTR_REQUIRES(m_BufLock)
+    bool reserveLocked(int iNumBlocks);
+
+    char* allocChunk(int blocks, bool force);
+    void  freeChunk(char* chunk, int blocks);
+
+    /// The part of @a addBuffer() done under the lock.
+    /// @param [in] tnow time to use as origin time if not given in @a w_mctrl
+    SRT_ATTR_REQUIRES(m_BufLock)
+    void addBufferLocked(const SRT_IOVEC* iov, int iovcnt, int len, SRT_MSGCTRL& w_mctrl, bool zerocopy, const time_point& tnow);
+
+    inline int incPos(int pos, int inc = 1) const { return (pos + inc) % m_iSize; }
+    inline int offPos(int pos1, int pos2) const { return (pos2 >= pos1) ? (pos2 - pos1) : (m_iSize + pos2 - pos1); }
+
+    /// Number of payload bytes added to the buffer before the block at @a pos.
+    /// For the end position this is the total number of bytes ever added.
+    int64_t bytesBefore(int pos) const { return pos == m_iEndPos ? m_llBytesAdded : m_pBlocks[pos].m_llBytesBefore; }
+
+    /// Move the first position by @a n packets, shifting also the current
+    /// position if it was passed over. Updates the packet and byte counters.
+    /// User buffers of the released messages are reported with @a status,
+    /// unless they were already marked dropped.
+    void releaseFirst(int n, int status = SRT_ZC_ACKED);
+
+    /// Mark the user buffer (if any) of the block at @a pos as dropped.
+    void markUserBufferDropped(int pos);
 
 private:
     mutable sync::Mutex m_BufLock; // used to synchronize buffer operation
 
     struct Block
     {
-        char* m_pcData;  // pointer to the data block
-        int   m_iLength; // payload length of the block (excluding auth tag).
+        char* m_pcData;     // pointer to the data block
+        char* m_pcUserData; // pointer to the payload in the user buffer (zero-copy) or NULL
+        int   m_iLength;    // payload length of the block (excluding auth tag).
 
         int32_t    m_iMsgNoBitset; // message number
         int32_t    m_iSeqNo;       // sequence number for scheduling
         time_point m_tsOriginTime; // block origin time (either provided from above or equals the time a message was submitted for sending.
         time_point m_tsRexmitTime; // packet retransmission time
+        time_point m_tsSentTime;   // latest transmission time (original or retransmission)
         int        m_iTTL; // time to live (milliseconds)
-
-        Block* m_pNext; // next block
+        int64_t    m_llBytesBefore; // value of m_llBytesAdded when this block was added
 
         int32_t getMsgSeq()
         {
@@ -241,13 +408,20 @@ private:
             return m_iMsgNoBitset & MSGNO_SEQ::mask;
         }
 
-    } * m_pBlock, *m_pFirstBlock, *m_pCurrBlock, *m_pLastBlock;
+        char* payload() { return m_pcUserData ? m_pcUserData : m_pcData; }
+
+    } * m_pBlocks; // Ring of m_iSize blocks; reallocated when the buffer grows.
 
-    // m_pBlock:         The head pointer
-    // m_pFirstBlock:    The first block
-    // m_pCurrBlock:	 The current block
-    // m_pLastBlock:     The last block (if first == last, buffer is empty)
+    // Positions in m_pBlocks, so that a block at a given offset from the
+    // first one (the last ACK point) is accessed directly.
+    int m_iStartPos; // The first block (oldest not acknowledged)
+    int m_iCurrPos;  // The current block (next to send for the first time)
+    int m_iEndPos;   // Past the last block (if start == end, buffer is empty)
 
+    int64_t m_llBytesAdded; // total number of payload bytes ever added
+
+    // Payload memory of the blocks. Blocks keep pointing to the same
+    // memory when m_pBlocks is reallocated, so the chunks stay in place.
     struct Buffer
     {
         char*   m_pcData; // buffer
@@ -255,8 +429,17 @@ private:
         Buffer* m_pNext;  // next buffer
     } * m_pBuffer;        // physical buffer
 
+    CSndBlockPool* m_pPool; // Memory pool shared with other sockets, or NULL.
+    bool           m_bUsedSinceCheck; // Data added since the last releaseIdleStorage()
+
     int32_t m_iNextMsgNo; // next message number
 
+    // User buffers referenced by blocks, in the order of adding,
+    // and the ones no longer referenced, to be reported to the user.
+    std::deque<UserBuffer>  m_UserBuffers;
+    std::vector<UserBuffer> m_ReleasedUserBuffers;
+    sync::atomic<bool>      m_bUserBuffersReleased;
+
     int m_iSize; // buffer size (number of packets)
     const int m_iBlockLen;  // maximum length of a block holding packet payload and AUTH tag (excluding packet header).
     const int m_iAuthTagSize; // Authentication tag size (if GCM is enabled).
@@ -273,5 +273,120 @@ int CSndRateEstimator::incSampleIdx(int val, int inc) const
     return val;
 }
 
+CSndShaper::CSndShaper(int mss)
+    : m_llRate_Bps(0)
+    // Borrowing beyond the weighted share needs the bucket more than
+    // half full, so it must hold a few packets even at low rates.
+    , m_Root(4 * mss)
+    , m_iPeriod(0)
+    , m_iWeights(0)
+    , m_iPrevWeights(0)
+    , m_llGuaranteedBytes(0)
+    , m_llPrevGuaranteedBytes(0)
+{
+}
+
+void CSndShaper::setRate(int64_t rate_Bps)
+{
+    m_llRate_Bps = rate_Bps;
+    if (rate_Bps <= 0)
+        return;
+
+    m_Root.setBitrate(double(rate_Bps));
+    m_Root.setBurstPeriod(milliseconds_from(ROOT_BURST_MS()));
+}
+
+void CSndShaper::updatePeriod(const time_point& now)
+{
+    if (is_zero(m_tsPeriodStart))
+    {
+        m_tsPeriodStart = now;
+        return;
+    }
+
+    const duration elapsed = now - m_tsPeriodStart;
+    if (elapsed < milliseconds_from(PERIOD_MS()))
+        return;
+
+    // The previous period is only relevant if it has just ended.
+    const bool adjacent = elapsed < milliseconds_from(2 * PERIOD_MS());
+    m_iPrevWeights          = adjacent ? m_iWeights : 0;
+    m_llPrevGuaranteedBytes = adjacent ? m_llGuaranteedBytes : 0;
+    m_iWeights              = 0;
+    m_llGuaranteedBytes     = 0;
+    m_tsPeriodStart         = now;
+    ++m_iPeriod;
+}
+
+bool CSndShaper::allow(Leaf& leaf, int64_t minbw_Bps, int weight, int len, const time_point& now,
+                       bool& w_borrow, time_point& w_retry)
+{
+    updatePeriod(now);
+    m_Root.tick(now);
+
+    if (minbw_Bps > 0)
+    {
+        leaf.m_Guaranteed.setBitrate(double(minbw_Bps));
+        leaf.m_Guaranteed.tick(now);
+        if (leaf.m_Guaranteed.enoughTokens(len))
+        {
+            w_borrow = false;
+            return true;
+        }
+    }
+
+    // The socket takes part in sharing the spare rate in this period.
+    if (leaf.m_iPeriod != m_iPeriod)
+    {
+        leaf.m_iPeriod = m_iPeriod;
+        m_iWeights += weight;
+    }
+
+    // Within its share the socket may take any tokens; beyond its share
+    // only those that the sockets within their shares leave unused.
+    const bool   within_share = now >= leaf.m_tsBorrowEligible;
+    const double reserve      = within_share ? 0 : m_Root.maxTokens() / 2;
+    if (m_Root.enoughTokens(len + reserve))
+    {
+        w_borrow = true;
+        return true;
+    }
+
+    time_point retry = now + m_Root.waitTime(len + reserve);
+    if (!within_share)
+        retry = std::min(retry, std::max(leaf.m_tsBorrowEligible, now + m_Root.waitTime(len)));
+    if (minbw_Bps > 0)
+        retry = std::min(retry, now + leaf.m_Guaranteed.waitTime(len));
+
+    w_retry = std::max(retry, now + microseconds_from(1));
+    return false;
+}
+
+void CSndShaper::consume(Leaf& leaf, int weight, int len, bool borrow, const time_point& now)
+{
+    m_Root.consumeTokens(len);
+
+    if (!borrow)
+    {
+        leaf.m_Guaranteed.consumeTokens(len);
+        m_llGuaranteedBytes += len;
+        return;
+    }
+
+    // Tokens left unused by the others are taken for free.
+    if (now < leaf.m_tsBorrowEligible)
+        return;
+
+    // Space the packets within the share by the weighted share of the rate
+    // not taken by the guarantees, as measured in the previous period.
+    const int    weights    = std::max(std::max(m_iWeights, m_iPrevWeights), weight);
+    const double guaranteed = double(m_llPrevGuaranteedBytes) * 1000 / PERIOD_MS();
+    const double spare_Bps  = std::max(double(m_llRate_Bps) - guaranteed, double(m_llRate_Bps) / 100);
+    const double share_Bps  = spare_Bps * weight / weights;
+
+    // A late packet keeps at most one interval of credit.
+    const duration interval = microseconds_from(int64_t(len * 1000000.0 / share_Bps));
+    leaf.m_tsBorrowEligible = std::max(leaf.m_tsBorrowEligible, now - interval) + interval;
 }
 
+} // namespace srt
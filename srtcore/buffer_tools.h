@@ -310,6 +310,14 @@ public:
     bool enoughTokens(double len) const { return len <= m_tokens; }
     void consumeTokens(double len) { setTokens(m_tokens - len); }
 
+    // Time until there are enough tokens for the given length
+    duration waitTime(double len) const
+    {
+        if (len <= m_tokens)
+            return duration();
+        return tokensToPeriod(m_rate_Bps, len - m_tokens);
+    }
+
 
     // For debug purposes
     int ntokens() const { return m_tokens; }
@@ -325,6 +333,77 @@ public:
     double availRate_Bps() const { return tokenRate_Bps(m_tokens); }
     double usedRate_Bps() const { return tokenRate_Bps(m_tokensCapacity - m_tokens); }
 };
+
+/// Hierarchical token bucket for the data packets of all sockets sending
+/// through one multiplexer. The root bucket limits the aggregate rate
+/// (SRTO_MUXMAXBW). Every socket has a leaf bucket with the rate guaranteed
+/// to it (SRTO_SNDMINBW), which it may use regardless of the other sockets.
+/// Beyond its guarantee a socket borrows from the root what the guarantees
+/// leave free, shared among the borrowing sockets in proportion to their
+/// weights (SRTO_SNDWEIGHT): a socket may borrow at its weighted share of
+/// the spare rate, and more only when the root bucket stays more than half
+/// full, that is when the other sockets don't use their shares.
+///
+/// Used only by the sending thread of the multiplexer.
+class CSndShaper
+{
+public:
+    typedef sync::steady_clock::time_point time_point;
+    typedef sync::steady_clock::duration duration;
+
+    static int ROOT_BURST_MS() { return 10; }
+    static int PERIOD_MS() { return 100; }
+
+    /// Per-socket state.
+    class Leaf
+    {
+        friend class CSndShaper;
+
+        CShaper    m_Guaranteed;       // tokens of the guaranteed rate
+        time_point m_tsBorrowEligible; // earliest time to borrow again
+        int64_t    m_iPeriod;          // the period when the weight was last accounted
+
+    public:
+        Leaf(int mss)
+            : m_Guaranteed(mss)
+            , m_iPeriod(-1)
+        {
+        }
+    };
+
+    CSndShaper(int mss);
+
+    /// Sets the aggregate rate. 0 turns the shaping off.
+    void setRate(int64_t rate_Bps);
+    bool enabled() const { return m_llRate_Bps > 0; }
+
+    /// Checks if a socket may send a packet of the given size now.
+    /// @param [in] leaf socket state
+    /// @param [in] minbw_Bps rate guaranteed to the socket (0 if none)
+    /// @param [in] weight share of the socket in borrowing
+    /// @param [in] len packet size, including headers
+    /// @param [in] now current time
+    /// @param [out] w_borrow true if the packet exceeds the guarantee
+    /// @param [out] w_retry when not allowed, the time to check again
+    /// @return true if allowed; then consume() must follow
+    bool allow(Leaf& leaf, int64_t minbw_Bps, int weight, int len, const time_point& now,
+               bool& w_borrow, time_point& w_retry);
+
+    /// Charges the packet sent after allow().
+    void consume(Leaf& leaf, int weight, int len, bool borrow, const time_point& now);
+
+private:
+    void updatePeriod(const time_point& now);
+
+    int64_t    m_llRate_Bps;
+    CShaper    m_Root;
+    time_point m_tsPeriodStart;
+    int64_t    m_iPeriod;
+    int        m_iWeights;         // sum of the weights of the sockets borrowing in this period
+    int        m_iPrevWeights;     // the same in the previous period
+    int64_t    m_llGuaranteedBytes;     // bytes sent within the guarantees in this period
+    int64_t    m_llPrevGuaranteedBytes; // the same in the previous period
+};
 } // namespace srt
 
 #endif
@@ -24,6 +24,9 @@
 
 #include <string>
 #include <cmath>
+#include <deque>
+#include <map>
+#include <vector>
 
 
 #include "common.h"
@@ -261,6 +264,7 @@ class FileCC : public SrtCongestionControlBase
     steady_clock::time_point m_LastRCTime;      // last rate increase time
     bool m_bSlowStart;          // if in slow start phase
     int32_t m_iLastAck;         // last ACKed seq no
+    int32_t m_iLastRcvdAck;     // last ACK received
     bool m_bLoss;               // if loss happened since last rate increase
     int32_t m_iLastDecSeq;      // max pkt seq no sent out when last decrease happened
     double m_dLastDecPeriod;    // value of pktsndperiod when last decrease happened
@@ -279,6 +283,7 @@ public:
         , m_LastRCTime(steady_clock::now())
         , m_bSlowStart(true)
         , m_iLastAck(parent->sndSeqNo())
+        , m_iLastRcvdAck(parent->sndSeqNo())
         , m_bLoss(false)
         , m_iLastDecSeq(CSeqNo::decseq(m_iLastAck))
         , m_dLastDecPeriod(1)
@@ -346,6 +351,11 @@ private:
     {
         const int ack = arg.get<EventVariant::ACK>();
 
+        // A repeated ACK only brings the SACK ranges, not used here.
+        if (ack == m_iLastRcvdAck)
+            return;
+        m_iLastRcvdAck = ack;
+
         const steady_clock::time_point currtime = steady_clock::now();
         if (count_microseconds(currtime - m_LastRCTime) < m_iRCInterval)
             return;
@@ -617,6 +627,959 @@ private:
 };
 
 
+CubicWindow::CubicWindow(double maxcwnd)
+    : m_dMaxCWnd(maxcwnd)
+    , m_dCWnd(INITIAL_CWND_PKTS)
+    , m_dSSThresh(maxcwnd)
+    , m_dWMax(0)
+    , m_dWLastMax(0)
+    , m_dWEst(0)
+    , m_dK(0)
+{
+}
+
+void CubicWindow::onAck(int acked, double rtt, const steady_clock::time_point& currtime)
+{
+    if (m_dCWnd < m_dSSThresh)
+    {
+        m_dCWnd += acked;
+    }
+    else
+    {
+        if (is_zero(m_tsEpochStart))
+            startEpoch(currtime);
+
+        const double t = count_microseconds(currtime - m_tsEpochStart) / 1000000.0;
+
+        // The window to be reached in one round trip, limited as in RFC 9438 4.2.
+        double target = windowCubic(t + rtt);
+        target = std::max(m_dCWnd, std::min(target, 1.5 * m_dCWnd));
+
+        // Reno-friendly region: grow as AIMD with the same average rate would.
+        m_dWEst += 3 * (1 - beta()) / (1 + beta()) * acked / m_dCWnd;
+
+        if (windowCubic(t) < m_dWEst)
+            m_dCWnd = std::max(m_dCWnd, m_dWEst);
+        else
+            m_dCWnd += (target - m_dCWnd) * acked / m_dCWnd;
+    }
+
+    m_dCWnd = std::min(m_dCWnd, m_dMaxCWnd);
+}
+
+void CubicWindow::reduce()
+{
+    // Fast convergence: when the window didn't get back to its previous
+    // maximum, the flow releases some more bandwidth to the others.
+    if (m_dCWnd < m_dWLastMax)
+        m_dWMax = m_dCWnd * (1 + beta()) / 2;
+    else
+        m_dWMax = m_dCWnd;
+    m_dWLastMax = m_dCWnd;
+
+    m_dCWnd = std::max<double>(m_dCWnd * beta(), MIN_CWND_PKTS);
+    m_dSSThresh = m_dCWnd;
+    m_tsEpochStart = steady_clock::time_point();
+}
+
+void CubicWindow::startEpoch(const steady_clock::time_point& currtime)
+{
+    m_tsEpochStart = currtime;
+    m_dWEst = m_dCWnd;
+    m_dK = m_dWMax > m_dCWnd ? std::pow((m_dWMax - m_dCWnd) / cubeC(), 1.0 / 3) : 0;
+    if (m_dWMax < m_dCWnd)
+        m_dWMax = m_dCWnd;
+}
+
+double CubicWindow::windowCubic(double t) const
+{
+    const double d = t - m_dK;
+    return cubeC() * d * d * d + m_dWMax;
+}
+
+
+/// CUBIC congestion control (RFC 9438), for the file transfers that should
+/// share a link fairly with TCP.
+///
+/// The congestion window grows as a cubic function of the time since the
+/// last congestion event. It quickly returns to the window at which the
+/// loss happened, stays around it, and then probes for more bandwidth.
+/// At low bandwidth-delay products the window grows at least as fast as
+/// a Reno flow would. A congestion event cuts the window by 30%. With fast
+/// convergence, a flow that loses before it gets back to its previous
+/// maximum releases a part of its bandwidth to the new flows.
+///
+/// The window is also spread over the round trip as the sending rate.
+class CubicCC : public SrtCongestionControlBase
+{
+    typedef CubicCC Me; // Required by SSLOT macro
+
+    CubicWindow m_Window;
+
+    int32_t  m_iLastAck;        // last ACK received
+    int      m_iLastSacked;     // selectively acknowledged packets at the last ACK
+    int32_t  m_iLastDecSeq;     // last sent sequence at the last reduction
+
+    int64_t  m_maxSR;
+
+public:
+
+    CubicCC(CUDT* parent)
+        : SrtCongestionControlBase(parent)
+        , m_Window(m_dMaxCWndSize)
+        , m_iLastAck(parent->sndSeqNo())
+        , m_iLastSacked(0)
+        , m_iLastDecSeq(CSeqNo::decseq(parent->sndSeqNo()))
+        , m_maxSR(0)
+    {
+        m_dCWndSize = CubicWindow::INITIAL_CWND_PKTS;
+        m_dPktSndPeriod = 1;
+
+        parent->ConnectSignal(TEV_ACK,        SSLOT(onACK));
+        parent->ConnectSignal(TEV_LOSSREPORT, SSLOT(onLossReport));
+        parent->ConnectSignal(TEV_CHECKTIMER, SSLOT(onRTO));
+
+        HLOGC(cclog.Debug, log << "Creating CubicCC");
+    }
+
+    bool needsQuickACK(const CPacket& pkt) ATR_OVERRIDE
+    {
+        // As in FileCC, an irregular sized packet usually ends a message.
+        return pkt.getLength() < m_parent->maxPayloadSize();
+    }
+
+    void updateBandwidth(int64_t maxbw, int64_t) ATR_OVERRIDE
+    {
+        if (maxbw != 0)
+        {
+            m_maxSR = maxbw;
+            HLOGC(cclog.Debug, log << "CubicCC: updated BW: " << m_maxSR);
+        }
+    }
+
+    SrtCongestion::RexmitMethod rexmitMethod() ATR_OVERRIDE
+    {
+        return SrtCongestion::SRM_LATEREXMIT;
+    }
+
+private:
+    void onACK(ETransmissionEvent, EventVariant arg)
+    {
+        const int32_t ack = arg.get<EventVariant::ACK>();
+        const int sacked = m_parent->sndSackedPkts();
+
+        // Packets both acknowledged and selectively acknowledged count as acked.
+        const int acked = CSeqNo::seqoff(m_iLastAck, ack) + sacked - m_iLastSacked;
+        m_iLastAck = ack;
+        m_iLastSacked = sacked;
+        if (acked <= 0)
+            return;
+
+        m_Window.onAck(acked, rttSeconds(), steady_clock::now());
+        updateControl();
+
+        HLOGC(cclog.Debug, log << "CubicCC: ACK %" << ack << " acked=" << acked << " cwnd=" << m_Window.cwnd()
+                << " ssthresh=" << m_Window.ssthresh() << " wmax=" << m_Window.wmax()
+                << " sndperiod=" << m_dPktSndPeriod << "us");
+    }
+
+    void onLossReport(ETransmissionEvent, EventVariant arg)
+    {
+        const int32_t* losslist = arg.get_ptr();
+        if (arg.get_len() == 0)
+        {
+            LOGC(cclog.Error, log << "IPE: CubicCC: empty loss list!");
+            return;
+        }
+
+        // Only the first loss among the packets sent after the last
+        // reduction starts a new congestion event.
+        const int32_t lossbegin = SEQNO_VALUE::unwrap(losslist[0]);
+        if (CSeqNo::seqcmp(lossbegin, m_iLastDecSeq) <= 0)
+            return;
+
+        HLOGC(cclog.Debug, log << "CubicCC: LOSS at %" << lossbegin);
+        reduce();
+    }
+
+    /// The ACK timeout in file mode is a loss detected late rather than an
+    /// idle link, so it is handled as a congestion event, without dropping
+    /// the window to the minimum as TCP does on its retransmission timeout.
+    void onRTO(ETransmissionEvent, EventVariant arg)
+    {
+        const ECheckTimerStage stg = arg.get<EventVariant::STAGE>();
+        if (stg == TEV_CHT_INIT)
+            return;
+
+        if (CSeqNo::seqcmp(m_parent->sndSeqNo(), m_iLastDecSeq) <= 0)
+            return;
+
+        HLOGC(cclog.Debug, log << "CubicCC: RTO");
+        reduce();
+    }
+
+    void reduce()
+    {
+        m_Window.reduce();
+        m_iLastDecSeq = m_parent->sndSeqNo();
+
+        updateControl();
+
+        HLOGC(cclog.Debug, log << "CubicCC: reduced cwnd=" << m_Window.cwnd() << " wmax=" << m_Window.wmax()
+                << " sndperiod=" << m_dPktSndPeriod << "us");
+    }
+
+    /// The round trip as seen by the window: the full ACKs come once per
+    /// ACK period, so the window must last that long on top of the RTT.
+    double rttSeconds() const
+    {
+        return (m_parent->SRTT() + CUDT::COMM_SYN_INTERVAL_US) / 1000000.0;
+    }
+
+    void updateControl()
+    {
+        // Pace the window over the round trip, with some headroom
+        // so that the window and not the pacing is the limit.
+        const double cwnd = m_Window.cwnd();
+        const double gain = m_Window.slowStart() ? 2.0 : 1.25;
+        m_dPktSndPeriod = rttSeconds() * 1000000.0 / (gain * cwnd);
+
+        // The window limits the span from the ACK to the last sent packet,
+        // so the packets already received past a loss are added on top.
+        m_dCWndSize = std::min(cwnd + m_parent->sndSackedPkts() + m_parent->sndLossLength(), m_dMaxCWndSize);
+
+        if (m_maxSR)
+        {
+            const double minSP = 1000000.0 / (double(m_maxSR) / m_parent->MSS());
+            m_dPktSndPeriod = std::max(m_dPktSndPeriod, minSP);
+        }
+    }
+};
+
+
+LedbatBaseDelay::LedbatBaseDelay(const steady_clock::time_point& start)
+    : m_iIndex(0)
+    , m_tsBucketStart(start)
+{
+    std::fill(m_aiBucket, m_aiBucket + HISTORY, 0);
+}
+
+int LedbatBaseDelay::update(int rtt, const steady_clock::time_point& currtime)
+{
+    if (count_microseconds(currtime - m_tsBucketStart) > BUCKET_US)
+    {
+        m_iIndex = (m_iIndex + 1) % HISTORY;
+        m_aiBucket[m_iIndex] = 0;
+        m_tsBucketStart = currtime;
+    }
+
+    int& bucket = m_aiBucket[m_iIndex];
+    if (bucket == 0 || rtt < bucket)
+        bucket = rtt;
+
+    int base = rtt;
+    for (int i = 0; i < HISTORY; ++i)
+    {
+        if (m_aiBucket[i] != 0)
+            base = std::min(base, m_aiBucket[i]);
+    }
+    return rtt - base;
+}
+
+
+/// Scavenger congestion control after LEDBAT (RFC 6817), for the bulk
+/// transfers that should use only the capacity left by other traffic.
+///
+/// The queuing delay is the RTT measured with ACK/ACKACK minus its minimum
+/// over the last minutes (the base delay). The ACKACK goes through the same
+/// queues as the data, so the queue that this sender builds at the bottleneck
+/// shows up in it. Below the target delay the window grows additively, in
+/// proportion to the distance from the target; above it the window is
+/// reduced multiplicatively as in LEDBAT++, so that the sender backs off
+/// within a few round trips when other flows fill the queue. Loss halves
+/// the window as in TCP.
+class LedbatCC : public SrtCongestionControlBase
+{
+    typedef LedbatCC Me; // Required by SSLOT macro
+
+    enum
+    {
+        INITIAL_CWND_PKTS = 16,
+        MIN_CWND_PKTS     = 2,
+        TARGET_US         = 25 * 1000         // queuing delay to stay under
+    };
+
+    double   m_dCWnd;           // congestion window, in packets in flight
+    bool     m_bSlowStart;
+
+    LedbatBaseDelay m_BaseDelay;
+
+    int32_t  m_iLastAck;        // last ACK received
+    int      m_iLastSacked;     // selectively acknowledged packets at the last ACK
+    int32_t  m_iLastDecSeq;     // last sent sequence at the last reduction on loss
+
+    int64_t  m_maxSR;
+
+public:
+
+    LedbatCC(CUDT* parent)
+        : SrtCongestionControlBase(parent)
+        , m_dCWnd(INITIAL_CWND_PKTS)
+        , m_bSlowStart(true)
+        , m_BaseDelay(steady_clock::now())
+        , m_iLastAck(parent->sndSeqNo())
+        , m_iLastSacked(0)
+        , m_iLastDecSeq(CSeqNo::decseq(parent->sndSeqNo()))
+        , m_maxSR(0)
+    {
+        m_dCWndSize = INITIAL_CWND_PKTS;
+        m_dPktSndPeriod = 1;
+
+        parent->ConnectSignal(TEV_ACK,        SSLOT(onACK));
+        parent->ConnectSignal(TEV_LOSSREPORT, SSLOT(onLossReport));
+        parent->ConnectSignal(TEV_CHECKTIMER, SSLOT(onRTO));
+
+        HLOGC(cclog.Debug, log << "Creating LedbatCC");
+    }
+
+    bool needsQuickACK(const CPacket& pkt) ATR_OVERRIDE
+    {
+        // As in FileCC, an irregular sized packet usually ends a message.
+        return pkt.getLength() < m_parent->maxPayloadSize();
+    }
+
+    void updateBandwidth(int64_t maxbw, int64_t) ATR_OVERRIDE
+    {
+        if (maxbw != 0)
+        {
+            m_maxSR = maxbw;
+            HLOGC(cclog.Debug, log << "LedbatCC: updated BW: " << m_maxSR);
+        }
+    }
+
+    SrtCongestion::RexmitMethod rexmitMethod() ATR_OVERRIDE
+    {
+        return SrtCongestion::SRM_LATEREXMIT;
+    }
+
+private:
+    void onACK(ETransmissionEvent, EventVariant arg)
+    {
+        const int32_t ack = arg.get<EventVariant::ACK>();
+        const int sacked = m_parent->sndSackedPkts();
+
+        // Packets both acknowledged and selectively acknowledged count as acked.
+        const int acked = CSeqNo::seqoff(m_iLastAck, ack) + sacked - m_iLastSacked;
+        m_iLastAck = ack;
+        m_iLastSacked = sacked;
+        if (acked <= 0)
+            return;
+
+        // Until the first measurement the RTT is the initial or the cached
+        // value, which says nothing about the queue on this path.
+        int qdelay = 0;
+        if (m_parent->isRTTMeasured())
+            qdelay = m_BaseDelay.update(m_parent->SRTT(), steady_clock::now());
+
+        if (m_bSlowStart)
+        {
+            m_dCWnd += acked;
+            // Leave early enough not to overshoot the target by much.
+            if (qdelay > TARGET_US / 4)
+                m_bSlowStart = false;
+        }
+        else
+        {
+            const double off_target = double(TARGET_US - qdelay) / TARGET_US;
+            double change = off_target;
+            if (off_target < 0)
+            {
+                // Above the target, decrease in proportion to the window,
+                // by at most a half per round trip.
+                change = std::max(1 + off_target * m_dCWnd, -m_dCWnd / 2);
+            }
+            m_dCWnd += change * acked / m_dCWnd;
+        }
+
+        m_dCWnd = std::max<double>(std::min(m_dCWnd, m_dMaxCWndSize), MIN_CWND_PKTS);
+        updateControl();
+
+        HLOGC(cclog.Debug, log << "LedbatCC: ACK %" << ack << " acked=" << acked << " qdelay=" << qdelay
+                << "us cwnd=" << m_dCWnd << " sndperiod=" << m_dPktSndPeriod << "us");
+    }
+
+    void onLossReport(ETransmissionEvent, EventVariant arg)
+    {
+        const int32_t* losslist = arg.get_ptr();
+        if (arg.get_len() == 0)
+        {
+            LOGC(cclog.Error, log << "IPE: LedbatCC: empty loss list!");
+            return;
+        }
+
+        // Only the first loss among the packets sent after the last
+        // reduction reduces the window again.
+        const int32_t lossbegin = SEQNO_VALUE::unwrap(losslist[0]);
+        if (CSeqNo::seqcmp(lossbegin, m_iLastDecSeq) <= 0)
+            return;
+
+        HLOGC(cclog.Debug, log << "LedbatCC: LOSS at %" << lossbegin);
+        reduce();
+    }
+
+    /// As in CubicCC, the ACK timeout in file mode is a loss detected late.
+    void onRTO(ETransmissionEvent, EventVariant arg)
+    {
+        const ECheckTimerStage stg = arg.get<EventVariant::STAGE>();
+        if (stg == TEV_CHT_INIT)
+            return;
+
+        if (CSeqNo::seqcmp(m_parent->sndSeqNo(), m_iLastDecSeq) <= 0)
+            return;
+
+        HLOGC(cclog.Debug, log << "LedbatCC: RTO");
+        reduce();
+    }
+
+    void reduce()
+    {
+        m_dCWnd = std::max<double>(m_dCWnd / 2, MIN_CWND_PKTS);
+        m_bSlowStart = false;
+        m_iLastDecSeq = m_parent->sndSeqNo();
+
+        updateControl();
+
+        HLOGC(cclog.Debug, log << "LedbatCC: reduced cwnd=" << m_dCWnd << " sndperiod=" << m_dPktSndPeriod << "us");
+    }
+
+    /// The round trip as seen by the window, as in CubicCC.
+    double rttSeconds() const
+    {
+        return (m_parent->SRTT() + CUDT::COMM_SYN_INTERVAL_US) / 1000000.0;
+    }
+
+    void updateControl()
+    {
+        // Pace the window over the round trip, with some headroom
+        // so that the window and not the pacing is the limit.
+        const double gain = m_bSlowStart ? 2.0 : 1.25;
+        m_dPktSndPeriod = rttSeconds() * 1000000.0 / (gain * m_dCWnd);
+
+        // The window limits the span from the ACK to the last sent packet,
+        // so the packets already received past a loss are added on top.
+        m_dCWndSize = std::min(m_dCWnd + m_parent->sndSackedPkts() + m_parent->sndLossLength(), m_dMaxCWndSize);
+
+        if (m_maxSR)
+        {
+            const double minSP = 1000000.0 / (double(m_maxSR) / m_parent->MSS());
+            m_dPktSndPeriod = std::max(m_dPktSndPeriod, minSP);
+        }
+    }
+};
+
+
+/// Model-based congestion control after BBR (Cardwell et al., "BBR:
+/// Congestion-Based Congestion Control", ACM Queue 2016).
+///
+/// The sender estimates the bottleneck bandwidth as the maximum delivery
+/// rate measured over the last rounds, and the propagation delay as the
+/// minimum RTT over the last 10 seconds. The sending rate is the bandwidth
+/// estimate times a gain that depends on the state of the state machine,
+/// and the congestion window is a multiple of the bandwidth-delay product.
+/// Random loss does not slow the sender down.
+///
+/// Delivery-rate samples are taken from the full ACKs. The packets reported
+/// as received by the selective ACK count as delivered, so that the ACK
+/// jumping over a repaired loss does not inflate the sample.
+class BBRCC : public SrtCongestionControlBase
+{
+    typedef BBRCC Me; // Required by SSLOT macro
+
+    enum Mode
+    {
+        BBR_STARTUP,   // Double the rate every round until the bandwidth stops growing
+        BBR_DRAIN,     // Drain the queue built during startup
+        BBR_PROBE_BW,  // Cycle the rate around the bandwidth estimate
+        BBR_PROBE_RTT  // Shrink the window to measure the propagation delay
+    };
+
+    enum
+    {
+        BTLBW_FILTER_ROUNDS = 10,               // bandwidth max filter length
+        GAIN_CYCLE_LEN      = 8,                // number of phases in PROBE_BW
+        MIN_RTT_WINDOW_US   = 10 * 1000 * 1000, // propagation delay min filter length
+        PROBE_RTT_TIME_US   = 200 * 1000,
+        MIN_CWND_PKTS       = 4,
+        INITIAL_CWND_PKTS   = 16
+    };
+
+    Mode     m_Mode;
+    double   m_dPacingGain;
+    double   m_dCWndGain;
+
+    double   m_adBwFilter[BTLBW_FILTER_ROUNDS]; // maximum delivery rate per round, pkts/s
+    double   m_dBtlBw;                          // bottleneck bandwidth estimate, pkts/s
+    int      m_iMinRTT;                         // propagation delay estimate, us
+    steady_clock::time_point m_tsMinRTTStamp;
+
+    int64_t  m_llRound;         // number of round trips so far
+    int64_t  m_llRoundEnd;      // a round ends when this many packets are delivered
+    bool     m_bRoundStart;
+    bool     m_bRoundSampled;   // a delivery-rate sample was taken in this round
+    bool     m_bLastRoundSampled;
+
+    struct Snapshot
+    {
+        steady_clock::time_point time;
+        int64_t delivered;      // packets delivered so far
+        int64_t sent;           // packets sent so far, without retransmissions
+        bool    partial;        // the SACK may not cover all packets received
+    };
+    std::deque<Snapshot> m_Snapshots; // delivery state at every full ACK
+    int64_t  m_llDelivered;
+    int64_t  m_llSent;
+    int32_t  m_iLastAck;        // cumulative ACK at the last snapshot
+    int      m_iLastSacked;     // selectively acknowledged packets at the last snapshot
+    int32_t  m_iLastSentSeq;    // last sent sequence at the last snapshot
+
+    double   m_dFullBw;         // bandwidth that the startup has last grown to
+    int      m_iFullBwCount;    // rounds without significant growth
+    bool     m_bFullPipe;
+
+    int      m_iCycleIndex;
+    steady_clock::time_point m_tsCycleStamp;
+    steady_clock::time_point m_tsProbeRTTDone;
+
+    int64_t  m_maxSR;
+
+    static double highGain() { return 2.885; } // 2/ln(2), doubles the rate every round
+
+    static double cycleGain(int index)
+    {
+        static const double gains[GAIN_CYCLE_LEN] = { 1.25, 0.75, 1, 1, 1, 1, 1, 1 };
+        return gains[index];
+    }
+
+public:
+
+    BBRCC(CUDT* parent)
+        : SrtCongestionControlBase(parent)
+        , m_Mode(BBR_STARTUP)
+        , m_dPacingGain(highGain())
+        , m_dCWndGain(highGain())
+        , m_dBtlBw(0)
+        , m_iMinRTT(0)
+        , m_tsMinRTTStamp(steady_clock::now())
+        , m_llRound(0)
+        , m_llRoundEnd(0)
+        , m_bRoundStart(false)
+        , m_bRoundSampled(false)
+        , m_bLastRoundSampled(false)
+        , m_llDelivered(0)
+        , m_llSent(0)
+        , m_iLastAck(CSeqNo::incseq(parent->sndSeqNo()))
+        , m_iLastSacked(0)
+        , m_iLastSentSeq(parent->sndSeqNo())
+        , m_dFullBw(0)
+        , m_iFullBwCount(0)
+        , m_bFullPipe(false)
+        , m_iCycleIndex(0)
+        , m_maxSR(0)
+    {
+        std::fill(m_adBwFilter, m_adBwFilter + BTLBW_FILTER_ROUNDS, 0.0);
+
+        // Until the first delivery-rate sample, send a window as fast as possible.
+        m_dCWndSize = INITIAL_CWND_PKTS;
+        m_dPktSndPeriod = 1;
+
+        parent->ConnectSignal(TEV_ACK, SSLOT(onACK));
+
+        HLOGC(cclog.Debug, log << "Creating BBRCC");
+    }
+
+    bool needsQuickACK(const CPacket& pkt) ATR_OVERRIDE
+    {
+        // As in FileCC, an irregular sized packet usually ends a message.
+        return pkt.getLength() < m_parent->maxPayloadSize();
+    }
+
+    void updateBandwidth(int64_t maxbw, int64_t) ATR_OVERRIDE
+    {
+        if (maxbw != 0)
+        {
+            m_maxSR = maxbw;
+            HLOGC(cclog.Debug, log << "BBRCC: updated BW: " << m_maxSR);
+        }
+    }
+
+    SrtCongestion::RexmitMethod rexmitMethod() ATR_OVERRIDE
+    {
+        return SrtCongestion::SRM_LATEREXMIT;
+    }
+
+private:
+    void onACK(ETransmissionEvent, EventVariant arg)
+    {
+        const int32_t ack = arg.get<EventVariant::ACK>();
+        const steady_clock::time_point currtime = steady_clock::now();
+
+        updateDelivered(ack);
+        updateRound();
+        updateBtlBw(currtime);
+        updateMinRTT(currtime);
+
+        const int inflight = inFlight(ack);
+        switch (m_Mode)
+        {
+        case BBR_STARTUP:
+            checkFullPipe();
+            if (m_bFullPipe)
+            {
+                m_Mode = BBR_DRAIN;
+                m_dPacingGain = 1 / highGain();
+                m_dCWndGain = highGain();
+            }
+            break;
+
+        case BBR_DRAIN:
+            if (inflight <= bdp(1.0))
+                enterProbeBW(currtime);
+            break;
+
+        case BBR_PROBE_BW:
+            if (count_microseconds(currtime - m_tsCycleStamp) > m_iMinRTT)
+            {
+                m_iCycleIndex = (m_iCycleIndex + 1) % GAIN_CYCLE_LEN;
+                m_tsCycleStamp = currtime;
+                m_dPacingGain = cycleGain(m_iCycleIndex);
+            }
+            break;
+
+        case BBR_PROBE_RTT:
+            if (currtime >= m_tsProbeRTTDone && m_bRoundStart)
+            {
+                m_tsMinRTTStamp = currtime;
+                if (m_bFullPipe)
+                {
+                    enterProbeBW(currtime);
+                }
+                else
+                {
+                    m_Mode = BBR_STARTUP;
+                    m_dPacingGain = highGain();
+                    m_dCWndGain = highGain();
+                }
+            }
+            break;
+        }
+
+        updateControl();
+
+        HLOGC(cclog.Debug, log << "BBRCC: mode=" << int(m_Mode) << " btlbw=" << m_dBtlBw << "pkt/s minrtt="
+                << m_iMinRTT << "us inflight=" << inflight << " wndsize=" << m_dCWndSize
+                << " sndperiod=" << m_dPktSndPeriod << "us");
+    }
+
+    void updateDelivered(int32_t ack)
+    {
+        const int sacked   = m_parent->sndSackedPkts();
+        const int32_t sent = m_parent->sndSeqNo();
+
+        // Packets both acknowledged and selectively acknowledged count as delivered.
+        m_llDelivered += CSeqNo::seqoff(m_iLastAck, ack) + sacked - m_iLastSacked;
+        m_llSent      += CSeqNo::seqoff(m_iLastSentSeq, sent);
+        m_iLastAck     = ack;
+        m_iLastSacked  = sacked;
+        m_iLastSentSeq = sent;
+    }
+
+    /// A round ends when everything sent at its start is delivered. It is
+    /// counted by the delivered packets rather than by the cumulative ACK,
+    /// which a single lost packet could hold for several round trips.
+    void updateRound()
+    {
+        m_bRoundStart = false;
+        if (m_llDelivered >= m_llRoundEnd)
+        {
+            ++m_llRound;
+            m_llRoundEnd = m_llSent;
+            m_bRoundStart = true;
+            m_bLastRoundSampled = m_bRoundSampled;
+            m_bRoundSampled = false;
+            m_adBwFilter[m_llRound % BTLBW_FILTER_ROUNDS] = 0;
+        }
+    }
+
+    /// Take a delivery-rate sample over the last propagation delay, and
+    /// update the bandwidth max filter with it. As the samples slide by one
+    /// ACK period, some of them cover exactly a PROBE_BW phase.
+    void updateBtlBw(const steady_clock::time_point& currtime)
+    {
+        const Snapshot now = { currtime, m_llDelivered, m_llSent, m_parent->sndSackPartial() };
+        m_Snapshots.push_back(now);
+
+        const steady_clock::duration window = microseconds_from(std::max<int>(int(CUDT::COMM_SYN_INTERVAL_US), m_iMinRTT));
+
+        // Keep the history of two windows: the delivery interval and the
+        // send interval of the packets delivered in it.
+        while (m_Snapshots.size() > 2 && m_Snapshots[1].time <= currtime - 2 * window)
+            m_Snapshots.pop_front();
+
+        const Snapshot* start = lastBefore(currtime - window);
+        const Snapshot* sndstart = start ? lastBefore(start->time - window) : NULL;
+        // With a partial SACK at the start, the packets that it didn't cover
+        // would be counted as delivered in this interval.
+        if (!sndstart || start->partial)
+            return;
+
+        // Nothing can be delivered faster than it was sent.
+        const double ack_rate = (now.delivered - start->delivered) * 1000000.0 / count_microseconds(now.time - start->time);
+        const double snd_rate = (start->sent - sndstart->sent) * 1000000.0 / count_microseconds(start->time - sndstart->time);
+        const double rate     = std::min(ack_rate, snd_rate);
+        if (rate <= 0)
+            return;
+
+        m_bRoundSampled = true;
+        double& slot = m_adBwFilter[m_llRound % BTLBW_FILTER_ROUNDS];
+        slot = std::max(slot, rate);
+        m_dBtlBw = *std::max_element(m_adBwFilter, m_adBwFilter + BTLBW_FILTER_ROUNDS);
+    }
+
+    const Snapshot* lastBefore(const steady_clock::time_point& tp) const
+    {
+        const Snapshot* found = NULL;
+        for (size_t i = 0; i < m_Snapshots.size() && m_Snapshots[i].time <= tp; ++i)
+            found = &m_Snapshots[i];
+        return found;
+    }
+
+    void updateMinRTT(const steady_clock::time_point& currtime)
+    {
+        const int rtt = m_parent->SRTT();
+        const bool expired = count_microseconds(currtime - m_tsMinRTTStamp) > MIN_RTT_WINDOW_US;
+        if (m_iMinRTT == 0 || rtt <= m_iMinRTT || expired)
+        {
+            m_iMinRTT = rtt;
+            m_tsMinRTTStamp = currtime;
+        }
+
+        if (expired && m_Mode != BBR_PROBE_RTT && m_iMinRTT > 0)
+        {
+            m_Mode = BBR_PROBE_RTT;
+            m_dPacingGain = 1;
+            m_dCWndGain = 1;
+            m_tsProbeRTTDone = currtime + microseconds_from(std::max<int>(PROBE_RTT_TIME_US, m_iMinRTT));
+            HLOGC(cclog.Debug, log << "BBRCC: PROBE_RTT for " << std::max<int>(PROBE_RTT_TIME_US, m_iMinRTT) << "us");
+        }
+    }
+
+    /// Leave the startup when the bandwidth didn't grow by 25% for 3 rounds.
+    /// A round without a sample (e.g. with the SACK truncated) doesn't count.
+    void checkFullPipe()
+    {
+        if (m_bFullPipe || !m_bRoundStart || !m_bLastRoundSampled)
+            return;
+
+        if (m_dBtlBw >= m_dFullBw * 1.25)
+        {
+            m_dFullBw = m_dBtlBw;
+            m_iFullBwCount = 0;
+            return;
+        }
+
+        if (++m_iFullBwCount >= 3)
+        {
+            m_bFullPipe = true;
+            HLOGC(cclog.Debug, log << "BBRCC: STARTUP done at btlbw=" << m_dBtlBw << "pkt/s");
+        }
+    }
+
+    void enterProbeBW(const steady_clock::time_point& currtime)
+    {
+        m_Mode = BBR_PROBE_BW;
+        m_dCWndGain = 2;
+        // Start at any phase but the draining one, so that the
+        // senders sharing a bottleneck don't probe in sync.
+        m_iCycleIndex = genRandomInt(2, GAIN_CYCLE_LEN) % GAIN_CYCLE_LEN;
+        m_dPacingGain = cycleGain(m_iCycleIndex);
+        m_tsCycleStamp = currtime;
+    }
+
+    /// Bandwidth-delay product in packets, times the gain. The receiver
+    /// sends the full ACK once per ACK period, so the delay includes it;
+    /// otherwise the window would stall on links with a short RTT.
+    double bdp(double gain) const
+    {
+        return gain * m_dBtlBw * (m_iMinRTT + CUDT::COMM_SYN_INTERVAL_US) / 1000000.0;
+    }
+
+    /// Packets sent and neither acknowledged nor selectively acknowledged.
+    int inFlight(int32_t ack) const
+    {
+        const int span = CSeqNo::seqoff(ack, m_parent->sndSeqNo()) + 1;
+        return std::max(0, span - m_parent->sndSackedPkts());
+    }
+
+    void updateControl()
+    {
+        if (m_dBtlBw <= 0 || m_iMinRTT <= 0)
+            return;
+
+        m_dPktSndPeriod = 1000000.0 / (m_dPacingGain * m_dBtlBw);
+
+        if (m_Mode == BBR_PROBE_RTT)
+        {
+            m_dCWndSize = MIN_CWND_PKTS;
+        }
+        else
+        {
+            // The window limits the span from the ACK to the last sent packet,
+            // so the packets already received past a loss are added on top.
+            const double target = std::max<double>(bdp(m_dCWndGain), INITIAL_CWND_PKTS);
+            m_dCWndSize = target + m_parent->sndSackedPkts() + m_parent->sndLossLength();
+        }
+        m_dCWndSize = std::min(m_dCWndSize, m_dMaxCWndSize);
+
+        if (m_maxSR)
+        {
+            const double minSP = 1000000.0 / (double(m_maxSR) / m_parent->MSS());
+            m_dPktSndPeriod = std::max(m_dPktSndPeriod, minSP);
+        }
+    }
+};
+
+
+/// Adapter for a controller registered with srt_register_congctl().
+/// The events are passed to the user callbacks and the getters
+/// are queried every time CUDT updates its sending parameters.
+class UserCC : public SrtCongestionControlBase
+{
+    typedef UserCC Me; // Required by SSLOT macro
+
+    SRT_CONGCTL_OPS m_Ops;
+    void*    m_pState;
+    int32_t  m_iLastAck;
+    std::vector<int32_t> m_LossRanges;
+
+public:
+
+    UserCC(CUDT* parent, const SRT_CONGCTL_OPS& ops)
+        : SrtCongestionControlBase(parent)
+        , m_Ops(ops)
+        , m_pState(NULL)
+        , m_iLastAck(CSeqNo::incseq(parent->sndSeqNo()))
+    {
+        // The values used until the user getters say otherwise, as in FileCC.
+        m_dCWndSize = 16;
+        m_dPktSndPeriod = 1;
+
+        SRT_CONGCTL_INFO info;
+        m_pState = m_Ops.create(m_Ops.opaque, &getInfo(info));
+
+        if (m_Ops.on_ack)
+            parent->ConnectSignal(TEV_ACK, SSLOT(onACK));
+        if (m_Ops.on_loss)
+            parent->ConnectSignal(TEV_LOSSREPORT, SSLOT(onLossReport));
+        if (m_Ops.on_timer)
+            parent->ConnectSignal(TEV_CHECKTIMER, SSLOT(onRTO));
+
+        HLOGC(cclog.Debug, log << "Creating UserCC");
+    }
+
+    ~UserCC()
+    {
+        if (m_Ops.destroy)
+            m_Ops.destroy(m_pState);
+    }
+
+    double pktSndPeriod_us() ATR_OVERRIDE
+    {
+        return m_Ops.snd_period_us ? m_Ops.snd_period_us(m_pState) : m_dPktSndPeriod;
+    }
+
+    double cgWindowSize() ATR_OVERRIDE
+    {
+        return m_Ops.cwnd ? std::min(m_Ops.cwnd(m_pState), m_dMaxCWndSize) : m_dCWndSize;
+    }
+
+    int RTO() ATR_OVERRIDE
+    {
+        return m_Ops.rto_us ? int(m_Ops.rto_us(m_pState)) : 0;
+    }
+
+    bool needsQuickACK(const CPacket& pkt) ATR_OVERRIDE
+    {
+        // As in FileCC, an irregular sized packet usually ends a message.
+        return !m_parent->isOPT_TsbPd() && pkt.getLength() < m_parent->maxPayloadSize();
+    }
+
+    SrtCongestion::RexmitMethod rexmitMethod() ATR_OVERRIDE
+    {
+        // The same as the builtin controller for the transmission type.
+        return m_parent->isOPT_TsbPd() ? SrtCongestion::SRM_FASTREXMIT : SrtCongestion::SRM_LATEREXMIT;
+    }
+
+private:
+    SRT_CONGCTL_INFO& getInfo(SRT_CONGCTL_INFO& w_info)
+    {
+        w_info.sock          = m_parent->socketID();
+        w_info.snd_seqno     = m_parent->sndSeqNo();
+        w_info.ack_seqno     = m_iLastAck;
+        w_info.srtt_us       = m_parent->SRTT();
+        w_info.rttvar_us     = m_parent->RTTVar();
+        w_info.delivery_rate = m_parent->deliveryRate();
+        w_info.bandwidth     = m_parent->bandwidth();
+        w_info.mss           = m_parent->MSS();
+        w_info.max_cwnd      = int(m_dMaxCWndSize);
+        w_info.loss_length   = m_parent->sndLossLength();
+        w_info.sacked        = m_parent->sndSackedPkts();
+        return w_info;
+    }
+
+    void onACK(ETransmissionEvent, EventVariant arg)
+    {
+        m_iLastAck = arg.get<EventVariant::ACK>();
+        SRT_CONGCTL_INFO info;
+        m_Ops.on_ack(m_pState, &getInfo(info));
+    }
+
+    void onLossReport(ETransmissionEvent, EventVariant arg)
+    {
+        const int32_t* losslist = arg.get_ptr();
+        const size_t losslist_len = arg.get_len();
+
+        // Decode the loss report into the pairs of the first and the last sequence.
+        m_LossRanges.clear();
+        for (size_t i = 0; i < losslist_len; ++i)
+        {
+            const int32_t lo = SEQNO_VALUE::unwrap(losslist[i]);
+            int32_t hi = lo;
+            if (IsSet(losslist[i], LOSSDATA_SEQNO_RANGE_FIRST) && i + 1 < losslist_len)
+                hi = losslist[++i];
+            m_LossRanges.push_back(lo);
+            m_LossRanges.push_back(hi);
+        }
+
+        if (m_LossRanges.empty())
+            return;
+
+        SRT_CONGCTL_INFO info;
+        m_Ops.on_loss(m_pState, &m_LossRanges[0], int(m_LossRanges.size() / 2), &getInfo(info));
+    }
+
+    void onRTO(ETransmissionEvent, EventVariant arg)
+    {
+        const ECheckTimerStage stg = arg.get<EventVariant::STAGE>();
+        if (stg == TEV_CHT_INIT)
+            return;
+
+        SRT_CONGCTL_INFO info;
+        m_Ops.on_timer(m_pState, stg == TEV_CHT_FASTREXMIT ? SRT_CONGCTL_TIMER_FASTREXMIT : SRT_CONGCTL_TIMER_REXMIT,
+                &getInfo(info));
+    }
+};
+
+
 #undef SSLOT
 
 template <class Target>
@@ -628,17 +1591,94 @@ struct Creator
 SrtCongestion::NamePtr SrtCongestion::congctls[N_CONTROLLERS] =
 {
     {"live", Creator<LiveCC>::Create },
-    {"file", Creator<FileCC>::Create }
+    {"file", Creator<FileCC>::Create },
+    {"bbr",  Creator<BBRCC>::Create },
+    {"cubic", Creator<CubicCC>::Create },
+    {"ledbat", Creator<LedbatCC>::Create }
 };
 
 
-bool SrtCongestion::configure(CUDT* parent)
+namespace {
+
+// Controllers registered with srt_register_congctl().
+struct UserCongctls
 {
-    if (selector == N_CONTROLLERS)
+    Mutex lock;
+    std::map<std::string, SRT_CONGCTL_OPS> ops;
+};
+
+#if HAVE_CXX11
+
+UserCongctls& userCongctls()
+{
+    static UserCongctls instance;
+    return instance;
+}
+
+#else // !HAVE_CXX11
+
+pthread_once_t s_UserCongctlsOnce = PTHREAD_ONCE_INIT;
+
+UserCongctls* getUserCongctls()
+{
+    static UserCongctls instance;
+    return &instance;
+}
+
+UserCongctls& userCongctls()
+{
+    pthread_once(&s_UserCongctlsOnce, reinterpret_cast<void (*)()>(getUserCongctls));
+    return *getUserCongctls();
+}
+
+#endif
+
+} // namespace
+
+bool SrtCongestion::findUser(const std::string& name, SRT_CONGCTL_OPS* w_ops)
+{
+    UserCongctls& u = userCongctls();
+    ScopedLock lk(u.lock);
+    std::map<std::string, SRT_CONGCTL_OPS>::const_iterator i = u.ops.find(name);
+    if (i == u.ops.end())
         return false;
+    if (w_ops)
+        *w_ops = i->second;
+    return true;
+}
 
-    // Found a congctl, so call the creation function
-    congctl = (*congctls[selector].second)(parent);
+bool SrtCongestion::registerUser(const std::string& name, const SRT_CONGCTL_OPS* ops)
+{
+    // "vod" is the alias of "file" accepted by SRTO_CONGESTION.
+    if (find(name) || name == "vod")
+        return false;
+
+    UserCongctls& u = userCongctls();
+    ScopedLock lk(u.lock);
+    if (ops)
+        u.ops[name] = *ops;
+    else
+        u.ops.erase(name);
+    return true;
+}
+
+bool SrtCongestion::configure(CUDT* parent)
+{
+    NamePtr* builtin = find(selector);
+    SRT_CONGCTL_OPS ops;
+    if (builtin)
+    {
+        // Found a congctl, so call the creation function
+        congctl = (*builtin->second)(parent);
+    }
+    else if (findUser(selector, &ops))
+    {
+        congctl = new UserCC(parent, ops);
+    }
+    else
+    {
+        return false;
+    }
 
     // The congctl should have pinned in all events
     // that are of its interest. It's stated that
@@ -16,6 +16,9 @@
 #include <string>
 #include <utility>
 
+#include "srt.h"
+#include "sync.h"
+
 namespace srt {
 
 class CUDT;
@@ -24,18 +27,21 @@ typedef SrtCongestionControlBase* srtcc_create_t(srt::CUDT* parent);
 
 class SrtCongestion
 {
-    // Temporarily changed to linear searching, until this is exposed
-    // for a user-defined controller.
+    // The builtin controllers are searched linearly. The user-defined
+    // ones (see srt_register_congctl) are kept in a separate registry.
     // Note that this is a pointer to function :)
 
-    static const size_t N_CONTROLLERS = 2;
+    static const size_t N_CONTROLLERS = 5;
     // The first/second is to mimic the map.
     typedef struct { const char* first; srtcc_create_t* second; } NamePtr;
     static NamePtr congctls[N_CONTROLLERS];
 
     // This is a congctl container.
     SrtCongestionControlBase* congctl;
-    size_t selector;
+    std::string selector; // Name of the selected controller, empty if none
+
+    // Get a copy of the callbacks of a user-defined controller.
+    static bool findUser(const std::string& name, SRT_CONGCTL_OPS* w_ops);
 
     void Check();
 
@@ -48,7 +54,7 @@ public:
     SrtCongestionControlBase* operator->() { Check(); return congctl; }
 
     // In the beginning it's uninitialized
-    SrtCongestion(): congctl(), selector(N_CONTROLLERS) {}
+    SrtCongestion(): congctl() {}
 
     struct IsName
     {
@@ -66,25 +72,27 @@ public:
 
     static bool exists(const std::string& name)
     {
-        return find(name);
+        return find(name) || findUser(name, NULL);
     }
 
+    /// Register a user-defined controller, or remove it when @a ops is NULL.
+    /// Connections that are already established keep using the old callbacks.
+    /// @return false if @a name is one of the builtin controllers.
+    static bool registerUser(const std::string& name, const SRT_CONGCTL_OPS* ops);
+
     // You can call select() multiple times, until finally
     // the 'configure' method is called.
     bool select(const std::string& name)
     {
-        NamePtr* try_selector = find(name);
-        if (!try_selector)
+        if (!exists(name))
             return false;
-        selector = try_selector - congctls;
+        selector = name;
         return true;
     }
 
     std::string selected_name()
     {
-        if (selector == N_CONTROLLERS)
-            return "";
-        return congctls[selector].first;
+        return selector;
     }
 
     // Copy constructor - important when listener-spawning
@@ -220,6 +228,72 @@ public:
     }
 };
 
+/// The congestion window of CUBIC (RFC 9438), in packets. The time of
+/// every ACK is given by the caller, so that the growth over time does not
+/// depend on the clock.
+class CubicWindow
+{
+public:
+    enum
+    {
+        INITIAL_CWND_PKTS = 16,
+        MIN_CWND_PKTS     = 4
+    };
+
+    static double beta() { return 0.7; }  // multiplicative decrease factor
+    static double cubeC() { return 0.4; } // window growth scale, pkts/s^3
+
+    explicit CubicWindow(double maxcwnd);
+
+    /// Grow the window for @a acked packets acknowledged at @a currtime.
+    /// @param rtt the round trip, in seconds.
+    void onAck(int acked, double rtt, const sync::steady_clock::time_point& currtime);
+
+    /// Cut the window for a congestion event.
+    void reduce();
+
+    double cwnd() const { return m_dCWnd; }
+    double ssthresh() const { return m_dSSThresh; }
+    double wmax() const { return m_dWMax; }
+    bool   slowStart() const { return m_dCWnd < m_dSSThresh; }
+
+private:
+    void startEpoch(const sync::steady_clock::time_point& currtime);
+    double windowCubic(double t) const;
+
+    double m_dMaxCWnd;   // upper limit of the window
+    double m_dCWnd;      // congestion window, in packets in flight
+    double m_dSSThresh;  // slow start threshold
+    double m_dWMax;      // window before the last reduction
+    double m_dWLastMax;  // previous value of m_dWMax, for fast convergence
+    double m_dWEst;      // Reno-friendly window estimate
+    double m_dK;         // time to grow back to m_dWMax, s
+    sync::steady_clock::time_point m_tsEpochStart; // zero until the first ACK after a reduction
+};
+
+/// The base delay of LEDBAT: the minimum RTT kept per bucket of time over
+/// the last few buckets, so that a change of the path is picked up when the
+/// old buckets expire (RFC 6817, 2.4.1).
+class LedbatBaseDelay
+{
+public:
+    enum
+    {
+        HISTORY   = 10,              // filter length, in buckets
+        BUCKET_US = 60 * 1000 * 1000
+    };
+
+    explicit LedbatBaseDelay(const sync::steady_clock::time_point& start);
+
+    /// Update the filter with the RTT sample taken at @a currtime.
+    /// @return how much the sample exceeds the base delay (the queuing delay).
+    int update(int rtt, const sync::steady_clock::time_point& currtime);
+
+private:
+    int m_aiBucket[HISTORY]; // minimum RTT per bucket, 0 if none yet
+    int m_iIndex;
+    sync::steady_clock::time_point m_tsBucketStart;
+};
 
 } // namespace srt
 
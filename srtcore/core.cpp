@@ -57,10 +57,13 @@ modified by
 #include <linux/if.h>
 #endif
 
+#include <sys/types.h>
+#include <sys/stat.h> // fstat
 #include <cmath>
 #include <sstream>
 #include <algorithm>
 #include <iterator>
+#include <limits>
 #include "srt.h"
 #include "access_control.h" // Required for SRT_REJX_FALLBACK
 #include "queue.h"
@@ -167,6 +170,13 @@ struct SrtOptionAction
         flags[SRTO_RCVBUF]             = SRTO_R_PREBIND;
         flags[SRTO_UDP_SNDBUF]         = SRTO_R_PREBIND;
         flags[SRTO_UDP_RCVBUF]         = SRTO_R_PREBIND;
+        flags[SRTO_SNDMEMLIMIT]        = SRTO_R_PREBIND;
+        flags[SRTO_RCVMEMLIMIT]        = SRTO_R_PREBIND;
+        flags[SRTO_PACING]             = SRTO_R_PREBIND;
+        flags[SRTO_MUXMAXBW]           = SRTO_R_PREBIND;
+        flags[SRTO_SNDMINBW]           = SRTO_R_PRE;
+        flags[SRTO_SNDWEIGHT]          = SRTO_R_PRE;
+        flags[SRTO_SCHEDULER]          = SRTO_R_PREBIND;
         flags[SRTO_RENDEZVOUS]         = SRTO_R_PRE;
         flags[SRTO_REUSEADDR]          = SRTO_R_PREBIND;
         flags[SRTO_MAXBW]              = SRTO_POST_SPEC;
@@ -392,6 +402,9 @@ void srt::CUDT::construct()
     m_pSndBuffer           = NULL;
     m_pRcvBuffer           = NULL;
     m_pSndLossList         = NULL;
+    m_pRackSuspects        = NULL;
+    m_iSndSackedPkts       = 0;
+    m_bSndSackPartial      = false;
     m_pRcvLossList         = NULL;
     m_iReorderTolerance    = 0;
     // How many times so far the packet considered lost has been received
@@ -451,6 +464,7 @@ srt::CUDT::CUDT(CUDTSocket* parent)
     // , m_SndRexmitRate(sync::steady_clock::now())
     , m_SndRexmitShaper(CSrtConfig::DEF_MSS)
 #endif
+    , m_SndShaperLeaf(CSrtConfig::DEF_MSS)
     , m_iISN(-1)
     , m_iPeerISN(-1)
 {
@@ -481,6 +495,7 @@ srt::CUDT::CUDT(CUDTSocket* parent, const CUDT& ancestor)
     // , m_SndRexmitRate(sync::steady_clock::now())
     , m_SndRexmitShaper(CSrtConfig::DEF_MSS)
 #endif
+    , m_SndShaperLeaf(CSrtConfig::DEF_MSS)
     , m_iISN(-1)
     , m_iPeerISN(-1)
 {
@@ -516,6 +531,9 @@ srt::CUDT::CUDT(CUDTSocket* parent, const CUDT& ancestor)
 
     // Runtime
     m_pCache = ancestor.m_pCache;
+
+    // Sockets accepted from a listener use its send-complete callback.
+    m_cbSendCompleteHook = ancestor.m_cbSendCompleteHook;
 }
 
 srt::CUDT::~CUDT()
@@ -523,10 +541,19 @@ srt::CUDT::~CUDT()
     // release mutex/condition variables
     destroySynch();
 
+    // Give back the zero-copy user buffers still kept. Nothing can
+    // use the sender buffer anymore when the socket is being deleted.
+    if (m_pSndBuffer)
+    {
+        m_pSndBuffer->releaseAllUserBuffers();
+        notifySendCompletions();
+    }
+
     // destroy the data structures
     delete m_pSndBuffer;
     delete m_pRcvBuffer;
     delete m_pSndLossList;
+    delete m_pRackSuspects;
     delete m_pRcvLossList;
     delete m_pSNode;
     delete m_pRNode;
@@ -649,6 +676,49 @@ void srt::CUDT::getOpt(SRT_SOCKOPT optName, void *optval, int &optlen)
         optlen         = sizeof(int);
         break;
 
+    case SRTO_SNDMEMLIMIT:
+        if (size_t(optlen) < sizeof(m_config.llSndMemLimit))
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+        *(int64_t *)optval = m_config.llSndMemLimit;
+        optlen             = sizeof(int64_t);
+        break;
+
+    case SRTO_RCVMEMLIMIT:
+        if (size_t(optlen) < sizeof(m_config.llRcvMemLimit))
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+        *(int64_t *)optval = m_config.llRcvMemLimit;
+        optlen             = sizeof(int64_t);
+        break;
+
+    case SRTO_PACING:
+        *(int *)optval = m_config.iPacing;
+        optlen         = sizeof(int);
+        break;
+
+    case SRTO_MUXMAXBW:
+        if (size_t(optlen) < sizeof(m_config.llMuxMaxBW))
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+        *(int64_t *)optval = m_config.llMuxMaxBW;
+        optlen             = sizeof(int64_t);
+        break;
+
+    case SRTO_SNDMINBW:
+        if (size_t(optlen) < sizeof(m_config.llSndMinBW))
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+        *(int64_t *)optval = m_config.llSndMinBW;
+        optlen             = sizeof(int64_t);
+        break;
+
+    case SRTO_SNDWEIGHT:
+        *(int *)optval = m_config.iSndWeight;
+        optlen         = sizeof(int);
+        break;
+
+    case SRTO_SCHEDULER:
+        *(int *)optval = m_config.iScheduler;
+        optlen         = sizeof(int);
+        break;
+
     case SRTO_UDP_RCVBUF:
         *(int *)optval = m_config.iUDPRcvBufSize;
         optlen         = sizeof(int);
@@ -1087,6 +1157,8 @@ void srt::CUDT::clearData()
 
     m_bPeerRexmitFlag = false;
 
+    m_bPeerSack = false;
+
     m_RdvState           = CHandShake::RDV_INVALID;
     m_tsRcvPeerStartTime = steady_clock::time_point();
 }
@@ -1103,6 +1175,7 @@ void srt::CUDT::open()
     m_pSNode->m_pUDT      = this;
     m_pSNode->m_tsTimeStamp = steady_clock::now();
     m_pSNode->m_iHeapLoc  = -1;
+    m_pSNode->m_iDeficit  = 0;
 
     if (m_pRNode == NULL)
         m_pRNode = new CRNode;
@@ -1272,6 +1345,9 @@ size_t srt::CUDT::fillSrtHandshake_HSREQ(uint32_t *aw_srtdata, size_t /* srtlen
     // I support SRT_OPT_REXMITFLG. Do you?
     aw_srtdata[SRT_HS_FLAGS] |= SRT_OPT_REXMITFLG;
 
+    // I can send and use selective ACK ranges. Can you?
+    aw_srtdata[SRT_HS_FLAGS] |= SRT_OPT_SACK;
+
     // Declare the API used. The flag is set for "stream" API because
     // the older versions will never set this flag, but all old SRT versions use message API.
     if (!m_config.bMessageAPI)
@@ -1387,6 +1463,10 @@ size_t srt::CUDT::fillSrtHandshake_HSRSP(uint32_t *aw_srtdata, size_t /* srtlen
         HLOGP(cnlog.Debug, "HSRSP/snd: AGENT DOES NOT UNDERSTAND REXMIT flag");
     }
 
+    // Respond with the SACK flag only if the peer has declared it.
+    if (m_bPeerSack)
+        aw_srtdata[SRT_HS_FLAGS] |= SRT_OPT_SACK;
+
     HLOGC(cnlog.Debug,
           log << CONID() << "HSRSP/snd: LATENCY[SND:" << SRT_HS_LATENCY_SND::unwrap(aw_srtdata[SRT_HS_LATENCY])
               << " RCV:" << SRT_HS_LATENCY_RCV::unwrap(aw_srtdata[SRT_HS_LATENCY]) << "] FLAGS["
@@ -2318,6 +2398,8 @@ int srt::CUDT::processSrtMsg_HSREQ(const uint32_t *srtdata, size_t bytelen, uint
     m_bPeerRexmitFlag = IsSet(m_uPeerSrtFlags, SRT_OPT_REXMITFLG);
     HLOGC(cnlog.Debug, log << CONID() << "HSREQ/rcv: peer " << (m_bPeerRexmitFlag ? "UNDERSTANDS" : "DOES NOT UNDERSTAND") << " REXMIT flag");
 
+    m_bPeerSack = IsSet(m_uPeerSrtFlags, SRT_OPT_SACK);
+
     // Check if both use the same API type. Reject if not.
     bool peer_message_api = !IsSet(m_uPeerSrtFlags, SRT_OPT_STREAM);
     if (peer_message_api != m_config.bMessageAPI)
@@ -2599,6 +2681,8 @@ int srt::CUDT::processSrtMsg_HSRSP(const uint32_t *srtdata, size_t bytelen, uint
         HLOGP(cnlog.Debug, "HSRSP/rcv: <1.2.0 Agent DOESN'T understand REXMIT flag");
     }
 
+    m_bPeerSack = IsSet(m_uPeerSrtFlags, SRT_OPT_SACK);
+
     handshakeDone();
 
     return SRT_CMD_NONE;
@@ -5868,6 +5952,7 @@ void srt::CUDT::setInitialRcvSeq(int32_t isn)
 #endif
     m_iRcvLastAckAck = isn;
     m_iRcvCurrSeqNo = CSeqNo::decseq(isn);
+    m_iRcvLastSackSeq = m_iRcvCurrSeqNo;
 
     sync::ScopedLock rb(m_RcvBufferLock);
     if (m_pRcvBuffer)
@@ -5954,12 +6039,14 @@ bool srt::CUDT::prepareBuffers(CUDTException* eout)
                 << " snd-bufsize=" << 32
                 << " authtag=" << authtag);
 
-        m_pSndBuffer = new CSndBuffer(AF_INET, 32, m_iMaxSRTPayloadSize, authtag);
+        m_pSndBuffer = new CSndBuffer(AF_INET, 32, m_iMaxSRTPayloadSize, authtag, m_pSndQueue ? &m_pSndQueue->m_BlockPool : NULL);
         SRT_ASSERT(m_iPeerISN != -1);
         m_pRcvBuffer = new srt::CRcvBuffer(m_iPeerISN, m_config.iRcvBufSize, m_pRcvQueue->m_pUnitQueue, m_config.bMessageAPI);
         // After introducing lite ACK, the sndlosslist may not be cleared in time, so it requires twice a space.
-        m_pSndLossList = new CSndLossList(m_iFlowWindowSize * 2);
-        m_pRcvLossList = new CRcvLossList(m_config.iFlightFlagSize);
+        m_pSndLossList = new CSndLossSet(m_iFlowWindowSize * 2);
+        if (m_config.iRetransmitAlgo == 2)
+            m_pRackSuspects = new CSndLossSet(m_iFlowWindowSize * 2);
+        m_pRcvLossList = new CRcvLossRanges();
     }
     catch (...)
     {
@@ -6871,36 +6958,21 @@ int srt::CUDT::sendmsg(const char *data, int len, int msttl, bool inorder, int64
     return this->sendmsg2(data, len, (mctrl));
 }
 
-// [[using maybe_locked(CUDTGroup::m_GroupLock, m_parent->m_GroupOf != NULL)]]
-// GroupLock is applied when this function is called from inside CUDTGroup::send,
-// which is the only case when the m_parent->m_GroupOf is not NULL.
-int srt::CUDT::sendmsg2(const char *data, int len, SRT_MSGCTRL& w_mctrl)
+void srt::CUDT::checkSendArgs(const char* data, int len, const SRT_MSGCTRL& mctrl)
 {
-    // throw an exception if not connected
-    if (m_bBroken || m_bClosing)
-        throw CUDTException(MJ_CONNECTION, MN_CONNLOST, 0);
-    else if (!m_bConnected || !m_CongCtl.ready())
-        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
-
-    if (len <= 0)
-    {
-        LOGC(aslog.Error, log << CONID() << "INVALID: Data size for sending declared with length: " << len);
-        return 0;
-    }
-
-    if (w_mctrl.msgno != -1) // most unlikely, unless you use balancing groups
+    if (mctrl.msgno != -1) // most unlikely, unless you use balancing groups
     {
-        if (w_mctrl.msgno < 1 || w_mctrl.msgno > MSGNO_SEQ_MAX)
+        if (mctrl.msgno < 1 || mctrl.msgno > MSGNO_SEQ_MAX)
         {
             LOGC(aslog.Error,
-                 log << CONID() << "INVALID forced msgno " << w_mctrl.msgno << ": can be -1 (trap) or <1..."
+                 log << CONID() << "INVALID forced msgno " << mctrl.msgno << ": can be -1 (trap) or <1..."
                      << MSGNO_SEQ_MAX << ">");
             throw CUDTException(MJ_NOTSUP, MN_INVAL);
         }
     }
 
-    int  msttl   = w_mctrl.msgttl;
-    bool inorder = w_mctrl.inorder;
+    int  msttl   = mctrl.msgttl;
+    bool inorder = mctrl.inorder;
 
     // Sendmsg isn't restricted to the congctl type, however the congctl
     // may want to have something to say here.
@@ -6944,6 +7016,163 @@ int srt::CUDT::sendmsg2(const char *data, int len, SRT_MSGCTRL& w_mctrl)
         throw CUDTException(MJ_NOTSUP, MN_XSIZE, 0);
     }
 
+    if (m_config.bMessageAPI && m_bTsbPd && m_pSndBuffer->countNumPacketsRequired(len) > 1)
+    {
+        LOGC(aslog.Error,
+            log << CONID() << "Message length (" << len << ") can't fit into a single data packet ("
+                << m_pSndBuffer->getMaxPacketLen() << " bytes max).");
+        throw CUDTException(MJ_NOTSUP, MN_XSIZE, 0);
+    }
+
+    if (mctrl.srctime && mctrl.srctime < count_microseconds(m_stats.tsStartTime.time_since_epoch()))
+    {
+        LOGC(aslog.Error,
+            log << CONID() << "Wrong source time was provided. Sending is rejected.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI);
+    }
+}
+
+// [[using locked(m_SendLock)]]
+bool srt::CUDT::waitForSndBufferSpace(int iNumPktsRequired)
+{
+    //>>We should not get here if SRT_ENABLE_TLPKTDROP
+    // XXX Check if this needs to be removed, or put to an 'else' condition for m_bTLPktDrop.
+    if (!m_config.bSynSending)
+        throw CUDTException(MJ_AGAIN, MN_WRAVAIL, 0);
+
+    {
+        // wait here during a blocking sending
+        UniqueLock sendblock_lock (m_SendBlockLock);
+
+        // The memory given back to the multiplexer's pool by other sockets
+        // is not signalled, so the space is rechecked periodically, too.
+        const steady_clock::duration recheck = milliseconds_from(SND_POOL_RECHECK_PERIOD_MS);
+        if (m_config.iSndTimeOut < 0)
+        {
+            while (stillConnected() && sndBuffersLeft() < iNumPktsRequired && m_bPeerHealth)
+                m_SendBlockCond.wait_for(sendblock_lock, recheck);
+        }
+        else
+        {
+            const steady_clock::time_point exptime =
+                steady_clock::now() + milliseconds_from(m_config.iSndTimeOut);
+            THREAD_PAUSED();
+            while (stillConnected() && sndBuffersLeft() < iNumPktsRequired && m_bPeerHealth)
+            {
+                const steady_clock::time_point now = steady_clock::now();
+                if (now >= exptime)
+                    break;
+                m_SendBlockCond.wait_until(sendblock_lock, std::min(exptime, now + recheck));
+            }
+            THREAD_RESUMED();
+        }
+    }
+
+    // check the connection status
+    if (m_bBroken || m_bClosing)
+        throw CUDTException(MJ_CONNECTION, MN_CONNLOST, 0);
+    else if (!m_bConnected)
+        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
+    else if (!m_bPeerHealth)
+    {
+        m_bPeerHealth = true;
+        throw CUDTException(MJ_PEERERROR);
+    }
+
+    /*
+     * The code below is to return ETIMEOUT when blocking mode could not get free buffer in time.
+     * If no free buffer available in non-blocking mode, we already returned. If buffer available,
+     * we test twice if this code is outside the else section.
+     * This fix move it in the else (blocking-mode) section
+     */
+    if (sndBuffersLeft() < iNumPktsRequired)
+    {
+        if (m_config.iSndTimeOut >= 0)
+            throw CUDTException(MJ_AGAIN, MN_XMTIMEOUT, 0);
+
+        // XXX This looks very weird here, however most likely
+        // this will happen only in the following case, when
+        // the above loop has been interrupted, which happens when:
+        // 1. The buffers left gets enough for minlen - but this is excluded
+        //    in the first condition here.
+        // 2. In the case of sending timeout, the above loop was interrupted
+        //    due to reaching timeout, but this is excluded by the second
+        //    condition here
+        // 3. The 'stillConnected()' or m_bPeerHealth condition is false, of which:
+        //    - broken/closing status is checked and responded with CONNECTION/CONNLOST
+        //    - not connected status is checked and responded with CONNECTION/NOCONN
+        //    - m_bPeerHealth condition is checked and responded with PEERERROR
+        //
+        // ERGO: never happens?
+        LOGC(aslog.Fatal,
+             log << CONID()
+                 << "IPE: sendmsg: the loop exited, while not enough size, still connected, peer healthy. "
+                    "Impossible.");
+
+        return false;
+    }
+
+    return true;
+}
+
+// [[using locked(m_SendLock)]]
+bool srt::CUDT::reserveSndBuffer(int iNumPktsRequired)
+{
+    // The pool memory seen by sndBuffersLeft() may be taken
+    // by another socket before this buffer gets it.
+    while (!m_pSndBuffer->reserve(iNumPktsRequired))
+    {
+        HLOGC(aslog.Debug, log << CONID() << "reserveSndBuffer: no memory in the pool for " << iNumPktsRequired
+                << " packets, waiting");
+        if (!waitForSndBufferSpace(iNumPktsRequired))
+            return false;
+    }
+    return true;
+}
+
+// [[using maybe_locked(CUDTGroup::m_GroupLock, m_parent->m_GroupOf != NULL)]]
+// GroupLock is applied when this function is called from inside CUDTGroup::send,
+// which is the only case when the m_parent->m_GroupOf is not NULL.
+int srt::CUDT::sendmsg2(const char *data, int len, SRT_MSGCTRL& w_mctrl, bool zerocopy)
+{
+    SRT_IOVEC iov;
+    iov.iov_base = const_cast<char*>(data);
+    iov.iov_len  = len > 0 ? size_t(len) : 0;
+    return sendmsgv(&iov, 1, (w_mctrl), zerocopy);
+}
+
+int srt::CUDT::sendmsgv(const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL& w_mctrl, bool zerocopy)
+{
+    // throw an exception if not connected
+    if (m_bBroken || m_bClosing)
+        throw CUDTException(MJ_CONNECTION, MN_CONNLOST, 0);
+    else if (!m_bConnected || !m_CongCtl.ready())
+        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
+
+    if (iovcnt <= 0 || !iov)
+    {
+        LOGC(aslog.Error, log << CONID() << "INVALID: Number of buffers for sending: " << iovcnt);
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+    }
+
+    // The first piece stands for the whole message in the checks and logs.
+    const char* data = static_cast<const char*>(iov[0].iov_base);
+    size_t total = 0;
+    for (int i = 0; i < iovcnt; ++i)
+        total += iov[i].iov_len;
+
+    if (total > size_t(std::numeric_limits<int>::max()))
+        throw CUDTException(MJ_NOTSUP, MN_XSIZE, 0);
+    const int len = int(total);
+
+    if (len <= 0)
+    {
+        LOGC(aslog.Error, log << CONID() << "INVALID: Data size for sending declared with length: " << len);
+        return 0;
+    }
+
+    checkSendArgs(data, len, w_mctrl);
+
     /* XXX
        This might be worth preserving for several occasions, but it
        must be at least conditional because it breaks backward compat.
@@ -6973,88 +7202,8 @@ int srt::CUDT::sendmsg2(const char *data, int len, SRT_MSGCTRL& w_mctrl)
     // Otherwise it is allowed to send less bytes.
     const int iNumPktsRequired = m_config.bMessageAPI ? m_pSndBuffer->countNumPacketsRequired(len) : 1;
 
-    if (m_bTsbPd && iNumPktsRequired > 1)
-    {
-        LOGC(aslog.Error,
-            log << CONID() << "Message length (" << len << ") can't fit into a single data packet ("
-                << m_pSndBuffer->getMaxPacketLen() << " bytes max).");
-        throw CUDTException(MJ_NOTSUP, MN_XSIZE, 0);
-    }
-
-    if (sndBuffersLeft() < iNumPktsRequired)
-    {
-        //>>We should not get here if SRT_ENABLE_TLPKTDROP
-        // XXX Check if this needs to be removed, or put to an 'else' condition for m_bTLPktDrop.
-        if (!m_config.bSynSending)
-            throw CUDTException(MJ_AGAIN, MN_WRAVAIL, 0);
-
-        {
-            // wait here during a blocking sending
-            UniqueLock sendblock_lock (m_SendBlockLock);
-
-            if (m_config.iSndTimeOut < 0)
-            {
-                while (stillConnected() && sndBuffersLeft() < iNumPktsRequired && m_bPeerHealth)
-                    m_SendBlockCond.wait(sendblock_lock);
-            }
-            else
-            {
-                const steady_clock::time_point exptime =
-                    steady_clock::now() + milliseconds_from(m_config.iSndTimeOut);
-                THREAD_PAUSED();
-                while (stillConnected() && sndBuffersLeft() < iNumPktsRequired && m_bPeerHealth)
-                {
-                    if (!m_SendBlockCond.wait_until(sendblock_lock, exptime))
-                        break;
-                }
-                THREAD_RESUMED();
-            }
-        }
-
-        // check the connection status
-        if (m_bBroken || m_bClosing)
-            throw CUDTException(MJ_CONNECTION, MN_CONNLOST, 0);
-        else if (!m_bConnected)
-            throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
-        else if (!m_bPeerHealth)
-        {
-            m_bPeerHealth = true;
-            throw CUDTException(MJ_PEERERROR);
-        }
-
-        /*
-         * The code below is to return ETIMEOUT when blocking mode could not get free buffer in time.
-         * If no free buffer available in non-blocking mode, we already returned. If buffer available,
-         * we test twice if this code is outside the else section.
-         * This fix move it in the else (blocking-mode) section
-         */
-        if (sndBuffersLeft() < iNumPktsRequired)
-        {
-            if (m_config.iSndTimeOut >= 0)
-                throw CUDTException(MJ_AGAIN, MN_XMTIMEOUT, 0);
-
-            // XXX This looks very weird here, however most likely
-            // this will happen only in the following case, when
-            // the above loop has been interrupted, which happens when:
-            // 1. The buffers left gets enough for minlen - but this is excluded
-            //    in the first condition here.
-            // 2. In the case of sending timeout, the above loop was interrupted
-            //    due to reaching timeout, but this is excluded by the second
-            //    condition here
-            // 3. The 'stillConnected()' or m_bPeerHealth condition is false, of which:
-            //    - broken/closing status is checked and responded with CONNECTION/CONNLOST
-            //    - not connected status is checked and responded with CONNECTION/NOCONN
-            //    - m_bPeerHealth condition is checked and responded with PEERERROR
-            //
-            // ERGO: never happens?
-            LOGC(aslog.Fatal,
-                 log << CONID()
-                     << "IPE: sendmsg: the loop exited, while not enough size, still connected, peer healthy. "
-                        "Impossible.");
-
-            return 0;
-        }
-    }
+    if (sndBuffersLeft() < iNumPktsRequired && !waitForSndBufferSpace(iNumPktsRequired))
+        return 0;
 
     // If the sender's buffer is empty,
     // record total time used for sending
@@ -7074,6 +7223,11 @@ int srt::CUDT::sendmsg2(const char *data, int len, SRT_MSGCTRL& w_mctrl)
         size = min(len, sndBuffersLeft() * m_iMaxSRTPayloadSize);
     }
 
+    // Adding to the buffer must not fail halfway, nor should a blocking
+    // sender get an error when the pool memory was taken in the meantime.
+    if (!reserveSndBuffer(m_pSndBuffer->countNumPacketsRequired(size)))
+        return 0;
+
     {
         ScopedLock recvAckLock(m_RecvAckLock);
         // insert the user buffer into the sending list
@@ -7115,14 +7269,7 @@ int srt::CUDT::sendmsg2(const char *data, int len, SRT_MSGCTRL& w_mctrl)
         HLOGC(aslog.Debug, log << CONID() << "buf:SENDING (BEFORE) srctime:"
                 << (w_mctrl.srctime ? FormatTime(ts_srctime) : "none")
                 << " DATA SIZE: " << size << " sched-SEQUENCE: " << seqno
-                << " STAMP: " << BufferStamp(data, size));
-
-        if (w_mctrl.srctime && w_mctrl.srctime < count_microseconds(m_stats.tsStartTime.time_since_epoch()))
-        {
-            LOGC(aslog.Error,
-                log << CONID() << "Wrong source time was provided. Sending is rejected.");
-            throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI);
-        }
+                << " STAMP: " << BufferStamp(data, std::min(size_t(size), iov[0].iov_len)));
 
         if (w_mctrl.srctime && (!m_config.bMessageAPI || !m_bTsbPd))
         {
@@ -7138,13 +7285,16 @@ int srt::CUDT::sendmsg2(const char *data, int len, SRT_MSGCTRL& w_mctrl)
         // - OUTPUT: value of the sequence number to be put on the first packet at the next sendmsg2 call.
         // We need to supply to the output the value that was STAMPED ON THE PACKET,
         // which is seqno. In the output we'll get the next sequence number.
-        m_pSndBuffer->addBuffer(data, size, (w_mctrl));
+        if (zerocopy)
+            m_pSndBuffer->addBuffer(data, size, (w_mctrl), true);
+        else
+            m_pSndBuffer->addBufferv(iov, iovcnt, size, (w_mctrl));
         m_iSndNextSeqNo = w_mctrl.pktseq;
         w_mctrl.pktseq = seqno;
 
         HLOGC(aslog.Debug, log << CONID() << "buf:SENDING srctime:" << FormatTime(ts_srctime)
               << " size=" << size << " #" << w_mctrl.msgno << " SCHED %" << orig_seqno
-              << "(>> %" << seqno << ") !" << BufferStamp(data, size));
+              << "(>> %" << seqno << ") !" << BufferStamp(data, std::min(size_t(size), iov[0].iov_len)));
 
         if (sndBuffersLeft() < 1) // XXX Not sure if it should test if any space in the buffer, or as required.
         {
@@ -7170,81 +7320,459 @@ int srt::CUDT::sendmsg2(const char *data, int len, SRT_MSGCTRL& w_mctrl)
     return size;
 }
 
-int srt::CUDT::recv(char* data, int len)
-{
-    SRT_MSGCTRL mctrl = srt_msgctrl_default;
-    return recvmsg2(data, len, (mctrl));
-}
-
-int srt::CUDT::recvmsg(char* data, int len, int64_t& srctime)
-{
-    SRT_MSGCTRL mctrl = srt_msgctrl_default;
-    int res = recvmsg2(data, len, (mctrl));
-    srctime = mctrl.srctime;
-    return res;
-}
-
-// [[using maybe_locked(CUDTGroup::m_GroupLock, m_parent->m_GroupOf != NULL)]]
-// GroupLock is applied when this function is called from inside CUDTGroup::recv,
-// which is the only case when the m_parent->m_GroupOf is not NULL.
-int srt::CUDT::recvmsg2(char* data, int len, SRT_MSGCTRL& w_mctrl)
+int srt::CUDT::sendmsg_zc(const char* data, int len, SRT_MSGCTRL& w_mctrl)
 {
-    // Check if the socket is a member of a receiver group.
-    // If so, then reading by receiveMessage is disallowed.
-
-#if ENABLE_BONDING
-    if (m_parent->m_GroupOf && m_parent->m_GroupOf->isGroupReceiver())
+    // Referring to the user buffer is possible only if the whole message
+    // is scheduled at once and nothing on the sending path writes into the
+    // payload, which is the case with the message API without encryption.
+    if (!m_config.bMessageAPI)
     {
-        LOGP(arlog.Error, "recv*: This socket is a receiver group member. Use group ID, NOT socket ID.");
-        throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI, 0);
+        LOGC(aslog.Error, log << CONID() << "sendmsg_zc: zero-copy sending requires the message API.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALBUFFERAPI, 0);
     }
-#endif
 
-    if (!m_bConnected || !m_CongCtl.ready())
-        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
+    if (m_pCryptoControl && m_pCryptoControl->hasPassphrase())
+    {
+        LOGC(aslog.Error, log << CONID() << "sendmsg_zc: zero-copy sending is not possible with encryption.");
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+    }
 
-    if (len <= 0)
+    if (!m_cbSendCompleteHook)
     {
-        LOGC(arlog.Error, log << CONID() << "Length of '" << len << "' supplied to srt_recvmsg.");
+        LOGC(aslog.Error, log << CONID() << "sendmsg_zc: no send-complete callback installed.");
         throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
     }
 
-    if (m_config.bMessageAPI)
-        return receiveMessage(data, len, (w_mctrl));
+    const int size = sendmsg2(data, len, (w_mctrl), true);
 
-    return receiveBuffer(data, len);
+    // Buffers dropped in sendmsg2 as too late could not
+    // be reported there because of the locks applied.
+    notifySendCompletions();
+    return size;
 }
 
-// [[using locked(m_RcvBufferLock)]]
-size_t srt::CUDT::getAvailRcvBufferSizeNoLock() const
+int srt::CUDT::sendmmsg(SRT_MSGVEC* w_msgs, int n)
 {
-    return m_pRcvBuffer->getAvailSize(m_iRcvLastAck);
-}
+    if (m_bBroken || m_bClosing)
+        throw CUDTException(MJ_CONNECTION, MN_CONNLOST, 0);
+    else if (!m_bConnected || !m_CongCtl.ready())
+        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
 
-bool srt::CUDT::isRcvBufferReady() const
-{
-    ScopedLock lck(m_RcvBufferLock);
-    return m_pRcvBuffer->isRcvDataReady(steady_clock::now());
-}
+    // With the stream API a message may be scheduled partially,
+    // which leaves no clear place to continue from.
+    if (!m_config.bMessageAPI)
+    {
+        LOGC(aslog.Error, log << CONID() << "sendmmsg: batch sending requires the message API.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALBUFFERAPI, 0);
+    }
 
-bool srt::CUDT::isRcvBufferReadyNoLock() const
-{
-    return m_pRcvBuffer->isRcvDataReady(steady_clock::now());
-}
+#if ENABLE_BONDING
+    // Group members get their sequence numbers from the group sender.
+    if (m_parent->m_GroupOf)
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+#endif
 
-bool srt::CUDT::isRcvBufferFull() const
-{
-    ScopedLock lck(m_RcvBufferLock);
-    return m_pRcvBuffer->full();
-}
+    if (n <= 0)
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
 
-// int by_exception: accepts values of CUDTUnited::ErrorHandling:
-// - 0 - by return value
-// - 1 - by exception
-// - 2 - by abort (unused)
-int srt::CUDT::receiveMessage(char* data, int len, SRT_MSGCTRL& w_mctrl, int by_exception)
-{
-    // Recvmsg isn't restricted to the congctl type, it's the most
+    for (int i = 0; i < n; ++i)
+    {
+        w_msgs[i].result  = 0;
+        w_msgs[i].errcode = SRT_SUCCESS;
+    }
+
+    UniqueLock sendguard(m_SendLock);
+
+    if (m_pSndBuffer->getCurrBufSize() == 0)
+    {
+        // delay the EXP timer to avoid mis-fired timeout
+        ScopedLock ack_lock(m_RecvAckLock);
+        m_tsLastRspAckTime = steady_clock::now();
+        m_iReXmitCount   = 1;
+    }
+
+    const int iPktsTLDropped SRT_ATR_UNUSED = sndDropTooLate();
+
+    int nsent = 0;
+    try
+    {
+        while (nsent < n)
+        {
+            // The first message of the batch must be scheduled, even if it
+            // requires waiting for space; errors are reported for it.
+            const SRT_MSGVEC& head = w_msgs[nsent];
+            if (head.len <= 0)
+            {
+                LOGC(aslog.Error, log << CONID() << "sendmmsg: INVALID: Data size for sending declared with length: " << head.len);
+                throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+            }
+            checkSendArgs(head.buf, head.len, head.mctrl);
+
+            const int iNumPktsRequired = m_pSndBuffer->countNumPacketsRequired(head.len);
+            if (sndBuffersLeft() < iNumPktsRequired && !waitForSndBufferSpace(iNumPktsRequired))
+                break;
+
+            // Take with it as many following messages as fit into the space
+            // available now. A message that is rejected stops the batch and
+            // gets its error reported when it comes to be the first one.
+            int nbatch = 1;
+            int nleft  = sndBuffersLeft() - iNumPktsRequired;
+            int nbatchpkts = iNumPktsRequired;
+            for (; nsent + nbatch < n; ++nbatch)
+            {
+                const SRT_MSGVEC& m = w_msgs[nsent + nbatch];
+                if (m.len <= 0)
+                    break;
+                const int npkts = m_pSndBuffer->countNumPacketsRequired(m.len);
+                if (npkts > nleft)
+                    break;
+                try
+                {
+                    checkSendArgs(m.buf, m.len, m.mctrl);
+                }
+                catch (const CUDTException&)
+                {
+                    break;
+                }
+                nleft -= npkts;
+                nbatchpkts += npkts;
+            }
+
+            if (!reserveSndBuffer(nbatchpkts))
+                break;
+
+            if (m_pSndBuffer->getCurrBufSize() == 0)
+            {
+                ScopedLock lock(m_StatsLock);
+                m_stats.sndDurationCounter = steady_clock::now();
+            }
+
+            {
+                ScopedLock recvAckLock(m_RecvAckLock);
+                if (!m_bTsbPd)
+                {
+                    for (int i = nsent; i < nsent + nbatch; ++i)
+                        w_msgs[i].mctrl.srctime = 0;
+                }
+
+                HLOGC(aslog.Debug, log << CONID() << "sendmmsg: scheduling " << nbatch << " messages from %"
+                        << m_iSndNextSeqNo);
+                m_iSndNextSeqNo = m_pSndBuffer->addBuffers(w_msgs + nsent, nbatch, m_iSndNextSeqNo);
+            }
+
+            for (int i = nsent; i < nsent + nbatch; ++i)
+                w_msgs[i].result = w_msgs[i].len;
+            nsent += nbatch;
+
+            m_pSndQueue->m_pSndUList->update(this, CSndUList::DONT_RESCHEDULE);
+        }
+    }
+    catch (const CUDTException& e)
+    {
+        if (nsent == 0)
+            throw;
+
+        HLOGC(aslog.Debug, log << CONID() << "sendmmsg: stopped at message " << nsent << ": " << e.getErrorMessage());
+        w_msgs[nsent].result  = SRT_ERROR;
+        w_msgs[nsent].errcode = e.getErrorCode();
+    }
+
+    if (sndBuffersLeft() < 1)
+    {
+        // write is not available any more
+        uglobal().m_EPoll.update_events(m_SocketID, m_sPollID, SRT_EPOLL_OUT, false);
+    }
+
+    HLOGC(aslog.Debug, log << CONID() << "sock:SENDING (END): " << nsent << "/" << n << " messages scheduled");
+    return nsent;
+}
+
+void srt::CUDT::notifySendCompletions()
+{
+    if (!m_pSndBuffer->hasReleasedUserBuffers())
+        return;
+
+    vector<CSndBuffer::UserBuffer> released;
+    m_pSndBuffer->takeReleasedUserBuffers((released));
+
+    if (!m_cbSendCompleteHook)
+        return;
+
+    for (size_t i = 0; i < released.size(); ++i)
+    {
+        HLOGC(aslog.Debug, log << CONID() << "sendmsg_zc: releasing buffer " << (void*)released[i].data
+                << " size=" << released[i].len << " status=" << released[i].status);
+        CALLBACK_CALL(m_cbSendCompleteHook, m_SocketID, released[i].data, released[i].len, released[i].status);
+    }
+}
+
+int srt::CUDT::recv(char* data, int len)
+{
+    SRT_MSGCTRL mctrl = srt_msgctrl_default;
+    return recvmsg2(data, len, (mctrl));
+}
+
+int srt::CUDT::recvmsg(char* data, int len, int64_t& srctime)
+{
+    SRT_MSGCTRL mctrl = srt_msgctrl_default;
+    int res = recvmsg2(data, len, (mctrl));
+    srctime = mctrl.srctime;
+    return res;
+}
+
+// [[using maybe_locked(CUDTGroup::m_GroupLock, m_parent->m_GroupOf != NULL)]]
+// GroupLock is applied when this function is called from inside CUDTGroup::recv,
+// which is the only case when the m_parent->m_GroupOf is not NULL.
+int srt::CUDT::recvmsg2(char* data, int len, SRT_MSGCTRL& w_mctrl)
+{
+    // Check if the socket is a member of a receiver group.
+    // If so, then reading by receiveMessage is disallowed.
+
+#if ENABLE_BONDING
+    if (m_parent->m_GroupOf && m_parent->m_GroupOf->isGroupReceiver())
+    {
+        LOGP(arlog.Error, "recv*: This socket is a receiver group member. Use group ID, NOT socket ID.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI, 0);
+    }
+#endif
+
+    if (!m_bConnected || !m_CongCtl.ready())
+        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
+
+    if (len <= 0)
+    {
+        LOGC(arlog.Error, log << CONID() << "Length of '" << len << "' supplied to srt_recvmsg.");
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+    }
+
+    if (m_config.bMessageAPI)
+        return receiveMessage(data, len, (w_mctrl));
+
+    return receiveBuffer(data, len);
+}
+
+int srt::CUDT::recvmsgv(const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL& w_mctrl)
+{
+#if ENABLE_BONDING
+    if (m_parent->m_GroupOf && m_parent->m_GroupOf->isGroupReceiver())
+    {
+        LOGP(arlog.Error, "recv*: This socket is a receiver group member. Use group ID, NOT socket ID.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI, 0);
+    }
+#endif
+
+    if (!m_bConnected || !m_CongCtl.ready())
+        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
+
+    if (iovcnt <= 0 || !iov)
+    {
+        LOGC(arlog.Error, log << CONID() << "Number of buffers '" << iovcnt << "' supplied to srt_recvmsgv.");
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+    }
+
+    if (!m_config.bMessageAPI)
+    {
+        LOGC(arlog.Error, log << CONID() << "recvmsgv: scattering requires the message API.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALBUFFERAPI, 0);
+    }
+
+    return receiveMessage(NULL, iovcnt, (w_mctrl), CUDTUnited::ERH_THROW, NULL, iov);
+}
+
+// [[using locked(m_RcvBufferLock)]]
+size_t srt::CUDT::getAvailRcvBufferSizeNoLock() const
+{
+    return m_pRcvBuffer->getAvailSize(m_iRcvLastAck);
+}
+
+// [[using locked(m_RcvBufferLock)]]
+size_t srt::CUDT::getRcvFlowWindowNoLock() const
+{
+    const size_t avail = getAvailRcvBufferSizeNoLock();
+    const int    share_left = m_pRcvBuffer->getMemShareLeft();
+    return std::min(avail, size_t(share_left));
+}
+
+bool srt::CUDT::isRcvMemThrottled() const
+{
+    return m_pRcvBuffer && m_pRcvBuffer->getMemShareLeft() == 0;
+}
+
+bool srt::CUDT::isRcvBufferReady() const
+{
+    ScopedLock lck(m_RcvBufferLock);
+    return m_pRcvBuffer->isRcvDataReady(steady_clock::now());
+}
+
+bool srt::CUDT::isRcvBufferReadyNoLock() const
+{
+    return m_pRcvBuffer->isRcvDataReady(steady_clock::now());
+}
+
+bool srt::CUDT::isRcvBufferFull() const
+{
+    ScopedLock lck(m_RcvBufferLock);
+    return m_pRcvBuffer->full();
+}
+
+// int by_exception: accepts values of CUDTUnited::ErrorHandling:
+// - 0 - by return value
+// - 1 - by exception
+// - 2 - by abort (unused)
+int srt::CUDT::recvmsg_zc(SRT_PKTVIEW* w_views, int nviews, SRT_MSGCTRL& w_mctrl)
+{
+#if ENABLE_BONDING
+    if (m_parent->m_GroupOf && m_parent->m_GroupOf->isGroupReceiver())
+    {
+        LOGP(arlog.Error, "recvmsg_zc: This socket is a receiver group member. Zero-copy reading is not supported.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI, 0);
+    }
+#endif
+
+    if (!m_bConnected || !m_CongCtl.ready())
+        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
+
+    if (!m_config.bMessageAPI)
+    {
+        LOGC(arlog.Error, log << CONID() << "recvmsg_zc: zero-copy reading requires the message API.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALBUFFERAPI, 0);
+    }
+
+    if (nviews <= 0 || !w_views)
+    {
+        LOGC(arlog.Error, log << CONID() << "Number of views '" << nviews << "' supplied to srt_recvmsg_zc.");
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+    }
+
+    return receiveMessage(NULL, nviews, (w_mctrl), CUDTUnited::ERH_THROW, w_views);
+}
+
+int srt::CUDT::recvmmsg(SRT_MSGVEC* w_msgs, int n, int msTimeOut)
+{
+#if ENABLE_BONDING
+    if (m_parent->m_GroupOf && m_parent->m_GroupOf->isGroupReceiver())
+    {
+        LOGP(arlog.Error, "recvmmsg: This socket is a receiver group member. Batch reading is not supported.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI, 0);
+    }
+#endif
+
+    if (!m_bConnected || !m_CongCtl.ready())
+        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
+
+    if (!m_config.bMessageAPI)
+    {
+        LOGC(arlog.Error, log << CONID() << "recvmmsg: batch reading requires the message API.");
+        throw CUDTException(MJ_NOTSUP, MN_INVALBUFFERAPI, 0);
+    }
+
+    if (n <= 0 || !w_msgs)
+    {
+        LOGC(arlog.Error, log << CONID() << "Number of messages '" << n << "' supplied to srt_recvmmsg.");
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+    }
+
+    for (int i = 0; i < n; ++i)
+    {
+        if (!m_CongCtl->checkTransArgs(SrtCongestion::STA_MESSAGE, SrtCongestion::STAD_RECV, w_msgs[i].buf, w_msgs[i].len, SRT_MSGTTL_INF, false))
+            throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI, 0);
+        w_msgs[i].result  = 0;
+        w_msgs[i].errcode = SRT_SUCCESS;
+    }
+
+    UniqueLock recvguard (m_RecvLock);
+    CSync tscond     (m_RcvTsbPdCond,  recvguard);
+
+    if (msTimeOut != 0 && stillConnected() && !isRcvBufferReady())
+    {
+        // Wait like receiveMessage does in blocking mode, with the timeout given here.
+        const steady_clock::time_point deadline = steady_clock::now() + milliseconds_from(msTimeOut);
+        CSync recv_cond (m_RecvDataCond, recvguard);
+
+        if (m_bTsbPd)
+            tscond.notify_one_locked(recvguard);
+
+        THREAD_PAUSED();
+        do
+        {
+            // Check the connection status at least every second.
+            steady_clock::time_point exptime = steady_clock::now() + seconds_from(1);
+            if (msTimeOut > 0 && deadline < exptime)
+                exptime = deadline;
+
+            if (!recv_cond.wait_until(exptime) && msTimeOut > 0 && steady_clock::now() >= deadline)
+                break;
+        } while (stillConnected() && !isRcvBufferReady());
+        THREAD_RESUMED();
+    }
+
+    int nread = 0;
+    {
+        ScopedLock lck(m_RcvBufferLock);
+        const steady_clock::time_point now = steady_clock::now();
+        while (nread < n && m_pRcvBuffer->isRcvDataReady(now))
+        {
+            SRT_MSGVEC& m = w_msgs[nread];
+            const int res = m_pRcvBuffer->readMessage(m.buf, m.len, &m.mctrl);
+            if (res <= 0)
+                break;
+            m.result = res;
+            ++nread;
+        }
+    }
+    HLOGC(arlog.Debug, log << CONID() << "recvmmsg: read " << nread << "/" << n << " messages");
+
+    if (!isRcvBufferReady())
+    {
+        // Kick TsbPd thread to schedule next wakeup (if running)
+        if (m_bTsbPd)
+            tscond.notify_one_locked(recvguard);
+
+        // read is not available any more
+        uglobal().m_EPoll.update_events(m_SocketID, m_sPollID, SRT_EPOLL_IN, false);
+    }
+
+    if (nread > 0)
+        return nread;
+
+    if (m_bBroken || m_bClosing)
+        throw CUDTException(MJ_CONNECTION, MN_CONNLOST, 0);
+    if (!m_bConnected)
+        throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
+    if (msTimeOut == 0)
+        throw CUDTException(MJ_AGAIN, MN_RDAVAIL, 0);
+    throw CUDTException(MJ_AGAIN, MN_XMTIMEOUT, 0);
+}
+
+int srt::CUDT::releaseRecvViews(const SRT_PKTVIEW* views, int nviews)
+{
+    if (nviews <= 0 || !views)
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+    ScopedLock lck(m_RcvBufferLock);
+    if (!m_pRcvBuffer)
+        return 0;
+    return m_pRcvBuffer->releaseViews(views, nviews);
+}
+
+// [[using locked(m_RcvBufferLock)]]
+int srt::CUDT::readMessageFromBuffer(char* data, int len, SRT_MSGCTRL& w_mctrl, SRT_PKTVIEW* w_views, const SRT_IOVEC* iov)
+{
+    if (iov)
+        return m_pRcvBuffer->readMessagev(iov, len, &w_mctrl);
+
+    if (!w_views)
+        return m_pRcvBuffer->readMessage(data, len, &w_mctrl);
+
+    const int res = m_pRcvBuffer->readMessageViews(w_views, len, &w_mctrl);
+    if (res < 0)
+        throw CUDTException(MJ_NOTSUP, MN_XSIZE, 0);
+    return res;
+}
+
+int srt::CUDT::receiveMessage(char* data, int len, SRT_MSGCTRL& w_mctrl, int by_exception, SRT_PKTVIEW* w_views, const SRT_IOVEC* iov)
+{
+    // Recvmsg isn't restricted to the congctl type, it's the most
     // basic method of passing the data. You can retrieve data as
     // they come in, however you need to match the size of the buffer.
 
@@ -7255,7 +7783,15 @@ int srt::CUDT::receiveMessage(char* data, int len, SRT_MSGCTRL& w_mctrl, int by_
     // is only used internally, we state that the problem that would be
     // handled by exception here should not happen, and in case if it does,
     // it's a bug to fix, so the exception is nothing wrong.
-    if (!m_CongCtl->checkTransArgs(SrtCongestion::STA_MESSAGE, SrtCongestion::STAD_RECV, data, len, SRT_MSGTTL_INF, false))
+    // With views every packet of the message gets its own view.
+    size_t capacity = w_views ? size_t(len) * m_iMaxSRTPayloadSize : size_t(len);
+    if (iov)
+    {
+        capacity = 0;
+        for (int i = 0; i < len; ++i)
+            capacity += iov[i].iov_len;
+    }
+    if (!m_CongCtl->checkTransArgs(SrtCongestion::STA_MESSAGE, SrtCongestion::STAD_RECV, data, capacity, SRT_MSGTTL_INF, false))
         throw CUDTException(MJ_NOTSUP, MN_INVALMSGAPI, 0);
 
     UniqueLock recvguard (m_RecvLock);
@@ -7277,11 +7813,12 @@ int srt::CUDT::receiveMessage(char* data, int len, SRT_MSGCTRL& w_mctrl, int by_
     if (m_bBroken || m_bClosing)
     {
         HLOGC(arlog.Debug, log << CONID() << "receiveMessage: CONNECTION BROKEN - reading from recv buffer just for formality");
-        enterCS(m_RcvBufferLock);
-        const int res = (m_pRcvBuffer->isRcvDataReady(steady_clock::now()))
-            ? m_pRcvBuffer->readMessage(data, len, &w_mctrl)
-            : 0;
-        leaveCS(m_RcvBufferLock);
+        int res = 0;
+        {
+            ScopedLock lck(m_RcvBufferLock);
+            if (m_pRcvBuffer->isRcvDataReady(steady_clock::now()))
+                res = readMessageFromBuffer(data, len, (w_mctrl), w_views, iov);
+        }
 
         // Kick TsbPd thread to schedule next wakeup (if running)
         if (m_bTsbPd)
@@ -7316,11 +7853,12 @@ int srt::CUDT::receiveMessage(char* data, int len, SRT_MSGCTRL& w_mctrl, int by_
     if (!m_config.bSynRecving)
     {
         HLOGC(arlog.Debug, log << CONID() << "receiveMessage: BEGIN ASYNC MODE. Going to extract payload size=" << len);
-        enterCS(m_RcvBufferLock);
-        const int res = (m_pRcvBuffer->isRcvDataReady(steady_clock::now()))
-            ? m_pRcvBuffer->readMessage(data, len, &w_mctrl)
-            : 0;
-        leaveCS(m_RcvBufferLock);
+        int res = 0;
+        {
+            ScopedLock lck(m_RcvBufferLock);
+            if (m_pRcvBuffer->isRcvDataReady(steady_clock::now()))
+                res = readMessageFromBuffer(data, len, (w_mctrl), w_views, iov);
+        }
         HLOGC(arlog.Debug, log << CONID() << "AFTER readMsg: (NON-BLOCKING) result=" << res);
 
         if (res == 0)
@@ -7436,9 +7974,10 @@ int srt::CUDT::receiveMessage(char* data, int len, SRT_MSGCTRL& w_mctrl, int by_
                 << " NMSG " << m_pRcvBuffer->getRcvMsgNum());
                 */
 
-        enterCS(m_RcvBufferLock);
-        res = m_pRcvBuffer->readMessage((data), len, &w_mctrl);
-        leaveCS(m_RcvBufferLock);
+        {
+            ScopedLock lck(m_RcvBufferLock);
+            res = readMessageFromBuffer(data, len, (w_mctrl), w_views, iov);
+        }
         HLOGC(arlog.Debug, log << CONID() << "AFTER readMsg: (BLOCKING) result=" << res);
 
         if (m_bBroken || m_bClosing)
@@ -7493,7 +8032,32 @@ int srt::CUDT::receiveMessage(char* data, int len, SRT_MSGCTRL& w_mctrl, int by_
     return res;
 }
 
-int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int block)
+namespace {
+int addBlockFromFileStream(srt::CSndBuffer& buf, int len, int64_t, void* arg, int32_t& w_seqno)
+{
+    return buf.addBufferFromFile(*reinterpret_cast<fstream*>(arg), len, (w_seqno));
+}
+
+int addBlockFromFd(srt::CSndBuffer& buf, int len, int64_t offset, void* arg, int32_t& w_seqno)
+{
+    return buf.addBufferFromFd(*reinterpret_cast<int*>(arg), offset, len, (w_seqno));
+}
+
+int readBlockToFileStream(srt::CRcvBuffer& buf, int len, int64_t, void* arg)
+{
+    fstream& ofs = *reinterpret_cast<fstream*>(arg);
+    if (ofs.fail())
+        return -1;
+    return std::max(0, buf.readBufferToFile(ofs, len));
+}
+
+int readBlockToFd(srt::CRcvBuffer& buf, int len, int64_t offset, void* arg)
+{
+    return buf.readBufferToFd(*reinterpret_cast<int*>(arg), offset, len);
+}
+}
+
+bool srt::CUDT::checkSendFileState(int64_t size)
 {
     if (m_bBroken || m_bClosing)
         throw CUDTException(MJ_CONNECTION, MN_CONNLOST, 0);
@@ -7501,7 +8065,7 @@ int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int blo
         throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
 
     if (size <= 0 && size != -1)
-        return 0;
+        return false;
 
     if (!m_CongCtl->checkTransArgs(SrtCongestion::STA_FILE, SrtCongestion::STAD_SEND, 0, size, SRT_MSGTTL_INF, false))
         throw CUDTException(MJ_NOTSUP, MN_INVALBUFFERAPI, 0);
@@ -7514,15 +8078,15 @@ int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int blo
         throw CUDTException(MJ_SETUP, MN_SECURITY, 0);
     }
 
-    ScopedLock sendguard (m_SendLock);
+    return true;
+}
 
-    if (m_pSndBuffer->getCurrBufSize() == 0)
-    {
-        // delay the EXP timer to avoid mis-fired timeout
-        ScopedLock ack_lock(m_RecvAckLock);
-        m_tsLastRspAckTime = steady_clock::now();
-        m_iReXmitCount   = 1;
-    }
+int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int block)
+{
+    if (!checkSendFileState(size))
+        return 0;
+
+    ScopedLock sendguard (m_SendLock);
 
     // positioning...
     try
@@ -7552,26 +8116,64 @@ int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int blo
         throw CUDTException(MJ_FILESYSTEM, MN_SEEKGFAIL);
     }
 
+    return sendFileBlocks((offset), size, block, addBlockFromFileStream, &ifs);
+}
+
+int64_t srt::CUDT::sendfile(int fd, int64_t &offset, int64_t size, int block)
+{
+    if (!checkSendFileState(size))
+        return 0;
+
+    if (fd < 0 || offset < 0)
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+    ScopedLock sendguard (m_SendLock);
+
+    // The data are read at the given offset, so there's no positioning,
+    // only the size must be known if not given.
+    if (size == -1)
+    {
+#ifdef _WIN32
+        struct _stat64 st;
+        const int res = _fstat64(fd, &st);
+#else
+        struct stat st;
+        const int res = ::fstat(fd, &st);
+#endif
+        if (res != 0 || offset > int64_t(st.st_size))
+            throw CUDTException(MJ_FILESYSTEM, MN_SEEKGFAIL);
+        size = int64_t(st.st_size) - offset;
+    }
+
+    return sendFileBlocks((offset), size, block, addBlockFromFd, &fd);
+}
+
+// [[using locked(m_SendLock)]]
+int64_t srt::CUDT::sendFileBlocks(int64_t& offset, int64_t size, int block, sendfile_add_f* funcAdd, void* arg)
+{
+    if (m_pSndBuffer->getCurrBufSize() == 0)
+    {
+        // delay the EXP timer to avoid mis-fired timeout
+        ScopedLock ack_lock(m_RecvAckLock);
+        m_tsLastRspAckTime = steady_clock::now();
+        m_iReXmitCount   = 1;
+    }
+
     int64_t tosend = size;
     int     unitsize;
 
     // sending block by block
     while (tosend > 0)
     {
-        if (ifs.fail())
-            throw CUDTException(MJ_FILESYSTEM, MN_WRITEFAIL);
-
-        if (ifs.eof())
-            break;
-
         unitsize = int((tosend >= block) ? block : tosend);
 
         {
             UniqueLock lock(m_SendBlockLock);
 
+            // The memory given back to the pool by other sockets is not signalled.
             THREAD_PAUSED();
             while (stillConnected() && (sndBuffersLeft() <= 0) && m_bPeerHealth)
-                m_SendBlockCond.wait(lock);
+                m_SendBlockCond.wait_for(lock, milliseconds_from(SND_POOL_RECHECK_PERIOD_MS));
             THREAD_RESUMED();
         }
 
@@ -7586,6 +8188,18 @@ int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int blo
             throw CUDTException(MJ_PEERERROR);
         }
 
+        // Take no more than the pool can still give, and get all the blocks
+        // before reading, so that the block is never added partially.
+        const int64_t maxunit = int64_t(m_pSndBuffer->getFreeBlocks()) * m_pSndBuffer->getMaxPacketLen();
+        unitsize = int(std::min<int64_t>(unitsize, maxunit));
+        if (unitsize <= 0 || !m_pSndBuffer->reserve(m_pSndBuffer->countNumPacketsRequired(unitsize)))
+        {
+            // The pool memory was taken by another socket in the meantime.
+            UniqueLock lock(m_SendBlockLock);
+            m_SendBlockCond.wait_for(lock, milliseconds_from(SND_POOL_RECHECK_PERIOD_MS));
+            continue;
+        }
+
         // record total time used for sending
         if (m_pSndBuffer->getCurrBufSize() == 0)
         {
@@ -7593,9 +8207,13 @@ int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int blo
             m_stats.sndDurationCounter = steady_clock::now();
         }
 
+        int64_t sentsize;
         {
             ScopedLock        recvAckLock(m_RecvAckLock);
-            const int64_t sentsize = m_pSndBuffer->addBufferFromFile(ifs, unitsize);
+            // The packets are stamped with the scheduling sequence here, as in sendmsg2.
+            int32_t seqno = m_iSndNextSeqNo;
+            sentsize = funcAdd(*m_pSndBuffer, unitsize, offset, arg, (seqno));
+            m_iSndNextSeqNo = seqno;
 
             if (sentsize > 0)
             {
@@ -7610,6 +8228,12 @@ int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int blo
             }
         }
 
+        if (sentsize < 0)
+            throw CUDTException(MJ_FILESYSTEM, MN_READFAIL);
+
+        if (sentsize == 0) // end of file
+            break;
+
         // insert this socket to snd list if it is not on the list yet
         m_pSndQueue->m_pSndUList->update(this, CSndUList::DONT_RESCHEDULE);
     }
@@ -7617,19 +8241,19 @@ int64_t srt::CUDT::sendfile(fstream &ifs, int64_t &offset, int64_t size, int blo
     return size - tosend;
 }
 
-int64_t srt::CUDT::recvfile(fstream &ofs, int64_t &offset, int64_t size, int block)
+bool srt::CUDT::checkRecvFileState(int64_t size)
 {
     if (!m_bConnected || !m_CongCtl.ready())
         throw CUDTException(MJ_CONNECTION, MN_NOCONN, 0);
     else if ((m_bBroken || m_bClosing) && !isRcvBufferReady())
     {
         if (!m_config.bMessageAPI && m_bShutdown)
-            return 0;
+            return false;
         throw CUDTException(MJ_CONNECTION, MN_CONNLOST, 0);
     }
 
     if (size <= 0)
-        return 0;
+        return false;
 
     if (!m_CongCtl->checkTransArgs(SrtCongestion::STA_FILE, SrtCongestion::STAD_RECV, 0, size, SRT_MSGTTL_INF, false))
         throw CUDTException(MJ_NOTSUP, MN_INVALBUFFERAPI, 0);
@@ -7641,6 +8265,14 @@ int64_t srt::CUDT::recvfile(fstream &ofs, int64_t &offset, int64_t size, int blo
         throw CUDTException(MJ_NOTSUP, MN_INVALBUFFERAPI, 0);
     }
 
+    return true;
+}
+
+int64_t srt::CUDT::recvfile(fstream &ofs, int64_t &offset, int64_t size, int block)
+{
+    if (!checkRecvFileState(size))
+        return 0;
+
     UniqueLock recvguard(m_RecvLock);
 
     // Well, actually as this works over a FILE (fstream), not just a stream,
@@ -7684,6 +8316,26 @@ int64_t srt::CUDT::recvfile(fstream &ofs, int64_t &offset, int64_t size, int blo
         throw CUDTException(MJ_FILESYSTEM, MN_SEEKPFAIL);
     }
 
+    return recvFileBlocks(recvguard, (offset), size, block, readBlockToFileStream, &ofs);
+}
+
+int64_t srt::CUDT::recvfile(int fd, int64_t &offset, int64_t size, int block)
+{
+    if (!checkRecvFileState(size))
+        return 0;
+
+    if (fd < 0 || offset < 0)
+        throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+    UniqueLock recvguard(m_RecvLock);
+
+    // The data are written at the given offset, no positioning needed.
+    return recvFileBlocks(recvguard, (offset), size, block, readBlockToFd, &fd);
+}
+
+// [[using locked(m_RecvLock)]]
+int64_t srt::CUDT::recvFileBlocks(UniqueLock& recvguard, int64_t& offset, int64_t size, int block, recvfile_read_f* funcRead, void* arg)
+{
     int64_t torecv   = size;
     int     unitsize = block;
     int     recvsize;
@@ -7691,15 +8343,6 @@ int64_t srt::CUDT::recvfile(fstream &ofs, int64_t &offset, int64_t size, int blo
     // receiving... "recvfile" is always blocking
     while (torecv > 0)
     {
-        if (ofs.fail())
-        {
-            // send the sender a signal so it will not be blocked forever
-            int32_t err_code = CUDTException::EFILE;
-            sendCtrl(UMSG_PEERERROR, &err_code);
-
-            throw CUDTException(MJ_FILESYSTEM, MN_WRITEFAIL);
-        }
-
         {
             CSync rcond (m_RecvDataCond, recvguard);
 
@@ -7720,14 +8363,20 @@ int64_t srt::CUDT::recvfile(fstream &ofs, int64_t &offset, int64_t size, int blo
 
         unitsize = int((torecv > block) ? block : torecv);
         enterCS(m_RcvBufferLock);
-        recvsize = m_pRcvBuffer->readBufferToFile(ofs, unitsize);
+        recvsize = funcRead(*m_pRcvBuffer, unitsize, offset, arg);
         leaveCS(m_RcvBufferLock);
 
-        if (recvsize > 0)
+        if (recvsize < 0)
         {
-            torecv -= recvsize;
-            offset += recvsize;
+            // send the sender a signal so it will not be blocked forever
+            int32_t err_code = CUDTException::EFILE;
+            sendCtrl(UMSG_PEERERROR, &err_code);
+
+            throw CUDTException(MJ_FILESYSTEM, MN_WRITEFAIL);
         }
+
+        torecv -= recvsize;
+        offset += recvsize;
     }
 
     if (!isRcvBufferReady())
@@ -7886,6 +8535,9 @@ void srt::CUDT::bstats(CBytePerfMon *perf, bool clear, bool instantaneous)
         {
             ScopedLock lck(m_RcvBufferLock);
             perf->byteAvailRcvBuf = (int) getAvailRcvBufferSizeNoLock() * m_config.iMSS;
+            perf->byteRcvBufAlloc = (int64_t) m_pRcvBuffer->getMemoryUsage();
+            perf->pktRcvUnitsHeld = m_pRcvBuffer->getUnitsHeld();
+            perf->pktRcvUnitsShare = m_pRcvBuffer->getMemShare();
             if (instantaneous) // no need for historical API for Rcv side
             {
                 perf->pktRcvBuf = m_pRcvBuffer->getRcvDataSize(perf->byteRcvBuf, perf->msRcvBuf);
@@ -7898,17 +8550,38 @@ void srt::CUDT::bstats(CBytePerfMon *perf, bool clear, bool instantaneous)
         else
         {
             perf->byteAvailRcvBuf = 0;
+            perf->byteRcvBufAlloc = 0;
+            perf->pktRcvUnitsHeld = 0;
+            perf->pktRcvUnitsShare = 0;
             perf->pktRcvBuf  = 0;
             perf->byteRcvBuf = 0;
             perf->msRcvBuf   = 0;
         }
 
+        if (m_pSndQueue)
+        {
+            m_pSndQueue->m_pTimer->getPacingStats((perf->sndPacingWaitsTotal), (perf->usSndPacingErrorTotal),
+                                                  (perf->usSndPacingSpinTotal));
+        }
+        else
+        {
+            perf->sndPacingWaitsTotal   = 0;
+            perf->usSndPacingErrorTotal = 0;
+            perf->usSndPacingSpinTotal  = 0;
+        }
+
         leaveCS(m_ConnectionLock);
     }
     else
     {
+        perf->sndPacingWaitsTotal   = 0;
+        perf->usSndPacingErrorTotal = 0;
+        perf->usSndPacingSpinTotal  = 0;
         perf->byteAvailSndBuf = 0;
         perf->byteAvailRcvBuf = 0;
+        perf->byteRcvBufAlloc = 0;
+        perf->pktRcvUnitsHeld = 0;
+        perf->pktRcvUnitsShare = 0;
         perf->pktSndBuf  = 0;
         perf->byteSndBuf = 0;
         perf->msSndBuf   = 0;
@@ -8194,14 +8867,17 @@ void srt::CUDT::sendCtrl(UDTMessageType pkttype, const int32_t* lparam, void* rp
             ScopedLock lock(m_RcvLossLock);
             // this is periodically NAK report; make sure NAK cannot be sent back too often
 
-            // read loss list from the local receiver loss list
-            int32_t *data = new int32_t[m_iMaxSRTPayloadSize / 4];
-            int      losslen;
-            m_pRcvLossList->getLossArray(data, losslen, m_iMaxSRTPayloadSize / 4);
+            // read loss list from the local receiver loss list; the report is kept
+            // by the list and only the ranges changed since the last NAK are encoded.
+            int losslen;
+            // A throttled socket requests only the first loss (one range record),
+            // which is what blocks its reader.
+            const int      losslimit = isRcvMemThrottled() ? 2 : m_iMaxSRTPayloadSize / 4;
+            const int32_t* data      = m_pRcvLossList->getLossReport((losslen), losslimit);
 
             if (0 < losslen)
             {
-                ctrlpkt.pack(pkttype, NULL, data, losslen * 4);
+                ctrlpkt.pack(pkttype, NULL, const_cast<int32_t*>(data), losslen * 4);
                 ctrlpkt.set_id(m_PeerID);
                 nbsent        = m_pSndQueue->sendto(m_PeerAddr, ctrlpkt, m_SourceAddr);
 
@@ -8209,8 +8885,6 @@ void srt::CUDT::sendCtrl(UDTMessageType pkttype, const int32_t* lparam, void* rp
                 m_stats.rcvr.sentNak.count(1);
                 leaveCS(m_StatsLock);
             }
-
-            delete[] data;
         }
 
         // update next NAK time, which should wait enough time for the retansmission, but not too long
@@ -8357,13 +9031,18 @@ int srt::CUDT::sendCtrlAck(CPacket& ctrlpkt, int size)
     UniqueLock bufflock(m_RcvBufferLock);
     // The full ACK should be sent to indicate there is now available space in the RCV buffer
     // since the last full ACK. It should unblock the sender to proceed further.
-    const bool bNeedFullAck = (m_bBufferWasFull && getAvailRcvBufferSizeNoLock() > 0);
+    const bool bNeedFullAck = (m_bBufferWasFull && getRcvFlowWindowNoLock() > 0);
     int32_t ack;    // First unacknowledged packet sequence number (acknowledge up to ack).
 
     if (!getFirstNoncontSequence((ack), (reason)))
         return nbsent;
 
-    if (m_iRcvLastAckAck == ack && !bNeedFullAck)
+    // With a loss pending, the ACK can't move, but the SACK ranges can
+    // still tell the sender about the packets received past it.
+    const bool bNewSack = m_bPeerSack && !m_bTsbPd && CSeqNo::seqcmp(m_iRcvCurrSeqNo, ack) > 0
+        && CSeqNo::seqcmp(m_iRcvCurrSeqNo, m_iRcvLastSackSeq) > 0;
+
+    if (m_iRcvLastAckAck == ack && !bNeedFullAck && !bNewSack)
     {
         HLOGC(xtlog.Debug,      
                 log << CONID() << "sendCtrl(UMSG_ACK): last ACK %" << ack << "(" << reason << ") == last ACKACK");     
@@ -8509,12 +9188,13 @@ int srt::CUDT::sendCtrlAck(CPacket& ctrlpkt, int size)
             CGlobEvent::triggerEvent();
         }
     }
-    else if (ack == m_iRcvLastAck && !bNeedFullAck)
+    else if (ack == m_iRcvLastAck)
     {
-        // If the ACK was just sent already AND elapsed time did not exceed RTT,
-        if ((steady_clock::now() - m_tsLastAckTime) <
-            (microseconds_from(m_iSRTT + 4 * m_iRTTVar)))
+        // A stuck ACK is repeated anyway when there are new SACK ranges to report.
+        if (!bNeedFullAck && !bNewSack
+            && (steady_clock::now() - m_tsLastAckTime) < (microseconds_from(m_iSRTT + 4 * m_iRTTVar)))
         {
+            // The ACK was just sent already AND elapsed time did not exceed RTT.
             HLOGC(xtlog.Debug,
                   log << CONID() << "sendCtrl(UMSG_ACK): ACK %" << ack << " just sent - too early to repeat");
             return nbsent;
@@ -8532,11 +9212,11 @@ int srt::CUDT::sendCtrlAck(CPacket& ctrlpkt, int size)
     // [[using locked(m_RcvBufferLock)]];
 
     // Send out the ACK only if has not been received by the sender before
-    if (CSeqNo::seqcmp(m_iRcvLastAck, m_iRcvLastAckAck) > 0 || bNeedFullAck)
+    if (CSeqNo::seqcmp(m_iRcvLastAck, m_iRcvLastAckAck) > 0 || bNeedFullAck || bNewSack)
     {
         // NOTE: The BSTATS feature turns on extra fields above size 6
         // also known as ACKD_TOTAL_SIZE_VER100.
-        int32_t data[ACKD_TOTAL_SIZE];
+        int32_t data[ACKD_TOTAL_SIZE_SACK];
 
         // Case you care, CAckNo::incack does exactly the same thing as
         // CSeqNo::incseq. Logically the ACK number is a different thing
@@ -8547,9 +9227,10 @@ int srt::CUDT::sendCtrlAck(CPacket& ctrlpkt, int size)
         data[ACKD_RCVLASTACK] = m_iRcvLastAck;
         data[ACKD_RTT] = m_iSRTT;
         data[ACKD_RTTVAR] = m_iRTTVar;
-        data[ACKD_BUFFERLEFT] = (int) getAvailRcvBufferSizeNoLock();
+        data[ACKD_BUFFERLEFT] = (int) getRcvFlowWindowNoLock();
         m_bBufferWasFull = data[ACKD_BUFFERLEFT] == 0;
-        if (steady_clock::now() - m_tsLastAckTime > m_tdACKInterval)
+        // New SACK ranges need the full-size ACK even when sent early.
+        if (bNewSack || steady_clock::now() - m_tsLastAckTime > m_tdACKInterval)
         {
             int rcvRate;
             int ctrlsz = ACKD_TOTAL_SIZE_UDTBASE * ACKD_FIELD_SIZE; // Minimum required size
@@ -8569,6 +9250,18 @@ int srt::CUDT::sendCtrlAck(CPacket& ctrlpkt, int size)
                 // Normal, currently expected version.
                 data[ACKD_RCVRATE] = rcvRate; // bytes/sec
                 ctrlsz = ACKD_FIELD_SIZE * ACKD_TOTAL_SIZE_VER101;
+
+                // In file mode there are no periodic NAK reports, so when a
+                // retransmission request gets lost, the sender retransmits
+                // everything since the ACK. Tell it what has been received.
+                if (m_bPeerSack && !m_bTsbPd)
+                {
+                    ScopedLock lock(m_RcvLossLock);
+                    const int nranges = m_pRcvLossList->getReceivedRanges(
+                        m_iRcvCurrSeqNo, data + ACKD_SACK_RANGES, ACKD_SACK_MAX_RANGES);
+                    ctrlsz += ACKD_FIELD_SIZE * 2 * nranges;
+                    m_iRcvLastSackSeq = m_iRcvCurrSeqNo;
+                }
             }
             // ELSE: leave the buffer with ...UDTBASE size.
 
@@ -8620,6 +9313,12 @@ void srt::CUDT::updateSndLossListOnACK(int32_t ackdata_seqno)
         if (offset <= 0)
             return;
 
+        if (m_pRackSuspects)
+        {
+            rackOnDelivered(CSeqNo::decseq(ackdata_seqno));
+            m_pRackSuspects->removeUpTo(CSeqNo::decseq(ackdata_seqno));
+        }
+
         // update sending variables
         m_iSndLastDataAck = ackdata_seqno;
 
@@ -8647,6 +9346,8 @@ void srt::CUDT::updateSndLossListOnACK(int32_t ackdata_seqno)
         CGlobEvent::triggerEvent();
     }
 
+    notifySendCompletions();
+
 #if ENABLE_BONDING
     if (is_group)
     {
@@ -8688,6 +9389,121 @@ void srt::CUDT::updateSndLossListOnACK(int32_t ackdata_seqno)
     leaveCS(m_StatsLock);
 }
 
+void srt::CUDT::updateSndLossListOnSACK(int32_t ackdata_seqno, const int32_t* ranges, size_t nranges)
+{
+    ScopedLock ack_lock(m_RecvAckLock);
+
+    m_SndSackRanges.clear();
+    int32_t prev_last = ackdata_seqno;
+    int     removed   = 0;
+    int     sacked    = 0;
+    for (size_t i = 0; i < nranges; ++i)
+    {
+        const int32_t first = ranges[2 * i];
+        const int32_t last  = ranges[2 * i + 1];
+
+        // The ranges must follow the ACK and each other, and must not
+        // exceed what was sent.
+        if (first < 0 || last < 0 || CSeqNo::seqcmp(first, prev_last) <= 0 || CSeqNo::seqcmp(first, last) > 0
+            || CSeqNo::seqcmp(last, m_iSndCurrSeqNo) > 0)
+        {
+            LOGC(inlog.Warn, log << CONID() << "ACK: invalid SACK range %" << first << "-%" << last << " after %"
+                    << prev_last << " (IGNORED with the rest)");
+            break;
+        }
+
+        removed += m_pSndLossList->remove(first, last);
+        if (m_pRackSuspects)
+        {
+            rackOnDelivered(last);
+            m_pRackSuspects->remove(first, last);
+        }
+        m_SndSackRanges.push_back(std::make_pair(first, last));
+        sacked += CSeqNo::seqlen(first, last);
+        prev_last = last;
+    }
+    m_iSndSackedPkts = sacked;
+    // With the maximum number of ranges there may be more received packets.
+    m_bSndSackPartial = m_SndSackRanges.size() >= size_t(ACKD_SACK_MAX_RANGES);
+
+    HLOGC(inlog.Debug, log << CONID() << "ACK: %" << ackdata_seqno << " SACK " << m_SndSackRanges.size()
+            << " ranges, " << removed << " packets removed from the loss list");
+}
+
+// [[using locked (m_RecvAckLock)]]
+void srt::CUDT::rackOnDelivered(int32_t seqno)
+{
+    const int        offset = CSeqNo::seqoff(m_iSndLastDataAck, seqno);
+    const time_point sent   = m_pSndBuffer->getPacketSentTime(offset);
+
+    // It is unknown which copy of a retransmitted packet was delivered,
+    // so only packets sent once can tell the time.
+    if (is_zero(sent) || !is_zero(m_pSndBuffer->getPacketRexmitTime(offset)))
+        return;
+
+    if (sent > m_tsRackXmitTime)
+        m_tsRackXmitTime = sent;
+}
+
+// [[using locked (m_RecvAckLock)]]
+int srt::CUDT::addReportedLoss(int32_t seqno_lo, int32_t seqno_hi)
+{
+    if (!m_pRackSuspects)
+        return m_pSndLossList->insert(seqno_lo, seqno_hi);
+
+    // The receiver reports a loss upon receiving a later packet,
+    // normally the one that follows the reported range.
+    m_pRackSuspects->insert(seqno_lo, seqno_hi);
+    rackOnDelivered(CSeqNo::incseq(seqno_hi));
+    return 0;
+}
+
+// [[using locked (m_RecvAckLock)]]
+int srt::CUDT::rackDetectLoss(const time_point& currtime)
+{
+    // The reorder window follows the RTT variance, but is kept
+    // between 1 ms (timer granularity) and the smoothed RTT.
+    const int                      srtt_us  = m_iSRTT;
+    const int                      reo_us   = std::max(1000, std::min<int>(m_iRTTVar, srtt_us));
+    const steady_clock::duration   reo_wnd  = microseconds_from(reo_us);
+    const steady_clock::duration   deadline = microseconds_from(srtt_us) + reo_wnd;
+
+    // A suspect is lost when a packet sent later by more than the reorder window
+    // was delivered, or when it was not delivered within the RTT and the reorder
+    // window since it was sent. All suspects are checked, as with retransmissions
+    // the sending times don't follow the sequence numbers.
+    int num = 0;
+    for (int32_t seqno = m_pRackSuspects->getFirstLostSeq(); seqno != SRT_SEQNO_NONE;)
+    {
+        const int32_t next = m_pRackSuspects->getNextLostSeq(seqno);
+
+        const time_point sent = m_pSndBuffer->getPacketSentTime(CSeqNo::seqoff(m_iSndLastDataAck, seqno));
+        if (!is_zero(sent))
+        {
+            if (sent + reo_wnd >= m_tsRackXmitTime && currtime < sent + deadline)
+            {
+                seqno = next;
+                continue;
+            }
+
+            HLOGC(inlog.Debug, log << CONID() << "RACK: %" << seqno << " lost, sent "
+                    << FormatDuration<DUNIT_US>(currtime - sent) << " ago, reorder window " << reo_us << "us");
+            num += m_pSndLossList->insert(seqno, seqno);
+        }
+        // Otherwise it's no longer in the buffer, or it was never sent.
+        m_pRackSuspects->remove(seqno, seqno);
+        seqno = next;
+    }
+
+    if (num > 0)
+    {
+        enterCS(m_StatsLock);
+        m_stats.sndr.lost.count(num);
+        leaveCS(m_StatsLock);
+    }
+    return num;
+}
+
 void srt::CUDT::processCtrlAck(const CPacket &ctrlpkt, const steady_clock::time_point& currtime)
 {
     const int32_t* ackdata       = (const int32_t*)ctrlpkt.m_pcData;
@@ -8712,6 +9528,23 @@ void srt::CUDT::processCtrlAck(const CPacket &ctrlpkt, const steady_clock::time_
 
     updateSndLossListOnACK(ackdata_seqno);
 
+    // A repeated ACK can still bring new SACK ranges, so they are processed
+    // before the repeated ACKs are discarded. A full ACK with the statistics
+    // but without ranges means that nothing was received past the ACK.
+    const size_t ackfields = ctrlpkt.getLength() / ACKD_FIELD_SIZE;
+    if (m_bPeerSack && ackfields >= ACKD_SACK_RANGES)
+    {
+        const size_t nranges = ackfields > ACKD_SACK_RANGES ? (ackfields - ACKD_SACK_RANGES) / 2 : 0;
+        updateSndLossListOnSACK(ackdata_seqno, ackdata + ACKD_SACK_RANGES, nranges);
+    }
+
+    if (m_pRackSuspects)
+    {
+        ScopedLock ack_lock(m_RecvAckLock);
+        if (rackDetectLoss(currtime) > 0)
+            m_pSndQueue->m_pSndUList->update(this, CSndUList::DONT_RESCHEDULE);
+    }
+
     // Process a lite ACK
     if (isLiteAck)
     {
@@ -8799,9 +9632,11 @@ void srt::CUDT::processCtrlAck(const CPacket &ctrlpkt, const steady_clock::time_
          * which may go crazy and stay there, preventing proper stream recovery.
          */
 
-        if (CSeqNo::seqoff(m_iSndLastFullAck, ackdata_seqno) <= 0)
+        const int fullack_off = CSeqNo::seqoff(m_iSndLastFullAck, ackdata_seqno);
+        // Discard it if it is a repeated ACK, unless it brings SACK ranges,
+        // which the congestion control can take delivery samples from.
+        if (fullack_off < 0 || (fullack_off == 0 && !(m_bPeerSack && ackfields > ACKD_SACK_RANGES)))
         {
-            // discard it if it is a repeated ACK
             return;
         }
         m_iSndLastFullAck = ackdata_seqno;
@@ -9106,7 +9941,7 @@ void srt::CUDT::processCtrlLossReport(const CPacket& ctrlpkt)
                 {
                     HLOGC(inlog.Debug, log << CONID() << "LOSSREPORT: adding "
                         << losslist_lo << " - " << losslist_hi << " to loss list");
-                    num = m_pSndLossList->insert(losslist_lo, losslist_hi);
+                    num = addReportedLoss(losslist_lo, losslist_hi);
                 }
                 // ELSE losslist_lo %< m_iSndLastAck
                 else
@@ -9130,7 +9965,7 @@ void srt::CUDT::processCtrlLossReport(const CPacket& ctrlpkt)
                     {
                         HLOGC(inlog.Debug, log << CONID() << "LOSSREPORT: adding "
                                 << m_iSndLastAck << "[ACK] - " << losslist_hi << " to loss list");
-                        num = m_pSndLossList->insert(m_iSndLastAck, losslist_hi);
+                        num = addReportedLoss(m_iSndLastAck, losslist_hi);
                         dropreq_hi = CSeqNo::decseq(m_iSndLastAck);
                         IF_HEAVY_LOGGING(drop_type = "partially");
                     }
@@ -9172,7 +10007,7 @@ void srt::CUDT::processCtrlLossReport(const CPacket& ctrlpkt)
 
                     HLOGC(inlog.Debug,
                             log << CONID() << "LOSSREPORT: adding %" << losslist[i] << " (1 packet) to loss list");
-                    const int num = m_pSndLossList->insert(losslist[i], losslist[i]);
+                    const int num = addReportedLoss(losslist[i], losslist[i]);
 
                     enterCS(m_StatsLock);
                     m_stats.sndr.lost.count(num);
@@ -9192,6 +10027,9 @@ void srt::CUDT::processCtrlLossReport(const CPacket& ctrlpkt)
                 }
             }
         }
+
+        if (m_pRackSuspects)
+            rackDetectLoss(steady_clock::now());
     }
 
     updateCC(TEV_LOSSREPORT, EventVariant(losslist, losslist_len));
@@ -10286,26 +11124,30 @@ bool srt::CUDT::packData(CPacket& w_packet, steady_clock::time_point& w_nexttime
     }
     else
     {
-#if USE_BUSY_WAITING
-        m_tsNextSendTime = enter_time + m_tdSendInterval.load();
-#else
-        const duration sendbrw = m_tdSendTimeDiff;
-
-        if (sendbrw >= sendint)
+        if (m_pSndQueue->m_pTimer->pacing() == SRT_PACING_HYBRID)
         {
-            // Send immediately
-            m_tsNextSendTime = enter_time;
-
-            // ATOMIC NOTE: this is the only thread that
-            // modifies this field
-            m_tdSendTimeDiff = sendbrw - sendint;
+            // The timer wakes up on time, no lateness to make up for.
+            m_tsNextSendTime = enter_time + m_tdSendInterval.load();
         }
         else
         {
-            m_tsNextSendTime = enter_time + (sendint - sendbrw);
-            m_tdSendTimeDiff = duration();
+            const duration sendbrw = m_tdSendTimeDiff;
+
+            if (sendbrw >= sendint)
+            {
+                // Send immediately
+                m_tsNextSendTime = enter_time;
+
+                // ATOMIC NOTE: this is the only thread that
+                // modifies this field
+                m_tdSendTimeDiff = sendbrw - sendint;
+            }
+            else
+            {
+                m_tsNextSendTime = enter_time + (sendint - sendbrw);
+                m_tdSendTimeDiff = duration();
+            }
         }
-#endif
     }
     HLOGC(qslog.Debug, log << "packData: Setting source address: " << m_SourceAddr.str());
     w_src_addr = m_SourceAddr;
@@ -10714,6 +11556,20 @@ int srt::CUDT::handleSocketPacketReception(const vector<CUnit*>& incoming, bool&
             }
         }
 
+        // A socket holding its full share of the receiver memory budget gets no
+        // new packets until the reader catches up. Packets filling the gaps
+        // are still accepted, otherwise the units held could never be released.
+        if (CSeqNo::seqcmp(rpkt.seqno(), m_iRcvCurrSeqNo) > 0 && isRcvMemThrottled())
+        {
+            string why;
+            if (frequentLogAllowed(FREQLOGFA_RCV_MEMSHARE, steady_clock::now(), (why)))
+            {
+                LOGC(qrlog.Warn, log << CONID() << "Receiver memory share exceeded (" << m_pRcvBuffer->getUnitsHeld()
+                        << " units held), dropping packet seqno " << rpkt.seqno() << ". " << why);
+            }
+            return -1;
+        }
+
         const int buffer_add_result = m_pRcvBuffer->insert(u);
         if (buffer_add_result < 0)
         {
@@ -12159,9 +13015,24 @@ void srt::CUDT::checkRexmitTimer(const steady_clock::time_point& currtime)
     {
         // Sender: Insert all the packets sent after last received acknowledgement into the sender loss list.
         ScopedLock acklock(m_RecvAckLock); // Protect packet retransmission
-        // Resend all unacknowledged packets on timeout, but only if there is no packet in the loss list
-        const int32_t csn = m_iSndCurrSeqNo;
-        const int     num = m_pSndLossList->insert(m_iSndLastAck, csn);
+        // Resend all unacknowledged packets on timeout, but only if there is no packet in the loss list.
+        // Skip the ranges that the receiver has reported as received in the last SACK.
+        const int32_t csn  = m_iSndCurrSeqNo;
+        int32_t       from = m_iSndLastAck;
+        int           num  = 0;
+        for (size_t i = 0; i < m_SndSackRanges.size(); ++i)
+        {
+            const std::pair<int32_t, int32_t>& r = m_SndSackRanges[i];
+            if (CSeqNo::seqcmp(r.second, from) < 0)
+                continue;
+            if (CSeqNo::seqcmp(r.first, csn) > 0)
+                break;
+            if (CSeqNo::seqcmp(r.first, from) > 0)
+                num += m_pSndLossList->insert(from, CSeqNo::decseq(r.first));
+            from = CSeqNo::incseq(r.second);
+        }
+        if (CSeqNo::seqcmp(from, csn) <= 0)
+            num += m_pSndLossList->insert(from, csn);
         if (num > 0)
         {
             enterCS(m_StatsLock);
@@ -12213,9 +13084,34 @@ void srt::CUDT::checkTimers()
     if (checkExpTimer(currtime, debug_decision))
         return;
 
+    if (m_pRackSuspects)
+    {
+        ScopedLock ack_lock(m_RecvAckLock);
+        if (rackDetectLoss(currtime) > 0)
+            m_pSndQueue->m_pSndUList->update(this, CSndUList::DONT_RESCHEDULE);
+    }
+
     // Check if FAST or LATE packet retransmission is required
     checkRexmitTimer(currtime);
 
+    if (currtime > m_tsNextBufReleaseTime)
+    {
+        // Buffer memory not used during a whole period is given back.
+        // The sender buffer is resized only under the sending lock, as
+        // the data are added to it partially without the buffer lock.
+        // If a sending call is in progress, the buffer isn't idle anyway.
+        if (m_pSndBuffer && tryEnterCS(m_SendLock))
+        {
+            m_pSndBuffer->releaseIdleStorage();
+            leaveCS(m_SendLock);
+        }
+
+        ScopedLock lck(m_RcvBufferLock);
+        if (m_pRcvBuffer)
+            m_pRcvBuffer->releaseIdleStorage();
+        m_tsNextBufReleaseTime = currtime + milliseconds_from(BUFFER_IDLE_RELEASE_PERIOD_MS);
+    }
+
     if (currtime > m_tsLastSndTime.load() + microseconds_from(COMM_KEEPALIVE_PERIOD_US))
     {
         sendCtrl(UMSG_KEEPALIVE);
@@ -12420,6 +13316,21 @@ int srt::CUDT::rejectReason(SRTSOCKET u, int value)
     return 0;
 }
 
+int srt::CUDT::registerCongctl(const char* name, const SRT_CONGCTL_OPS* ops)
+{
+    // The name must fit in SRTO_CONGESTION.
+    if (!name || !*name || strlen(name) > CSrtConfig::MAX_CONG_LENGTH)
+        return APIError(MJ_NOTSUP, MN_INVAL);
+
+    if (ops && !ops->create)
+        return APIError(MJ_NOTSUP, MN_INVAL);
+
+    if (!SrtCongestion::registerUser(name, ops))
+        return APIError(MJ_NOTSUP, MN_INVAL);
+
+    return 0;
+}
+
 int64_t srt::CUDT::socketStartTime(SRTSOCKET u)
 {
     CUDTSocket* s = uglobal().locateSocket(u);
@@ -116,7 +116,14 @@ enum AckDataItem
     ACKD_XMRATE_VER102_ONLY     = 7,
     ACKD_TOTAL_SIZE_VER102_ONLY = 8,  // Packet length = 32.
 
-    ACKD_TOTAL_SIZE = ACKD_TOTAL_SIZE_VER102_ONLY  // The maximum known ACK length is 32 bytes.
+    ACKD_TOTAL_SIZE = ACKD_TOTAL_SIZE_VER102_ONLY,  // The maximum known ACK length is 32 bytes.
+
+    // Since SRT v1.5.5, only when negotiated by SRT_OPT_SACK (never with v1.0.2):
+    // pairs of the first and the last sequence number of the ranges received
+    // after the first loss, the oldest first.
+    ACKD_SACK_RANGES     = 7,
+    ACKD_SACK_MAX_RANGES = 16,
+    ACKD_TOTAL_SIZE_SACK = ACKD_SACK_RANGES + 2 * ACKD_SACK_MAX_RANGES  // Packet length = 156.
 };
 const size_t ACKD_FIELD_SIZE = sizeof(int32_t);
 
@@ -308,6 +315,7 @@ class CUDT
     friend class CUDTGroup;
     friend class TestMockCUDT; // unit tests
     friend class TestMockControlPackets; // unit tests
+    friend class TestMockCongctl; // unit tests
 
     typedef sync::steady_clock::time_point time_point;
     typedef sync::steady_clock::duration duration;
@@ -353,9 +361,18 @@ public: //API
     static int sendmsg(SRTSOCKET u, const char* buf, int len, int ttl = SRT_MSGTTL_INF, bool inorder = false, int64_t srctime = 0);
     static int recvmsg(SRTSOCKET u, char* buf, int len, int64_t& srctime);
     static int sendmsg2(SRTSOCKET u, const char* buf, int len, SRT_MSGCTRL& mctrl);
+    static int sendmsgv(SRTSOCKET u, const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL& mctrl);
+    static int sendmsg_zc(SRTSOCKET u, const char* buf, int len, SRT_MSGCTRL& mctrl);
+    static int sendmmsg(SRTSOCKET u, SRT_MSGVEC* msgs, int n);
     static int recvmsg2(SRTSOCKET u, char* buf, int len, SRT_MSGCTRL& w_mctrl);
+    static int recvmsgv(SRTSOCKET u, const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL& w_mctrl);
+    static int recvmsg_zc(SRTSOCKET u, SRT_PKTVIEW* views, int nviews, SRT_MSGCTRL& w_mctrl);
+    static int recvmsg_zc_release(SRTSOCKET u, const SRT_PKTVIEW* views, int nviews);
+    static int recvmmsg(SRTSOCKET u, SRT_MSGVEC* msgs, int n, int msTimeOut);
     static int64_t sendfile(SRTSOCKET u, std::fstream& ifs, int64_t& offset, int64_t size, int block = SRT_DEFAULT_SENDFILE_BLOCK);
     static int64_t recvfile(SRTSOCKET u, std::fstream& ofs, int64_t& offset, int64_t size, int block = SRT_DEFAULT_RECVFILE_BLOCK);
+    static int64_t sendfile(SRTSOCKET u, int fd, int64_t& offset, int64_t size, int block = SRT_DEFAULT_SENDFILE_BLOCK);
+    static int64_t recvfile(SRTSOCKET u, int fd, int64_t& offset, int64_t size, int block = SRT_DEFAULT_RECVFILE_BLOCK);
     static int select(int nfds, UDT::UDSET* readfds, UDT::UDSET* writefds, UDT::UDSET* exceptfds, const timeval* timeout);
     static int selectEx(const std::vector<SRTSOCKET>& fds, std::vector<SRTSOCKET>* readfds, std::vector<SRTSOCKET>* writefds, std::vector<SRTSOCKET>* exceptfds, int64_t msTimeOut);
     static int epoll_create();
@@ -383,6 +400,7 @@ public: //API
     static int rejectReason(SRTSOCKET s);
     static int rejectReason(SRTSOCKET s, int value);
     static int64_t socketStartTime(SRTSOCKET s);
+    static int registerCongctl(const char* name, const SRT_CONGCTL_OPS* ops);
 
 public: // internal API
     // This is public so that it can be used directly in API implementation functions.
@@ -412,6 +430,8 @@ public: // internal API
     static const uint64_t  COMM_KEEPALIVE_PERIOD_US              = 1*1000*1000;
     static const int32_t   COMM_SYN_INTERVAL_US                  = 10*1000;
     static const int       COMM_CLOSE_BROKEN_LISTENER_TIMEOUT_MS = 3000;
+    static const int       BUFFER_IDLE_RELEASE_PERIOD_MS         = 2000;
+    static const int       SND_POOL_RECHECK_PERIOD_MS            = 100;
     static const uint16_t  MAX_WEIGHT                            = 32767;
     static const size_t    ACK_WND_SIZE                          = 1024;
     static const int       INITIAL_RTT                           = 10 * COMM_SYN_INTERVAL_US;
@@ -457,6 +477,7 @@ public: // internal API
     bool        isOPT_TsbPd()                   const { return m_config.bTSBPD; }
     int         SRTT()                          const { return m_iSRTT; }
     int         RTTVar()                        const { return m_iRTTVar; }
+    bool        isRTTMeasured()                 const { return m_bIsFirstRTTReceived; }
     int32_t     sndSeqNo()                      const { return m_iSndCurrSeqNo; }
     int32_t     schedSeqNo()                    const { return m_iSndNextSeqNo; }
     bool        overrideSndSeqNo(int32_t seq);
@@ -493,6 +514,8 @@ public: // internal API
     }
 
     int             sndLossLength()               { return m_pSndLossList->getLossLength(); }
+    int             sndSackedPkts()         const { return m_iSndSackedPkts; }
+    bool            sndSackPartial()        const { return m_bSndSackPartial; }
     int32_t         ISN()                   const { return m_iISN; }
     int32_t         peerISN()               const { return m_iPeerISN; }
     duration        minNAKInterval()        const { return m_tdMinNakInterval; }
@@ -782,11 +805,56 @@ private:
     /// @param len [in] size of the buffer.
     /// @return Actual size of data received.
 
-    SRT_ATR_NODISCARD int sendmsg2(const char* data, int len, SRT_MSGCTRL& w_m);
+    SRT_ATR_NODISCARD int sendmsg2(const char* data, int len, SRT_MSGCTRL& w_m, bool zerocopy = false);
+
+    /// Send a message gathered from several buffers. Like @a sendmsg2,
+    /// which uses this function with a single buffer.
+    SRT_ATR_NODISCARD int sendmsgv(const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL& w_m, bool zerocopy = false);
+
+    /// Send a message without copying it into the sender buffer.
+    /// The @a data memory is referenced until reported by the send-complete callback.
+    SRT_ATR_NODISCARD int sendmsg_zc(const char* data, int len, SRT_MSGCTRL& w_m);
+
+    /// Schedule several messages for sending with a single pass through the
+    /// sending path. Stops at the first message that can't be scheduled.
+    /// @return Number of messages scheduled.
+    SRT_ATR_NODISCARD int sendmmsg(SRT_MSGVEC* w_msgs, int n);
+
+    /// Check the arguments of a sending call against the socket settings.
+    /// Throws CUDTException if they are not acceptable.
+    void checkSendArgs(const char* data, int len, const SRT_MSGCTRL& mctrl);
+
+    /// Wait (or not, for non-blocking mode) until the sender buffer has
+    /// room for @a iNumPktsRequired packets. Throws CUDTException on failure.
+    /// @return false if the wait ended without space with no error to report.
+    SRT_ATR_NODISCARD bool waitForSndBufferSpace(int iNumPktsRequired);
+
+    /// Make the sender buffer grow to take @a iNumPktsRequired packets,
+    /// waiting like @a waitForSndBufferSpace() if the multiplexer's pool
+    /// does not have the memory for it.
+    /// @return false if the wait ended without space with no error to report.
+    SRT_ATR_NODISCARD bool reserveSndBuffer(int iNumPktsRequired);
+
+    /// Report the zero-copy user buffers released by the sender buffer
+    /// through the send-complete callback. Must be called with no locks applied.
+    void notifySendCompletions();
 
     SRT_ATR_NODISCARD int recvmsg(char* data, int len, int64_t& srctime);
     SRT_ATR_NODISCARD int recvmsg2(char* data, int len, SRT_MSGCTRL& w_m);
-    SRT_ATR_NODISCARD int receiveMessage(char* data, int len, SRT_MSGCTRL& w_m, int erh = 1 /*throw exception*/);
+    SRT_ATR_NODISCARD int recvmsgv(const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL& w_m);
+    /// Receive a message. If @a w_views is given, the message is not copied into @a data,
+    /// but @a w_views (of size @a len) are filled with the payload of every packet instead.
+    /// If @a iov is given, the message is scattered over @a iov (of size @a len) instead.
+    SRT_ATR_NODISCARD int receiveMessage(char* data, int len, SRT_MSGCTRL& w_m, int erh = 1 /*throw exception*/,
+                                         SRT_PKTVIEW* w_views = NULL, const SRT_IOVEC* iov = NULL);
+    SRT_ATR_NODISCARD int readMessageFromBuffer(char* data, int len, SRT_MSGCTRL& w_m, SRT_PKTVIEW* w_views, const SRT_IOVEC* iov);
+    SRT_ATR_NODISCARD int recvmsg_zc(SRT_PKTVIEW* w_views, int nviews, SRT_MSGCTRL& w_m);
+
+    /// Read all messages ready to be delivered, up to @a n, waiting up
+    /// to @a msTimeOut milliseconds (-1: infinitely) for the first one.
+    /// @return Number of messages read.
+    SRT_ATR_NODISCARD int recvmmsg(SRT_MSGVEC* w_msgs, int n, int msTimeOut);
+    int releaseRecvViews(const SRT_PKTVIEW* views, int nviews);
     SRT_ATR_NODISCARD int receiveBuffer(char* data, int len);
 
     size_t dropMessage(int32_t seqtoskip);
@@ -809,6 +877,52 @@ private:
 
     SRT_ATR_NODISCARD int64_t recvfile(std::fstream& ofs, int64_t& offset, int64_t size, int block = 7320000);
 
+    /// Send a file given by a file descriptor. The data are read with pread()
+    /// directly into the sender buffer; the file offset of @a fd is not changed.
+    /// @param fd [in] The input file descriptor.
+    /// @param offset [in, out] From where to read and send data; output is the new offset when the call returns.
+    /// @param size [in] How many data to be sent, -1 for up to the end of the file.
+    /// @param block [in] size of block per read from disk
+    /// @return Actual size of data sent.
+
+    SRT_ATR_NODISCARD int64_t sendfile(int fd, int64_t& offset, int64_t size, int block = 366000);
+
+    /// Receive data into a file given by a file descriptor. The payloads of the
+    /// received packets are written out with pwritev() directly from the receiver
+    /// buffer; the file offset of @a fd is not changed.
+    /// @param fd [in] The output file descriptor.
+    /// @param offset [in, out] Where to write data; output is the new offset when the call returns.
+    /// @param size [in] How many data to be received.
+    /// @param block [in] size of block per write to disk
+    /// @return Actual size of data received.
+
+    SRT_ATR_NODISCARD int64_t recvfile(int fd, int64_t& offset, int64_t size, int block = 7320000);
+
+    /// Adds up to @a len bytes read from the file at @a offset to the sender buffer,
+    /// stamping the packets with the sequence numbers from @a w_seqno on.
+    /// @return the number of bytes added, 0 at the end of the file, -1 on failure.
+    typedef int sendfile_add_f(CSndBuffer& buf, int len, int64_t offset, void* arg, int32_t& w_seqno);
+
+    /// Reads up to @a len bytes from the receiver buffer into the file at @a offset.
+    /// @return the number of bytes written, -1 on failure.
+    typedef int recvfile_read_f(CRcvBuffer& buf, int len, int64_t offset, void* arg);
+
+    /// Check if the socket is in the state to send a file of @a size.
+    /// @return false if there is nothing to send.
+    /// @throws CUDTException if the socket is not ready.
+    bool checkSendFileState(int64_t size);
+
+    /// Check if the socket is in the state to receive a file of @a size.
+    /// @return false if there is nothing to receive.
+    /// @throws CUDTException if the socket is not ready.
+    bool checkRecvFileState(int64_t size);
+
+    SRT_ATTR_REQUIRES(m_SendLock)
+    int64_t sendFileBlocks(int64_t& offset, int64_t size, int block, sendfile_add_f* funcAdd, void* arg);
+
+    SRT_ATTR_REQUIRES(m_RecvLock)
+    int64_t recvFileBlocks(sync::UniqueLock& recvguard, int64_t& offset, int64_t size, int block, recvfile_read_f* funcRead, void* arg);
+
     /// Configure UDT options.
     /// @param optName [in] The enum name of a UDT option.
     /// @param optval [in] The value to be set.
@@ -885,7 +999,8 @@ private:
 
     int sndBuffersLeft()
     {
-        return m_config.iSndBufSize - m_pSndBuffer->getCurrBufSize();
+        // Limited also by the memory left in the multiplexer's pool.
+        return std::min(m_config.iSndBufSize - m_pSndBuffer->getCurrBufSize(), m_pSndBuffer->getFreeBlocks());
     }
 
     time_point socketStartTime()
@@ -1002,7 +1117,8 @@ private:
 
 private: // Sending related data
     CSndBuffer* m_pSndBuffer;                    // Sender buffer
-    CSndLossList* m_pSndLossList;                // Sender loss list
+    CSndLossSet*  m_pSndLossList;                // Sender loss list
+    CSndLossSet*  m_pRackSuspects;               // Reported losses waiting for the time-based decision (SRTO_RETRANSMITALGO=2)
     CPktTimeWindow<16, 16> m_SndTimeWindow;      // Packet sending time window
 #ifdef ENABLE_MAXREXMITBW
     size_t m_zSndAveragePacketSize;
@@ -1016,6 +1132,7 @@ private: // Sending related data
     RateMeasurement   m_SndRexmitMeasurement;    // Retransmission rate measurement
 #endif
 #endif
+    CSndShaper::Leaf m_SndShaperLeaf;            // State in the rate budget of the multiplexer (SRTO_MUXMAXBW)
 
     atomic_duration m_tdSendInterval;            // Inter-packet time, in CPU clock cycles
 
@@ -1041,6 +1158,7 @@ private: // Timers
     time_point m_tsRcvPeerStartTime;
     time_point m_tsLingerExpiration;             // Linger expiration time (for GC to close a socket with data in sending buffer)
     time_point m_tsLastAckTime;                  // (RCV) Timestamp of last ACK
+    time_point m_tsNextBufReleaseTime;           // Next time to give back the idle buffer storage
     duration m_tdMinNakInterval;                 // NAK timeout lower bound; too small value can cause unnecessary retransmission
     duration m_tdMinExpInterval;                 // Timeout lower bound threshold: too small timeout can cause problem
 
@@ -1062,6 +1180,13 @@ private: // Timers
     // require only the lost sequence number, and how to find the packet with this sequence
     // will be up to the sending buffer.
     sync::atomic<int32_t> m_iSndLastDataAck;     // The real last ACK that updates the sender buffer and loss list
+
+    SRT_ATTR_GUARDED_BY(m_RecvAckLock)
+    std::vector<std::pair<int32_t, int32_t> > m_SndSackRanges; // Ranges reported received by the last SACK
+    SRT_ATTR_GUARDED_BY(m_RecvAckLock)
+    time_point m_tsRackXmitTime;                 // Latest send time of a packet known as delivered
+    sync::atomic<int> m_iSndSackedPkts;          // Number of packets in the ranges of the last SACK
+    sync::atomic<bool> m_bSndSackPartial;        // The last SACK may not cover all packets received past the ACK
     SRT_ATTR_GUARDED_BY(m_RecvAckLock)
     sync::atomic<int32_t> m_iSndCurrSeqNo;       // The largest sequence number that HAS BEEN SENT
     sync::atomic<int32_t> m_iSndNextSeqNo;       // The sequence number predicted to be placed at the currently scheduled packet
@@ -1097,6 +1222,7 @@ private: // Timers
     bool m_bPeerTLPktDrop;                       // Enable sender late packet dropping
     bool m_bPeerNakReport;                       // Sender's peer (receiver) issues Periodic NAK Reports
     bool m_bPeerRexmitFlag;                      // Receiver supports rexmit flag in payload packets
+    bool m_bPeerSack;                            // Peer supports selective ACK ranges in full ACK
 
     SRT_ATTR_GUARDED_BY(m_RecvAckLock)
     int32_t m_iReXmitCount;                      // Re-Transmit Count since last ACK
@@ -1105,7 +1231,8 @@ private: // Timers
                 FREQLOGFA_ENCRYPTION_FAILURE = 0,
                 FREQLOGFA_RCV_DROPPED = 1,
                 FREQLOGFA_ACKACK_OUTOFORDER = 2,
-                MAX_FREQLOGFA = 3;
+                FREQLOGFA_RCV_MEMSHARE = 3,
+                MAX_FREQLOGFA = 4;
 
     atomic_time_point m_tsLogSlowDown[MAX_FREQLOGFA]; // The last time a log message from the "slow down" group was shown.
                                                       // The "slow down" group of logs are those that can be printed too often otherwise, but can't be turned off (warnings and errors).
@@ -1122,7 +1249,7 @@ private: // Receiving related data
     SRT_ATTR_GUARDED_BY(m_RcvBufferLock)
     CRcvBuffer* m_pRcvBuffer;                    //< Receiver buffer
     SRT_ATTR_GUARDED_BY(m_RcvLossLock)
-    CRcvLossList* m_pRcvLossList;                //< Receiver loss list
+    CRcvLossRanges* m_pRcvLossList;              //< Receiver loss list
     SRT_ATTR_GUARDED_BY(m_RcvLossLock)
     std::deque<CRcvFreshLoss> m_FreshLoss;       //< Lost sequence already added to m_pRcvLossList, but not yet sent UMSG_LOSSREPORT for.
 
@@ -1138,6 +1265,7 @@ private: // Receiving related data
     int32_t m_iDebugPrevLastAck;
 #endif
     int32_t m_iRcvLastAckAck;                    // (RCV) Latest packet seqno in a sent ACK acknowledged by ACKACK. RcvQTh (sendCtrlAck {r}, processCtrlAckAck {r}, processCtrlAck {r}, connection {w}).
+    int32_t m_iRcvLastSackSeq;                   // Latest received seqno at the last full ACK with SACK ranges
     int32_t m_iAckSeqNo;                         // Last ACK sequence number
     sync::atomic<int32_t> m_iRcvCurrSeqNo;       // (RCV) Largest received sequence number. RcvQTh, TSBPDTh.
     int32_t m_iRcvCurrPhySeqNo;                  // Same as m_iRcvCurrSeqNo, but physical only (disregarding a filter)
@@ -1158,10 +1286,12 @@ private: // Receiving related data
 
     CallbackHolder<srt_listen_callback_fn> m_cbAcceptHook;
     CallbackHolder<srt_connect_callback_fn> m_cbConnectHook;
+    CallbackHolder<srt_send_complete_callback_fn> m_cbSendCompleteHook;
     // FORWARDER
 public:
     static int installAcceptHook(SRTSOCKET lsn, srt_listen_callback_fn* hook, void* opaq);
     static int installConnectHook(SRTSOCKET lsn, srt_connect_callback_fn* hook, void* opaq);
+    static int installSendCompleteHook(SRTSOCKET u, srt_send_complete_callback_fn* hook, void* opaq);
     static enum HandshakeSide compareCookies(int32_t req, int32_t res);
     static enum HandshakeSide backwardCompatibleCookieContest(int32_t req, int32_t res);
 private:
@@ -1181,6 +1311,16 @@ private:
         m_cbConnectHook.set(opaq, hook);
     }
 
+    void installSendCompleteHook(srt_send_complete_callback_fn* hook, void* opaq)
+    {
+        // Installed before connecting, as the sending thread may call it
+        // any time later. Sockets accepted from a listener inherit it.
+        if (m_bConnected || m_bConnecting || m_bBroken)
+            throw CUDTException(MJ_NOTSUP, MN_ISCONNECTED, 0);
+
+        m_cbSendCompleteHook.set(opaq, hook);
+    }
+
 
 private: // synchronization: mutexes and conditions
     sync::Mutex m_ConnectionLock;                // used to synchronize connection operation
@@ -1267,6 +1407,29 @@ private: // Generation and processing of packets
     /// @param ackdata_seqno    sequence number of a data packet being acknowledged
     void updateSndLossListOnACK(int32_t ackdata_seqno);
 
+    /// @brief Update sender's loss list on the selective ACK ranges of an incoming full ACK.
+    /// @param ackdata_seqno    sequence number of a data packet being acknowledged
+    /// @param ranges           pairs of the first and the last sequence number received after ackdata_seqno
+    /// @param nranges          number of the pairs
+    void updateSndLossListOnSACK(int32_t ackdata_seqno, const int32_t* ranges, size_t nranges);
+
+    /// @brief Advance the time-based loss detection by a packet known as delivered.
+    /// @param seqno            sequence number of a delivered data packet
+    SRT_ATTR_REQUIRES(m_RecvAckLock)
+    void rackOnDelivered(int32_t seqno);
+
+    /// @brief Add a range reported lost by the receiver, either to the sender's loss list
+    /// or, with the time-based loss detection, to the suspects.
+    /// @return number of packets added to the sender's loss list
+    SRT_ATTR_REQUIRES(m_RecvAckLock)
+    int addReportedLoss(int32_t seqno_lo, int32_t seqno_hi);
+
+    /// @brief Move the suspects that are due by the time-based rules to the sender's loss list.
+    /// @param currtime         current time
+    /// @return number of packets added to the sender's loss list
+    SRT_ATTR_REQUIRES(m_RecvAckLock)
+    int rackDetectLoss(const time_point& currtime);
+
     /// Pack a packet from a list of lost packets.
     /// @param packet [in, out] a packet structure to fill
     /// @return payload size on success, <=0 on failure
@@ -1343,6 +1506,17 @@ private: // Generation and processing of packets
     /// Expects that m_RcvBufferLock is locked.
     size_t getAvailRcvBufferSizeNoLock() const;
 
+    SRT_ATTR_REQUIRES(m_RcvBufferLock)
+    /// Retrieves the flow window to report to the peer: the available size
+    /// of the receiver buffer, limited by what is left of the fair share
+    /// of the multiplexer's receiver memory budget (see SRTO_RCVMEMLIMIT).
+    size_t getRcvFlowWindowNoLock() const;
+
+    /// True if the receiver buffer holds its full share of the receiver memory
+    /// budget while the budget runs short. Such a socket is throttled: new
+    /// packets are dropped and loss reports are limited to the first loss.
+    bool isRcvMemThrottled() const;
+
 private: // Trace
     struct CoreStats
     {
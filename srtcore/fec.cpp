@@ -15,6 +15,20 @@
 #include <vector>
 #include <deque>
 #include <iterator>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SRT_FEC_XOR_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// AVX2 is not a part of the x86 baseline, so the kernel is compiled
+// for it separately and used only when the CPU reports the support.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) \
+    && (defined(__clang__) || __GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9))
+#define SRT_FEC_XOR_AVX2 1
+#include <immintrin.h>
+#endif
 
 #include "packetfilter.h"
 #include "core.h"
@@ -39,6 +53,105 @@ namespace srt {
 
 const char FECFilterBuiltin::defaultConfig [] = "fec,rows:1,layout:staircase,arq:onreq";
 
+namespace {
+
+// The tail shorter than a word is done byte by byte in every kernel.
+void xorBytes(char* dst, const char* src, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+        dst[i] ^= src[i];
+}
+
+void xorWords(char* dst, const char* src, size_t size)
+{
+    // Four independent words per step, so that the loads can overlap.
+    size_t i = 0;
+    for (; i + 4 * sizeof(uint64_t) <= size; i += 4 * sizeof(uint64_t))
+    {
+        // memcpy avoids unaligned access and is compiled to a single move.
+        uint64_t d[4], s[4];
+        memcpy(d, dst + i, sizeof d);
+        memcpy(s, src + i, sizeof s);
+        d[0] ^= s[0];
+        d[1] ^= s[1];
+        d[2] ^= s[2];
+        d[3] ^= s[3];
+        memcpy(dst + i, d, sizeof d);
+    }
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t))
+    {
+        uint64_t d, s;
+        memcpy(&d, dst + i, sizeof d);
+        memcpy(&s, src + i, sizeof s);
+        d ^= s;
+        memcpy(dst + i, &d, sizeof d);
+    }
+    xorBytes(dst + i, src + i, size - i);
+}
+
+#if SRT_FEC_XOR_SSE2
+void xorSSE2(char* dst, const char* src, size_t size)
+{
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const __m128i d0 = _mm_loadu_si128((const __m128i*)(dst + i));
+        const __m128i d1 = _mm_loadu_si128((const __m128i*)(dst + i + 16));
+        const __m128i s0 = _mm_loadu_si128((const __m128i*)(src + i));
+        const __m128i s1 = _mm_loadu_si128((const __m128i*)(src + i + 16));
+        _mm_storeu_si128((__m128i*)(dst + i), _mm_xor_si128(d0, s0));
+        _mm_storeu_si128((__m128i*)(dst + i + 16), _mm_xor_si128(d1, s1));
+    }
+    xorWords(dst + i, src + i, size - i);
+}
+#endif
+
+#if SRT_FEC_XOR_AVX2
+__attribute__((target("avx2")))
+void xorAVX2(char* dst, const char* src, size_t size)
+{
+    size_t i = 0;
+    for (; i + 32 <= size; i += 32)
+    {
+        const __m256i d = _mm256_loadu_si256((const __m256i*)(dst + i));
+        const __m256i s = _mm256_loadu_si256((const __m256i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(d, s));
+    }
+    xorWords(dst + i, src + i, size - i);
+}
+#endif
+
+FECFilterBuiltin::XorFunc* selectXorKernel()
+{
+    return FECFilterBuiltin::XorKernels().back().func;
+}
+
+} // namespace
+
+vector<FECFilterBuiltin::XorKernel> FECFilterBuiltin::XorKernels()
+{
+    vector<XorKernel> kernels;
+    const XorKernel words = { "words", &xorWords };
+    kernels.push_back(words);
+#if SRT_FEC_XOR_SSE2
+    const XorKernel sse2 = { "sse2", &xorSSE2 };
+    kernels.push_back(sse2);
+#endif
+#if SRT_FEC_XOR_AVX2
+    // This runs also from a static initializer, possibly before
+    // the CPU features are detected by the runtime library.
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+    {
+        const XorKernel avx2 = { "avx2", &xorAVX2 };
+        kernels.push_back(avx2);
+    }
+#endif
+    return kernels;
+}
+
+FECFilterBuiltin::XorFunc* const FECFilterBuiltin::XorPayload = selectXorKernel();
+
 struct StringKeys
 {
     string operator()(const pair<const string, const string> item)
@@ -601,18 +714,12 @@ void FECFilterBuiltin::ClipData(Group& g, uint16_t length_net, uint8_t kflg,
     HLOGC(pflog.Debug, log << "FEC CLIP: data pkt.size=" << payload_size
             << " to a clip buffer size=" << payloadSize());
 
-    // Payload goes "as is".
-    for (size_t i = 0; i < payload_size; ++i)
-    {
-        g.payload_clip[i] = g.payload_clip[i] ^ payload[i];
-    }
-
-    // Fill the rest with zeros. When this packet is going to be
+    // Payload goes "as is". The rest of the clip is XOR-ed with the zero
+    // padding, which leaves it unchanged. When this packet is going to be
     // recovered, the payload extracted from this process will have
     // the maximum length, but it will be cut to the right length
     // and these padding 0s taken out.
-    for (size_t i = payload_size; i < payloadSize(); ++i)
-        g.payload_clip[i] = g.payload_clip[i] ^ 0;
+    XorPayload(&g.payload_clip[0], payload, payload_size);
 }
 
 bool FECFilterBuiltin::packControlPacket(SrtPacket& rpkt, int32_t seq)
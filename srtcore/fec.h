@@ -276,6 +276,21 @@ public:
 
     static const char defaultConfig [];
     static bool verifyConfig(const SrtFilterConfig& config, std::string& w_errormsg);
+
+    // XOR of a payload into the clip: dst[i] ^= src[i] for i < size.
+    // The buffers need not be aligned.
+    typedef void XorFunc(char* dst, const char* src, size_t size);
+    struct XorKernel
+    {
+        const char* name;
+        XorFunc* func;
+    };
+
+    // Kernels usable on this CPU, from the narrowest to the widest.
+    static std::vector<XorKernel> XorKernels();
+
+    // The widest kernel, selected at startup and used by ClipData.
+    static XorFunc* const XorPayload;
 };
 
 } // namespace srt
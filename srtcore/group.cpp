@@ -576,6 +576,13 @@ void CUDTGroup::deriveSettings(CUDT* u)
 
     IM(SRTO_UDP_SNDBUF, iUDPSndBufSize);
     IM(SRTO_UDP_RCVBUF, iUDPRcvBufSize);
+    IM(SRTO_SNDMEMLIMIT, llSndMemLimit);
+    IM(SRTO_RCVMEMLIMIT, llRcvMemLimit);
+    IM(SRTO_PACING, iPacing);
+    IM(SRTO_MUXMAXBW, llMuxMaxBW);
+    IM(SRTO_SNDMINBW, llSndMinBW);
+    IM(SRTO_SNDWEIGHT, iSndWeight);
+    IM(SRTO_SCHEDULER, iScheduler);
     // SRTO_RENDEZVOUS: impossible to have it set on a listener socket.
     // SRTO_SNDTIMEO/RCVTIMEO: groupwise setting
 
@@ -720,6 +727,18 @@ static bool getOptDefault(SRT_SOCKOPT optname, void* pw_optval, int& w_optlen)
     case SRTO_UDP_SNDBUF:
     case SRTO_UDP_RCVBUF:
         RD(CSrtConfig::DEF_UDP_BUFFER_SIZE);
+    case SRTO_SNDMEMLIMIT:
+    case SRTO_RCVMEMLIMIT:
+        RD(int64_t(0));
+    case SRTO_PACING:
+        RD(CSrtConfig::DEF_PACING);
+    case SRTO_MUXMAXBW:
+    case SRTO_SNDMINBW:
+        RD(int64_t(0));
+    case SRTO_SNDWEIGHT:
+        RD(1);
+    case SRTO_SCHEDULER:
+        RD(SRT_SCHED_TIME);
     case SRTO_RENDEZVOUS:
         RD(false);
     case SRTO_SNDTIMEO:
@@ -71,6 +71,7 @@ enum SrtOptions
                                 // (this flag can be reused for something else, when pre-1.2.0 versions are all abandoned)
     SRT_OPT_STREAM    = BIT(6), // STREAM MODE (not MESSAGE mode)
     SRT_OPT_FILTERCAP = BIT(7), // CAPABILITY: Packet filter supported
+    SRT_OPT_SACK      = BIT(8), // Full ACK may carry the ranges received after the first loss
 };
 
 inline int SrtVersionCapabilities()
@@ -0,0 +1,290 @@
+/*
+ * SRT - Secure, Reliable, Transport
+ * Copyright (c) 2024 Haivision Systems Inc.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#ifndef INC_SRT_IDTABLE_H
+#define INC_SRT_IDTABLE_H
+
+#include <cstddef>
+#include "common.h"
+#include "sync.h"
+
+namespace srt
+{
+
+/// Default for the @a Hook parameter of CIdTable: does nothing.
+struct CIdTableNoHook
+{
+    static void entering() {}
+};
+
+/// @brief Hash table mapping socket IDs to objects with lock-free lookup.
+///
+/// Readers never take a lock: they enter a read-side critical section
+/// (see @a ReadGuard), probe the table and leave. Writers must be serialized
+/// by the caller (in CUDTUnited this is the exclusive m_GlobControlLock).
+///
+/// Reclamation is epoch based: a writer that has removed an object from
+/// the table and wants to delete it (or a writer that has replaced the
+/// table storage after resizing) calls @a synchronize(), which returns only
+/// after every reader that could have seen the old state has left its
+/// critical section. Readers that need the object to live longer than the
+/// critical section must pin it by their own means (e.g. the busy counter
+/// of CUDTSocket) before leaving.
+///
+/// Socket IDs are generated sequentially, so the ID masked by the table size
+/// is a good hash; collisions are resolved by linear probing.
+///
+/// @a Hook::entering() is called by a reader between reading the epoch and
+/// registering in it. Only the unit tests use it, to make this window observable.
+template <class Value, class Hook = CIdTableNoHook>
+class CIdTable
+{
+    typedef int32_t id_type;
+
+    // Key values that never denote a valid ID (valid IDs are > 0).
+    static const id_type KEY_EMPTY = 0;
+    static const id_type KEY_TOMBSTONE = -1;
+
+    static const size_t MIN_CAPACITY = 64; // must be a power of 2
+
+    struct Slot
+    {
+        sync::atomic<id_type>  key;
+        sync::atomic<Value*> value;
+    };
+
+    struct Storage
+    {
+        Slot*  slots;
+        size_t mask;
+
+        explicit Storage(size_t capacity)
+            : slots(new Slot[capacity])
+            , mask(capacity - 1)
+        {
+        }
+
+        ~Storage() { delete[] slots; }
+
+        size_t capacity() const { return mask + 1; }
+    };
+
+public:
+    CIdTable()
+        : m_pStorage(new Storage(MIN_CAPACITY))
+        , m_zSize(0)
+        , m_zUsed(0)
+        , m_iEpoch(0)
+    {
+    }
+
+    ~CIdTable() { delete m_pStorage.load(); }
+
+    /// Read-side critical section. Pointers obtained from @a find()
+    /// stay valid until the guard is destroyed.
+    class ReadGuard
+    {
+    public:
+        explicit ReadGuard(const CIdTable& table)
+            : m_table(table)
+            , m_iEpoch(enter(table))
+        {
+        }
+
+        ~ReadGuard() { --m_table.m_aiReaders[m_iEpoch]; }
+
+    private:
+        // Register the reader in the current epoch. If synchronize() flipped
+        // the epoch between reading it and registering, the writer may have
+        // already drained the counter, so the registration is retried.
+        static int enter(const CIdTable& table)
+        {
+            for (;;)
+            {
+                const int epoch = table.m_iEpoch.load() & 1;
+                Hook::entering();
+                ++table.m_aiReaders[epoch];
+                if ((table.m_iEpoch.load() & 1) == epoch)
+                    return epoch;
+                --table.m_aiReaders[epoch];
+            }
+        }
+
+        const CIdTable& m_table;
+        const int       m_iEpoch;
+
+        ReadGuard(const ReadGuard&);
+        ReadGuard& operator=(const ReadGuard&);
+    };
+
+    /// Find the object by ID. Lock-free; must be called either
+    /// with a ReadGuard in scope or by the (serialized) writer.
+    /// @return the object, or NULL if not present
+    Value* find(id_type id) const
+    {
+        const Storage* st = m_pStorage.load();
+        for (size_t i = size_t(id) & st->mask, n = 0; n <= st->mask; i = (i + 1) & st->mask, ++n)
+        {
+            const id_type k = st->slots[i].key.load();
+            if (k == KEY_EMPTY)
+                return NULL;
+            if (k == id)
+                return st->slots[i].value.load();
+        }
+        return NULL;
+    }
+
+    /// Insert or replace the object for given ID. Writer only.
+    void insert(id_type id, Value* val)
+    {
+        SRT_ASSERT(id > 0 && val != NULL);
+
+        // Keep the load factor (including tombstones) below 3/4.
+        if ((m_zUsed + 1) * 4 > m_pStorage.load()->capacity() * 3)
+            rehash();
+
+        Storage* st = m_pStorage.load();
+        size_t   free_slot = st->capacity();
+        for (size_t i = size_t(id) & st->mask, n = 0; n <= st->mask; i = (i + 1) & st->mask, ++n)
+        {
+            const id_type k = st->slots[i].key.load();
+            if (k == id)
+            {
+                st->slots[i].value.store(val);
+                return;
+            }
+            if (k == KEY_TOMBSTONE && free_slot == st->capacity())
+                free_slot = i;
+            if (k == KEY_EMPTY)
+            {
+                if (free_slot == st->capacity())
+                {
+                    free_slot = i;
+                    ++m_zUsed;
+                }
+                break;
+            }
+        }
+
+        // The value must be visible before the key, so that a reader
+        // that matches the key never sees a stale value.
+        st->slots[free_slot].value.store(val);
+        st->slots[free_slot].key.store(id);
+        ++m_zSize;
+    }
+
+    /// Remove the object for given ID. Writer only. The object must not
+    /// be deleted before @a synchronize() is called after this call.
+    /// @return true if the ID was found
+    bool erase(id_type id)
+    {
+        Storage* st = m_pStorage.load();
+        for (size_t i = size_t(id) & st->mask, n = 0; n <= st->mask; i = (i + 1) & st->mask, ++n)
+        {
+            const id_type k = st->slots[i].key.load();
+            if (k == KEY_EMPTY)
+                return false;
+            if (k == id)
+            {
+                st->slots[i].value.store(NULL);
+                st->slots[i].key.store(KEY_TOMBSTONE);
+                --m_zSize;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// Remove all entries. Writer only.
+    void clear()
+    {
+        Storage* old = m_pStorage.exchange(new Storage(MIN_CAPACITY));
+        m_zSize = 0;
+        m_zUsed = 0;
+        synchronize();
+        delete old;
+    }
+
+    /// Drop all entries without waiting for readers. To be used only
+    /// in the child process after fork(), where no other threads exist.
+    void resetAtFork()
+    {
+        delete m_pStorage.exchange(new Storage(MIN_CAPACITY));
+        m_zSize = 0;
+        m_zUsed = 0;
+        m_aiReaders[0] = 0;
+        m_aiReaders[1] = 0;
+    }
+
+    size_t size() const { return m_zSize; }
+
+    /// Wait until all readers that have entered their critical section
+    /// before this call have left it. Writer only.
+    void synchronize()
+    {
+        // Flip the epoch so that new readers are counted separately,
+        // then wait for the readers of the previous epoch to drain.
+        const int old_epoch = m_iEpoch.load() & 1;
+        m_iEpoch.store(old_epoch ^ 1);
+
+        for (int spin = 0; m_aiReaders[old_epoch].load() != 0; ++spin)
+        {
+            // Readers stay in the critical section only for a single
+            // probe, so this normally completes after a few iterations.
+            if (spin > 64)
+                sync::this_thread::sleep_for(sync::microseconds_from(10));
+        }
+    }
+
+private:
+    void rehash()
+    {
+        Storage* old = m_pStorage.load();
+
+        // Grow only if the live entries need it; otherwise just
+        // rebuild the table in the same size to drop tombstones.
+        size_t capacity = old->capacity();
+        while ((m_zSize + 1) * 2 > capacity)
+            capacity *= 2;
+
+        Storage* st = new Storage(capacity);
+        for (size_t i = 0; i < old->capacity(); ++i)
+        {
+            const id_type k = old->slots[i].key.load();
+            if (k == KEY_EMPTY || k == KEY_TOMBSTONE)
+                continue;
+
+            size_t j = size_t(k) & st->mask;
+            while (st->slots[j].key.load() != KEY_EMPTY)
+                j = (j + 1) & st->mask;
+            st->slots[j].value.store(old->slots[i].value.load());
+            st->slots[j].key.store(k);
+        }
+        m_zUsed = m_zSize;
+
+        m_pStorage.store(st);
+        synchronize();
+        delete old;
+    }
+
+    sync::atomic<Storage*> m_pStorage;
+    size_t                 m_zSize; // live entries (writer only)
+    size_t                 m_zUsed; // live entries and tombstones (writer only)
+
+    sync::atomic<int>         m_iEpoch;
+    mutable sync::atomic<int> m_aiReaders[2];
+
+    CIdTable(const CIdTable&);
+    CIdTable& operator=(const CIdTable&);
+};
+
+} // namespace srt
+
+#endif
@@ -52,6 +52,8 @@ modified by
 
 #include "platform_sys.h"
 
+#include <algorithm>
+
 #include "list.h"
 #include "packet.h"
 #include "logging.h"
@@ -474,6 +476,206 @@ bool srt::CSndLossList::updateElement(int pos, int32_t seqno1, int32_t seqno2)
 
 ////////////////////////////////////////////////////////////////////////////////
 
+// The bitmap covers twice the size, so that a new loss up to @a size
+// after the first one can be inserted as a range of up to @a size, or
+// a loss preceding the first one extends the window backwards.
+srt::CSndLossSet::CSndLossSet(int size)
+    : m_Lost(size_t(2 * size))
+    , m_iSize(size)
+    , m_iHeadSeq(SRT_SEQNO_NONE)
+    , m_zHeadPos(0)
+    , m_iSpan(0)
+    , m_iLength(0)
+{
+    setupMutex(m_ListLock, "LossList");
+}
+
+srt::CSndLossSet::~CSndLossSet()
+{
+    releaseMutex(m_ListLock);
+}
+
+void srt::CSndLossSet::traceState() const
+{
+    traceState(std::cout) << "\n";
+}
+
+int srt::CSndLossSet::insert(int32_t seqno1, int32_t seqno2)
+{
+    if (seqno1 < 0 || seqno2 < 0)
+    {
+        LOGC(qslog.Error, log << "IPE: Tried to insert negative seqno " << seqno1 << ":" << seqno2
+            << " into sender's loss list. Ignoring.");
+        return 0;
+    }
+
+    const int inserted_range = CSeqNo::seqlen(seqno1, seqno2);
+    if (inserted_range <= 0 || inserted_range >= m_iSize)
+    {
+        LOGC(qslog.Error, log << "IPE: Tried to insert too big range of seqno: " << inserted_range << ". Ignoring. "
+                << "seqno " << seqno1 << ":" << seqno2);
+        return 0;
+    }
+
+    ScopedLock listguard(m_ListLock);
+
+    if (m_iLength == 0)
+    {
+        m_iHeadSeq = seqno1;
+        m_zHeadPos = 0;
+        m_Lost.setRange(0, size_t(inserted_range), true);
+        m_iSpan   = inserted_range;
+        m_iLength = inserted_range;
+        return m_iLength;
+    }
+
+    int offset = CSeqNo::seqoff(m_iHeadSeq, seqno1);
+    if (offset >= m_iSize)
+    {
+        LOGC(qslog.Error, log << "IPE: New loss record is too far from the first record. Ignoring. "
+                << "First loss seqno " << m_iHeadSeq << ", insert seqno " << seqno1 << ":" << seqno2);
+        return 0;
+    }
+
+    if (offset < 0)
+    {
+        // Extend the window backwards; the new range becomes the head.
+        const int span = std::max(m_iSpan, offset + inserted_range) - offset;
+        if (span > int(m_Lost.size()))
+        {
+            LOGC(qslog.Error, log << "IPE: New loss record is too old. Ignoring. "
+                    << "First loss seqno " << m_iHeadSeq << ", insert seqno " << seqno1 << ":" << seqno2);
+            return 0;
+        }
+
+        m_zHeadPos = posAt(offset + int(m_Lost.size()));
+        m_iHeadSeq = seqno1;
+        m_iSpan    = span;
+        offset     = 0;
+    }
+
+    const size_t pos   = posAt(offset);
+    const int    added = inserted_range - int(m_Lost.count(pos, size_t(inserted_range)));
+    m_Lost.setRange(pos, size_t(inserted_range), true);
+    m_iSpan = std::max(m_iSpan, offset + inserted_range);
+    m_iLength += added;
+    return added;
+}
+
+void srt::CSndLossSet::removeUpTo(int32_t seqno)
+{
+    ScopedLock listguard(m_ListLock);
+
+    if (m_iLength == 0)
+        return;
+
+    const int offset = CSeqNo::seqoff(m_iHeadSeq, seqno);
+    if (offset < 0)
+        return;
+
+    if (offset >= m_iSpan - 1)
+    {
+        m_Lost.setRange(m_zHeadPos, size_t(m_iSpan), false);
+        m_iHeadSeq = SRT_SEQNO_NONE;
+        m_iSpan    = 0;
+        m_iLength  = 0;
+        return;
+    }
+
+    m_iLength -= int(m_Lost.count(m_zHeadPos, size_t(offset + 1)));
+    m_Lost.setRange(m_zHeadPos, size_t(offset + 1), false);
+    advanceHead(offset + 1);
+}
+
+int srt::CSndLossSet::remove(int32_t seqno1, int32_t seqno2)
+{
+    ScopedLock listguard(m_ListLock);
+
+    if (m_iLength == 0)
+        return 0;
+
+    const int lo = std::max(CSeqNo::seqoff(m_iHeadSeq, seqno1), 0);
+    const int hi = std::min(CSeqNo::seqoff(m_iHeadSeq, seqno2), m_iSpan - 1);
+    if (lo > hi)
+        return 0;
+
+    const size_t pos     = posAt(lo);
+    const int    removed = int(m_Lost.count(pos, size_t(hi - lo + 1)));
+    if (removed == 0)
+        return 0;
+
+    m_Lost.setRange(pos, size_t(hi - lo + 1), false);
+    m_iLength -= removed;
+    if (m_iLength == 0)
+    {
+        m_iHeadSeq = SRT_SEQNO_NONE;
+        m_iSpan    = 0;
+    }
+    else if (lo == 0)
+    {
+        advanceHead(hi + 1);
+    }
+
+    return removed;
+}
+
+int srt::CSndLossSet::getLossLength() const
+{
+    ScopedLock listguard(m_ListLock);
+
+    return m_iLength;
+}
+
+int32_t srt::CSndLossSet::popLostSeq()
+{
+    ScopedLock listguard(m_ListLock);
+
+    if (m_iLength == 0)
+        return SRT_SEQNO_NONE;
+
+    const int32_t seqno = m_iHeadSeq;
+    m_Lost.clear(m_zHeadPos);
+    if (--m_iLength == 0)
+    {
+        m_iHeadSeq = SRT_SEQNO_NONE;
+        m_iSpan    = 0;
+        return seqno;
+    }
+
+    advanceHead(1);
+    return seqno;
+}
+
+int32_t srt::CSndLossSet::getNextLostSeq(int32_t seqno) const
+{
+    ScopedLock listguard(m_ListLock);
+
+    if (m_iLength == 0)
+        return SRT_SEQNO_NONE;
+
+    const int off = std::max(CSeqNo::seqoff(m_iHeadSeq, seqno) + 1, 0);
+    if (off >= m_iSpan)
+        return SRT_SEQNO_NONE;
+
+    const int next = m_Lost.findNext(posAt(off), size_t(m_iSpan - off), true);
+    if (next < 0)
+        return SRT_SEQNO_NONE;
+
+    return CSeqNo::incseq(m_iHeadSeq, off + next);
+}
+
+void srt::CSndLossSet::advanceHead(int off)
+{
+    const int next = m_Lost.findNext(posAt(off), size_t(m_iSpan - off), true);
+    SRT_ASSERT(next >= 0);
+    off += next;
+    m_zHeadPos = posAt(off);
+    m_iHeadSeq = CSeqNo::incseq(m_iHeadSeq, off);
+    m_iSpan -= off;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
 srt::CRcvLossList::CRcvLossList(int size)
     : m_caSeq()
     , m_iHead(-1)
@@ -814,6 +1016,297 @@ void srt::CRcvLossList::getLossArray(int32_t* array, int& len, int limit)
     }
 }
 
+srt::CRcvLossRanges::CRcvLossRanges()
+    : m_iLength(0)
+    , m_iLargestSeq(SRT_SEQNO_NONE)
+    , m_zClean(0)
+    , m_zReportEnd(0)
+{
+}
+
+srt::CRcvLossRanges::~CRcvLossRanges() {}
+
+int srt::CRcvLossRanges::insert(int32_t seqno1, int32_t seqno2)
+{
+    SRT_ASSERT(seqno1 != SRT_SEQNO_NONE && seqno2 != SRT_SEQNO_NONE);
+    // Make sure that seqno2 isn't earlier than seqno1.
+    SRT_ASSERT(CSeqNo::seqcmp(seqno1, seqno2) <= 0);
+
+    // Data to be inserted must be larger than all those in the list
+    if (m_iLargestSeq != SRT_SEQNO_NONE && CSeqNo::seqcmp(seqno1, m_iLargestSeq) <= 0)
+    {
+        if (CSeqNo::seqcmp(seqno2, m_iLargestSeq) > 0)
+        {
+            LOGC(qrlog.Warn,
+                 log << "RCV-LOSS/insert: seqno1=" << seqno1 << " too small, adjust to "
+                     << CSeqNo::incseq(m_iLargestSeq));
+            seqno1 = CSeqNo::incseq(m_iLargestSeq);
+        }
+        else
+        {
+            LOGC(qrlog.Warn,
+                 log << "RCV-LOSS/insert: (" << seqno1 << "," << seqno2
+                     << ") to be inserted is too small: m_iLargestSeq=" << m_iLargestSeq << ", m_iLength=" << m_iLength
+                     << ", ranges=" << m_Ranges.size() << " -- REJECTING");
+            return 0;
+        }
+    }
+    m_iLargestSeq = seqno2;
+
+    if (!m_Ranges.empty() && CSeqNo::seqcmp(seqno1, m_Ranges.front().first) < 0)
+    {
+        LOGC(qrlog.Error,
+             log << "RCV-LOSS/insert: IPE: new LOSS %(" << seqno1 << "-" << seqno2 << ") PREDATES HEAD %"
+                 << m_Ranges.front().first << " -- REJECTING");
+        return -1;
+    }
+
+    if (!m_Ranges.empty() && CSeqNo::incseq(m_Ranges.back().last) == seqno1)
+    {
+        // coalesce with the last range, e.g., [2, 5], [6, 7] becomes [2, 7]
+        invalidate(m_Ranges.size() - 1);
+        m_Ranges.back().last = seqno2;
+    }
+    else
+    {
+        const Range r = {seqno1, seqno2, 0};
+        m_Ranges.push_back(r);
+    }
+
+    const int n = CSeqNo::seqlen(seqno1, seqno2);
+    m_iLength += n;
+    return n;
+}
+
+bool srt::CRcvLossRanges::remove(int32_t seqno)
+{
+    bool removed;
+    removeRange(seqno, seqno, (removed));
+    return removed;
+}
+
+bool srt::CRcvLossRanges::remove(int32_t seqno1, int32_t seqno2)
+{
+    if (CSeqNo::seqcmp(seqno1, seqno2) > 0)
+        return false;
+
+    bool last_removed;
+    removeRange(seqno1, seqno2, (last_removed));
+    return true;
+}
+
+int32_t srt::CRcvLossRanges::removeUpTo(int32_t seqno_last)
+{
+    const int32_t first = getFirstLostSeq();
+    if (first == SRT_SEQNO_NONE || CSeqNo::seqcmp(seqno_last, first) < 0)
+        return first; // nothing to remove
+
+    HLOGC(tslog.Debug, log << "rcv-loss: DROP to %" << seqno_last << " ...");
+
+    bool last_removed;
+    removeRange(first, seqno_last, (last_removed));
+    return first;
+}
+
+bool srt::CRcvLossRanges::find(int32_t seqno1, int32_t seqno2) const
+{
+    const size_t i = findRange(seqno1);
+    return i < m_Ranges.size() && CSeqNo::seqcmp(m_Ranges[i].first, seqno2) <= 0;
+}
+
+size_t srt::CRcvLossRanges::findRange(int32_t seqno) const
+{
+    return std::lower_bound(m_Ranges.begin(), m_Ranges.end(), seqno, LastEarlier()) - m_Ranges.begin();
+}
+
+int srt::CRcvLossRanges::removeRange(int32_t lo, int32_t hi, bool& w_hi_removed)
+{
+    w_hi_removed = false;
+
+    // Same as removing the sequences one by one with CRcvLossList::remove(seqno):
+    // the largest sequence is updated even if nothing is removed, and reset
+    // when the list becomes empty by removing hi.
+    const bool was_empty = m_Ranges.empty();
+    if (m_iLargestSeq == SRT_SEQNO_NONE || CSeqNo::seqcmp(hi, m_iLargestSeq) > 0)
+        m_iLargestSeq = hi;
+
+    int removed = 0;
+    for (size_t i = findRange(lo); i < m_Ranges.size() && CSeqNo::seqcmp(m_Ranges[i].first, hi) <= 0;)
+    {
+        Range&     r         = m_Ranges[i];
+        const bool from_head = CSeqNo::seqcmp(lo, r.first) <= 0;
+        const bool to_tail   = CSeqNo::seqcmp(hi, r.last) >= 0;
+
+        if (from_head && to_tail)
+        {
+            removed += CSeqNo::seqlen(r.first, r.last);
+            w_hi_removed = (hi == r.last);
+            erase(i);
+        }
+        else if (from_head)
+        {
+            // [first, hi] removed, the rest of the range stays
+            removed += CSeqNo::seqlen(r.first, hi);
+            w_hi_removed = true;
+            setFirst(i, CSeqNo::incseq(hi));
+            break;
+        }
+        else if (to_tail)
+        {
+            // [lo, last] removed, the beginning of the range stays
+            removed += CSeqNo::seqlen(lo, r.last);
+            w_hi_removed = (hi == r.last);
+            invalidate(i);
+            r.last = CSeqNo::decseq(lo);
+            ++i;
+        }
+        else
+        {
+            // [lo, hi] removed from the middle, split the range
+            removed += CSeqNo::seqlen(lo, hi);
+            w_hi_removed = true;
+            invalidate(i);
+            const Range tail = {CSeqNo::incseq(hi), r.last, 0};
+            r.last = CSeqNo::decseq(lo);
+            m_Ranges.insert(m_Ranges.begin() + (i + 1), tail);
+            break;
+        }
+    }
+
+    m_iLength -= removed;
+    if (!was_empty && m_Ranges.empty())
+        m_iLargestSeq = w_hi_removed ? SRT_SEQNO_NONE : hi;
+
+    return removed;
+}
+
+void srt::CRcvLossRanges::setFirst(size_t idx, int32_t seqno)
+{
+    Range& r = m_Ranges[idx];
+    if (idx == 0 && m_zClean > 0)
+    {
+        // The first range only got shorter, so encode it again in place,
+        // ending where it did, and the report will start there.
+        const size_t end = r.pos + width(r);
+        r.first          = seqno;
+        r.pos            = end - width(r);
+        encode(r);
+        return;
+    }
+
+    invalidate(idx);
+    r.first = seqno;
+}
+
+void srt::CRcvLossRanges::erase(size_t idx)
+{
+    if (idx == 0)
+    {
+        // The report will simply start at the next range.
+        if (m_zClean > 0 && --m_zClean == 0)
+            m_zReportEnd = 0;
+        m_Ranges.pop_front();
+        return;
+    }
+
+    invalidate(idx);
+    m_Ranges.erase(m_Ranges.begin() + idx);
+}
+
+void srt::CRcvLossRanges::encode(const Range& r)
+{
+    if (r.first == r.last)
+    {
+        m_aiReport[r.pos] = r.first;
+    }
+    else
+    {
+        m_aiReport[r.pos]     = r.first | LOSSDATA_SEQNO_RANGE_FIRST;
+        m_aiReport[r.pos + 1] = r.last;
+    }
+}
+
+void srt::CRcvLossRanges::invalidate(size_t idx)
+{
+    if (idx >= m_zClean)
+        return;
+
+    m_zClean     = idx;
+    m_zReportEnd = idx > 0 ? m_Ranges[idx].pos : 0;
+}
+
+const int32_t* srt::CRcvLossRanges::getLossReport(int& len, int limit)
+{
+    size_t begin = m_zClean > 0 ? m_Ranges[0].pos : 0;
+
+    // Ranges removed from the front leave free space before the report.
+    // Move the report to the beginning once that space exceeds its size.
+    if (begin > 0 && begin >= m_zReportEnd - begin)
+    {
+        std::copy(m_aiReport.begin() + begin, m_aiReport.begin() + m_zReportEnd, m_aiReport.begin());
+        for (size_t i = 0; i < m_zClean; ++i)
+            m_Ranges[i].pos -= begin;
+        m_zReportEnd -= begin;
+        begin = 0;
+    }
+
+    const size_t maxlen = size_t(std::max(limit, 0));
+    size_t       n      = m_zReportEnd - begin;
+    if (n <= maxlen)
+    {
+        // Encode the ranges added or changed since the previous call,
+        // as long as they fit in the limit, oldest first.
+        for (; m_zClean < m_Ranges.size(); ++m_zClean)
+        {
+            Range& r = m_Ranges[m_zClean];
+            const int w = width(r);
+            if (n + w > maxlen)
+                break;
+
+            if (m_aiReport.size() < m_zReportEnd + w)
+                m_aiReport.resize(m_zReportEnd + w);
+            r.pos = m_zReportEnd;
+            encode(r);
+            m_zReportEnd += w;
+            n += w;
+        }
+    }
+    else
+    {
+        // Encoded before with a higher limit; cut at the last range that fits.
+        n = 0;
+        for (size_t i = 0; i < m_zClean && n + width(m_Ranges[i]) <= maxlen; ++i)
+            n += width(m_Ranges[i]);
+    }
+
+    len = int(n);
+    return m_aiReport.empty() ? NULL : &m_aiReport[begin];
+}
+
+int srt::CRcvLossRanges::getReceivedRanges(int32_t last_rcvd, int32_t* w_ranges, int max) const
+{
+    int n = 0;
+    for (size_t i = 0; i < m_Ranges.size() && n < max; ++i)
+    {
+        const int32_t first = CSeqNo::incseq(m_Ranges[i].last);
+        const int32_t last  = (i + 1 < m_Ranges.size()) ? CSeqNo::decseq(m_Ranges[i + 1].first) : last_rcvd;
+        if (CSeqNo::seqcmp(first, last) > 0)
+            break; // nothing received after the last loss
+
+        w_ranges[2 * n]     = first;
+        w_ranges[2 * n + 1] = last;
+        ++n;
+    }
+    return n;
+}
+
+void srt::CRcvLossRanges::getLossArray(int32_t* array, int& len, int limit)
+{
+    const int32_t* report = getLossReport((len), limit);
+    if (len > 0)
+        std::copy(report, report + len, array);
+}
+
 srt::CRcvFreshLoss::CRcvFreshLoss(int32_t seqlo, int32_t seqhi, int initial_age)
     : ttl(initial_age)
     , timestamp(steady_clock::now())
@@ -54,9 +54,11 @@ modified by
 #define INC_SRT_LIST_H
 
 #include <deque>
+#include <vector>
 
 #include "udt.h"
 #include "common.h"
+#include "utilities.h"
 
 namespace srt {
 
@@ -154,6 +156,102 @@ private:
 
 ////////////////////////////////////////////////////////////////////////////////
 
+/// Sender loss list for large flight windows, with the same interface
+/// and behavior as CSndLossList.
+///
+/// The lost sequence numbers are marked in a bitmap over the window that
+/// starts at the first loss. Inserting or removing a range takes time
+/// proportional to the number of bitmap words it covers (64 sequence
+/// numbers per word), regardless of how many other ranges are in the list,
+/// and finding the next loss after @a popLostSeq skips whole words of
+/// sequence numbers that are not lost. CSndLossList instead has to walk its
+/// list of ranges to find the place of a new range, which becomes expensive
+/// with scattered losses over tens of thousands of packets in flight.
+class CSndLossSet
+{
+public:
+    /// @param size maximum distance of a new loss from the first loss in the list
+    CSndLossSet(int size = 1024);
+    ~CSndLossSet();
+
+    /// Insert a seq. no. into the sender loss list.
+    /// @param [in] seqno1 sequence number starts.
+    /// @param [in] seqno2 sequence number ends.
+    /// @return number of packets that are not in the list previously.
+    int insert(int32_t seqno1, int32_t seqno2);
+
+    /// Remove the given sequence number and all numbers that precede it.
+    /// @param [in] seqno sequence number.
+    void removeUpTo(int32_t seqno);
+
+    /// Remove the sequence numbers between seqno1 and seqno2.
+    /// @param [in] seqno1 sequence number starts.
+    /// @param [in] seqno2 sequence number ends.
+    /// @return number of packets removed from the list.
+    int remove(int32_t seqno1, int32_t seqno2);
+
+    /// Read the loss length.
+    /// @return The length of the list.
+    int getLossLength() const;
+
+    /// Read the first (smallest) loss seq. no. in the list and remove it.
+    /// @return The seq. no. or -1 if the list is empty.
+    int32_t popLostSeq();
+
+    /// Read the first (smallest) loss seq. no. in the list without removing it.
+    /// @return The seq. no. or -1 if the list is empty.
+    int32_t getFirstLostSeq() const { return m_iHeadSeq; }
+
+    /// Read the first loss seq. no. that follows @a seqno.
+    /// @return The seq. no. or -1 if there is no loss after @a seqno.
+    int32_t getNextLostSeq(int32_t seqno) const;
+
+    template <class Stream>
+    Stream& traceState(Stream& sout) const
+    {
+        for (int off = 0; off < m_iSpan;)
+        {
+            const int first = m_Lost.findNext(posAt(off), size_t(m_iSpan - off), true);
+            if (first < 0)
+                break;
+            off += first;
+            const int len = m_Lost.findNext(posAt(off), size_t(m_iSpan - off), false);
+            const int end = (len < 0) ? m_iSpan : off + len;
+            sout << CSeqNo::incseq(m_iHeadSeq, off);
+            if (end - off > 1)
+                sout << ":" << CSeqNo::incseq(m_iHeadSeq, end - 1);
+            sout << ", ";
+            off = end;
+        }
+        sout << " {len:" << m_iLength << " span:" << m_iSpan << "}";
+        return sout;
+    }
+    void traceState() const;
+
+private:
+    /// Position in the bitmap of the sequence number at @a off from the first loss.
+    size_t posAt(int off) const { return (m_zHeadPos + size_t(off)) % m_Lost.size(); }
+
+    /// Move the head to the first loss found at or after @a off.
+    /// There must be one (m_iLength > 0).
+    void advanceHead(int off);
+
+    CircularBitmap m_Lost;     // lost sequence numbers, m_zHeadPos is the first loss
+    const int      m_iSize;    // maximum distance of a new loss from the first loss
+    int32_t        m_iHeadSeq; // first loss, SRT_SEQNO_NONE if the list is empty
+    size_t         m_zHeadPos; // position of m_iHeadSeq in m_Lost
+    int            m_iSpan;    // offset of the last loss from the first loss, plus 1
+    int            m_iLength;  // loss length
+
+    mutable srt::sync::Mutex m_ListLock; // used to synchronize list operation
+
+private:
+    CSndLossSet(const CSndLossSet&);
+    CSndLossSet& operator=(const CSndLossSet&);
+};
+
+////////////////////////////////////////////////////////////////////////////////
+
 class CRcvLossList
 {
 public:
@@ -276,6 +374,126 @@ public:
     iterator end() { return iterator(m_caSeq, -1); }
 };
 
+////////////////////////////////////////////////////////////////////////////////
+
+/// Receiver loss list with the same behavior as CRcvLossList, which keeps
+/// the loss ranges in a sorted array and the encoded NAK report between
+/// reports.
+///
+/// The ranges are located by binary search, and removing a span of
+/// sequence numbers (as on drop or ACK) touches only the ranges it covers.
+/// CRcvLossList instead removes sequence numbers one by one and walks its
+/// list of ranges for @a find.
+///
+/// The report is not rebuilt on every NAK period. Each range remembers
+/// where it was encoded, and a change marks that place as the end of the
+/// still valid part of the report. Ranges removed or shortened at the front
+/// (the usual effect of the oldest losses being recovered) are handled in
+/// place, and new ranges are only appended at the end. So @a getLossReport
+/// encodes only the ranges added or changed since the previous call.
+class CRcvLossRanges
+{
+public:
+    CRcvLossRanges();
+    ~CRcvLossRanges();
+
+    /// Insert a series of loss seq. no. between "seqno1" and "seqno2" into the receiver's loss list.
+    /// @param [in] seqno1 sequence number starts.
+    /// @param [in] seqno2 sequence number ends.
+    /// @return length of the loss record inserted (seqlen(seqno1, seqno2)), -1 on error.
+    int insert(int32_t seqno1, int32_t seqno2);
+
+    /// Remove a loss seq. no. from the receiver's loss list.
+    /// @param [in] seqno sequence number.
+    /// @return if the packet is removed (true) or no such lost packet is found (false).
+    bool remove(int32_t seqno);
+
+    /// Remove all packets between seqno1 and seqno2.
+    /// @param [in] seqno1 start sequence number.
+    /// @param [in] seqno2 end sequence number.
+    /// @return false if seqno1 is later than seqno2, otherwise true.
+    bool remove(int32_t seqno1, int32_t seqno2);
+
+    /// Remove all numbers up to and including the given sequence number.
+    /// @param [in] seqno sequence number.
+    /// @return the first lost sequence number before removal.
+    int32_t removeUpTo(int32_t seqno);
+
+    /// Find if there is any lost packets whose sequence number falling seqno1 and seqno2.
+    /// @param [in] seqno1 start sequence number.
+    /// @param [in] seqno2 end sequence number.
+    /// @return True if found; otherwise false.
+    bool find(int32_t seqno1, int32_t seqno2) const;
+
+    /// Read the loss length.
+    /// @return the length of the list.
+    int getLossLength() const { return m_iLength; }
+
+    /// Read the first (smallest) seq. no. in the list.
+    /// @return the sequence number or -1 if the list is empty.
+    int32_t getFirstLostSeq() const { return m_Ranges.empty() ? SRT_SEQNO_NONE : m_Ranges.front().first; }
+
+    /// Get the encoded loss report for NAK, the oldest losses first.
+    /// @param [out] len physical length of the report.
+    /// @param [in] limit maximum length of the report.
+    /// @return the report, valid until the list is modified.
+    const int32_t* getLossReport(int& len, int limit);
+
+    /// Get a encoded loss array for NAK report (a copy of @a getLossReport).
+    /// @param [out] array the result list of seq. no. to be included in NAK.
+    /// @param [out] len physical length of the result array.
+    /// @param [in] limit maximum length of the array.
+    void getLossArray(int32_t* array, int& len, int limit);
+
+    /// Get the ranges of sequence numbers received between the losses
+    /// and after the last loss, the oldest first.
+    /// @param [in] last_rcvd the latest received sequence number.
+    /// @param [out] w_ranges pairs of the first and the last sequence number of each range.
+    /// @param [in] max maximum number of the ranges.
+    /// @return the number of the ranges.
+    int getReceivedRanges(int32_t last_rcvd, int32_t* w_ranges, int max) const;
+
+private:
+    struct Range
+    {
+        int32_t first;
+        int32_t last;
+        size_t  pos; // position in m_aiReport, valid for the first m_zClean ranges
+    };
+
+    struct LastEarlier
+    {
+        bool operator()(const Range& r, int32_t seqno) const { return CSeqNo::seqcmp(r.last, seqno) < 0; }
+    };
+
+    static int width(const Range& r) { return r.first == r.last ? 1 : 2; }
+
+    /// Index of the first range that ends at or after the given sequence.
+    size_t findRange(int32_t seqno) const;
+
+    /// Remove the losses between lo and hi.
+    /// @param [out] w_hi_removed set to true if hi was in the list
+    /// @return the number of removed sequences
+    int removeRange(int32_t lo, int32_t hi, bool& w_hi_removed);
+
+    void setFirst(size_t idx, int32_t seqno);
+    void erase(size_t idx);
+    void encode(const Range& r);
+    void invalidate(size_t idx);
+
+    std::deque<Range> m_Ranges;
+    int               m_iLength;     // loss length
+    int32_t           m_iLargestSeq; // largest seq ever seen
+
+    std::vector<int32_t> m_aiReport;   // encoded report, starts at the first range's pos
+    size_t               m_zClean;     // number of leading ranges encoded in m_aiReport
+    size_t               m_zReportEnd; // end of the encoded ranges in m_aiReport
+
+private:
+    CRcvLossRanges(const CRcvLossRanges&);
+    CRcvLossRanges& operator=(const CRcvLossRanges&);
+};
+
 struct CRcvFreshLoss
 {
     int32_t                             seq[2];
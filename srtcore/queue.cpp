@@ -52,6 +52,8 @@ modified by
 
 #include "platform_sys.h"
 
+#include <algorithm>
+#include <climits>
 #include <cstring>
 
 #include "common.h"
@@ -65,10 +67,14 @@ using namespace std;
 using namespace srt::sync;
 using namespace srt_logging;
 
+const int srt::CUnitQueue::MIN_RESERVED_UNITS;
+
 srt::CUnitQueue::CUnitQueue(int initNumUnits, int mss)
     : m_iNumTaken(0)
     , m_iMSS(mss)
     , m_iBlockSize(initNumUnits)
+    , m_iMaxUnits(0)
+    , m_iNumUsers(0)
 {
     CQEntry* tempq = allocateEntry(m_iBlockSize, m_iMSS);
 
@@ -157,7 +163,9 @@ int srt::CUnitQueue::increase_()
 srt::CUnit* srt::CUnitQueue::getNextAvailUnit()
 {
     const int iNumUnitsTotal = capacity();
-    if (m_iNumTaken * 10 > iNumUnitsTotal * 9) // 90% or more are in use.
+    const int iMaxUnits      = m_iMaxUnits;
+    if (m_iNumTaken * 10 > iNumUnitsTotal * 9 // 90% or more are in use.
+        && (iMaxUnits == 0 || iNumUnitsTotal < iMaxUnits))
         increase_();
 
     if (m_iNumTaken >= capacity())
@@ -185,6 +193,35 @@ srt::CUnit* srt::CUnitQueue::getNextAvailUnit()
     return NULL;
 }
 
+void srt::CUnitQueue::setMemoryLimit(int64_t bytes)
+{
+    if (bytes <= 0)
+    {
+        m_iMaxUnits = 0;
+        return;
+    }
+
+    const int64_t units = bytes / m_iMSS;
+    m_iMaxUnits = int(std::min<int64_t>(std::max<int64_t>(units, m_iBlockSize), INT_MAX));
+}
+
+int srt::CUnitQueue::fairShare() const
+{
+    const int max_units = m_iMaxUnits;
+    if (max_units == 0)
+        return INT_MAX;
+
+    const int users = std::max(1, m_iNumUsers.load());
+    return std::max<int>(max_units / users, MIN_RESERVED_UNITS);
+}
+
+bool srt::CUnitQueue::underPressure() const
+{
+    const int max_units = m_iMaxUnits;
+    // 75% or more of the budget is in use.
+    return max_units != 0 && m_iNumTaken * 4 >= max_units * 3;
+}
+
 void srt::CUnitQueue::makeUnitFree(CUnit* unit)
 {
     SRT_ASSERT(unit != NULL);
@@ -208,6 +245,8 @@ srt::CSndUList::CSndUList(sync::CTimer* pTimer)
     , m_iArrayLength(512)
     , m_iLastEntry(-1)
     , m_ListLock()
+    , m_iScheduler(SRT_SCHED_TIME)
+    , m_pDueTurn(NULL)
     , m_pTimer(pTimer)
 {
     setupCond(m_ListCond, "CSndUListCond");
@@ -231,6 +270,10 @@ void srt::CSndUList::update(const CUDT* u, EReschedule reschedule, sync::steady_
 
     CSNode* n = u->m_pSNode;
 
+    // Already due and waiting for its turn
+    if (n->m_iHeapLoc == CSNode::DUE_ROUND)
+        return;
+
     if (n->m_iHeapLoc >= 0)
     {
         if (reschedule == DONT_RESCHEDULE)
@@ -258,21 +301,128 @@ srt::CUDT* srt::CSndUList::pop()
 {
     ScopedLock listguard(m_ListLock);
 
-    if (-1 == m_iLastEntry)
-        return NULL;
+    CSNode* n = NULL;
+    if (m_iScheduler == SRT_SCHED_DRR)
+    {
+        n = selectDue_(steady_clock::now());
+        if (n == NULL)
+            return NULL;
+    }
+    else
+    {
+        if (-1 == m_iLastEntry)
+            return NULL;
+
+        // no pop until the next scheduled time
+        if (m_pHeap[0]->m_tsTimeStamp > steady_clock::now())
+            return NULL;
+
+        n = m_pHeap[0];
+    }
+
+    CUDT* u = n->m_pUDT;
 
-    // no pop until the next scheduled time
-    if (m_pHeap[0]->m_tsTimeStamp > steady_clock::now())
+    // Sockets on the heap are never deleted by the GC (see CUDTUnited::removeSocket()),
+    // so it's safe to acquire it here before it leaves the heap. Acquiring first and
+    // checking the status then prevents a race with the GC's busy check.
+    CUDTSocket* s = u->m_parent;
+    s->apiAcquire();
+    if (n->m_iHeapLoc == CSNode::DUE_ROUND)
+    {
+        // The selected socket is always the first in the round.
+        m_DueRound.pop_front();
+        n->m_iHeapLoc = CSNode::NOT_LISTED;
+    }
+    else
+    {
+        remove_(u);
+    }
+
+    if (s->m_Status == SRTS_CLOSED)
+    {
+        if (m_pDueTurn == n)
+            m_pDueTurn = NULL;
+        s->apiRelease();
         return NULL;
+    }
 
-    CUDT* u = m_pHeap[0]->m_pUDT;
-    remove_(u);
     return u;
 }
 
+srt::CSNode* srt::CSndUList::selectDue_(const steady_clock::time_point& now)
+{
+    // Deficit round robin: every socket in its turn gets a quantum of
+    // bytes proportional to its weight (SRTO_SNDWEIGHT) and keeps the turn
+    // as long as it has data due and enough quantum left for a full packet.
+    while (m_iLastEntry >= 0 && m_pHeap[0]->m_tsTimeStamp <= now)
+    {
+        CSNode* n = m_pHeap[0];
+        remove_(n->m_pUDT);
+        n->m_iHeapLoc = CSNode::DUE_ROUND;
+
+        if (n == m_pDueTurn)
+        {
+            // Sent in its turn and it is due again: the turn continues.
+            m_DueRound.push_front(n);
+        }
+        else
+        {
+            n->m_iDeficit = 0;
+            m_DueRound.push_back(n);
+        }
+    }
+
+    if (m_DueRound.empty())
+        return NULL;
+
+    for (;;)
+    {
+        CSNode*   n   = m_DueRound.front();
+        const int mss = n->m_pUDT->m_config.iMSS;
+        if (n != m_pDueTurn)
+        {
+            m_pDueTurn = n;
+            n->m_iDeficit += n->m_pUDT->m_config.iSndWeight * mss;
+        }
+
+        if (n->m_iDeficit >= mss)
+            return n;
+
+        // Quantum used up, the turn passes to the next socket.
+        m_DueRound.pop_front();
+        m_DueRound.push_back(n);
+        m_pDueTurn = NULL;
+    }
+}
+
+void srt::CSndUList::charge(const CUDT* u, int size)
+{
+    ScopedLock listguard(m_ListLock);
+    if (u->m_pSNode == m_pDueTurn)
+        m_pDueTurn->m_iDeficit -= size;
+}
+
+void srt::CSndUList::setScheduler(int mode)
+{
+    ScopedLock listguard(m_ListLock);
+    m_iScheduler = mode;
+}
+
 void srt::CSndUList::remove(const CUDT* u)
 {
     ScopedLock listguard(m_ListLock);
+
+    CSNode* n = u->m_pSNode;
+    if (n == m_pDueTurn)
+        m_pDueTurn = NULL;
+
+    if (n->m_iHeapLoc == CSNode::DUE_ROUND)
+    {
+        m_DueRound.erase(std::find(m_DueRound.begin(), m_DueRound.end(), n));
+        n->m_iHeapLoc = CSNode::NOT_LISTED;
+        return;
+    }
+
     remove_(u);
 }
 
@@ -280,6 +430,10 @@ steady_clock::time_point srt::CSndUList::getNextProcTime()
 {
     ScopedLock listguard(m_ListLock);
 
+    // Sockets in the round are already due.
+    if (!m_DueRound.empty())
+        return m_DueRound.front()->m_tsTimeStamp;
+
     if (-1 == m_iLastEntry)
         return steady_clock::time_point();
 
@@ -289,7 +443,7 @@ steady_clock::time_point srt::CSndUList::getNextProcTime()
 void srt::CSndUList::waitNonEmpty() const
 {
     UniqueLock listguard(m_ListLock);
-    if (m_iLastEntry >= 0)
+    if (m_iLastEntry >= 0 || !m_DueRound.empty())
         return;
 
     m_ListCond.wait(listguard);
@@ -414,6 +568,7 @@ srt::CSndQueue::CSndQueue()
     : m_pSndUList(NULL)
     , m_pChannel(NULL)
     , m_pTimer(NULL)
+    , m_Shaper(CSrtConfig::DEF_MSS)
     , m_bClosing(false)
 {
 }
@@ -575,6 +730,11 @@ void* srt::CSndQueue::worker(void* param)
             continue;
         }
 
+        // The socket was acquired by pop(), which keeps it alive
+        // without looking it up in the global socket container.
+        CUDTUnited::SocketKeeper sk;
+        sk.adopt(u->m_parent);
+
 #define UST(field) ((u->m_b##field) ? "+" : "-") << #field << " "
         HLOGC(qslog.Debug,
             log << "CSndQueue: requesting packet from @" << u->socketID() << " STATUS: " << UST(Listening)
@@ -588,11 +748,21 @@ void* srt::CSndQueue::worker(void* param)
             continue;
         }
 
-        CUDTUnited::SocketKeeper sk (CUDT::uglobal(), u->id());
-        if (!sk.socket)
+        // Check the rate budget of the multiplexer for a full-sized packet
+        // before packing, as the size is not known yet.
+        const steady_clock::time_point shaper_time = steady_clock::now();
+        bool shaper_borrow = false;
+        if (self->m_Shaper.enabled())
         {
-            HLOGC(qslog.Debug, log << "Socket to be processed was deleted in the meantime, not packing");
-            continue;
+            steady_clock::time_point retry_time;
+            if (!self->m_Shaper.allow(u->m_SndShaperLeaf, u->m_config.llSndMinBW, u->m_config.iSndWeight,
+                                      u->m_config.iMSS, shaper_time, (shaper_borrow), (retry_time)))
+            {
+                HLOGC(qslog.Debug, log << "CSndQueue: @" << u->socketID() << " over the rate budget, retry in "
+                        << FormatDuration<DUNIT_US>(retry_time - shaper_time));
+                self->m_pSndUList->update(u, CSndUList::DO_RESCHEDULE, retry_time);
+                continue;
+            }
         }
 
         // pack a packet from the socket
@@ -608,6 +778,15 @@ void* srt::CSndQueue::worker(void* param)
             continue;
         }
 
+        const int pkt_size = (int)(pkt.getLength() + CPacket::SRT_DATA_HDR_SIZE);
+        if (self->m_Shaper.enabled())
+        {
+            self->m_Shaper.consume(u->m_SndShaperLeaf, u->m_config.iSndWeight, pkt_size, shaper_borrow, shaper_time);
+        }
+
+        if (self->m_pSndUList->scheduler() == SRT_SCHED_DRR)
+            self->m_pSndUList->charge(u, pkt_size);
+
         const sockaddr_any addr = u->m_PeerAddr;
         if (!is_zero(next_send_time))
             self->m_pSndUList->update(u, CSndUList::DO_RESCHEDULE, next_send_time);
@@ -1387,11 +1566,10 @@ void* srt::CRcvQueue::worker(void* param) ATR_NOEXCEPT
 
 srt::EReadStatus srt::CRcvQueue::worker_RetrieveUnit(int32_t& w_id, CUnit*& w_unit, sockaddr_any& w_addr)
 {
-#if !USE_BUSY_WAITING
     // This might be not really necessary, and probably
     // not good for extensive bidirectional communication.
-    m_pTimer->tick();
-#endif
+    if (m_pTimer->pacing() != SRT_PACING_HYBRID)
+        m_pTimer->tick();
 
     // check waiting list, if new socket, insert it to the list
     while (ifNewEntry())
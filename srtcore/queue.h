@@ -58,6 +58,8 @@ modified by
 #include "socketconfig.h"
 #include "netinet_any.h"
 #include "utilities.h"
+#include "buffer_snd.h"
+#include <deque>
 #include <list>
 #include <map>
 #include <queue>
@@ -99,6 +101,32 @@ public:
 
     void makeUnitTaken(CUnit* unit);
 
+    int unitSize() const { return m_iMSS; }
+
+public:
+    /// Set the memory budget for the units. The queue does not grow beyond
+    /// this limit (rounded up to the allocation block). 0 means no limit.
+    void setMemoryLimit(int64_t bytes);
+
+    /// @return the maximum number of units, 0 if not limited.
+    int maxUnits() const { return m_iMaxUnits; }
+
+    /// Register/unregister a receiver buffer that takes units from this queue.
+    void addUser() { ++m_iNumUsers; }
+    void removeUser() { --m_iNumUsers; }
+
+    /// @brief The number of units a single receiver buffer is allowed to hold
+    /// when the queue is under pressure: an equal part of the budget, but
+    /// not less than MIN_RESERVED_UNITS.
+    /// @return the share, or INT_MAX if the memory is not limited.
+    int fairShare() const;
+
+    /// @return true if the memory is limited and most of the budget is taken.
+    bool underPressure() const;
+
+    /// Units every receiver buffer may hold regardless of the other users.
+    static const int MIN_RESERVED_UNITS = 32;
+
 private:
     struct CQEntry
     {
@@ -129,6 +157,8 @@ private:
     sync::atomic<int> m_iNumTaken; // total number of valid (occupied) packets in the queue
     const int m_iMSS; // unit buffer size
     const int m_iBlockSize; // Number of units in each CQEntry.
+    sync::atomic<int> m_iMaxUnits; // memory budget in units, 0 if not limited
+    sync::atomic<int> m_iNumUsers; // number of receiver buffers using the queue
 
 private:
     CUnitQueue(const CUnitQueue&);
@@ -137,10 +167,16 @@ private:
 
 struct CSNode
 {
+    static const int NOT_LISTED = -1;
+    static const int DUE_ROUND  = -2;
+
     CUDT*                          m_pUDT; // Pointer to the instance of CUDT socket
     sync::steady_clock::time_point m_tsTimeStamp;
 
-    sync::atomic<int> m_iHeapLoc; // location on the heap, -1 means not on the heap
+    // Location on the heap, NOT_LISTED if not on the list,
+    // DUE_ROUND if waiting for its turn (SRT_SCHED_DRR).
+    sync::atomic<int> m_iHeapLoc;
+    int               m_iDeficit; // bytes the socket may still send in its turn (SRT_SCHED_DRR)
 };
 
 class CSndUList
@@ -166,6 +202,9 @@ public:
     void update(const CUDT* u, EReschedule reschedule, sync::steady_clock::time_point ts = sync::steady_clock::now());
 
     /// Retrieve the next (in time) socket from the heap to process its sending request.
+    /// The socket is acquired (see CUDTSocket::apiAcquire()) while still on the heap,
+    /// where the GC can't delete it, so the caller must release it when done. Closed
+    /// sockets are only removed from the heap and never returned.
     /// @return a pointer to CUDT instance to process next.
     CUDT* pop();
 
@@ -183,7 +222,21 @@ public:
     /// Signal to stop waiting in waitNonEmpty().
     void signalInterrupt() const;
 
+    /// Sets the order of serving the sockets due for sending.
+    /// @param [in] mode SRT_SCHED_TIME or SRT_SCHED_DRR
+    void setScheduler(int mode);
+    int scheduler() const { return m_iScheduler; }
+
+    /// Charges the packet sent by the socket taken with pop() in its turn (SRT_SCHED_DRR).
+    /// @param [in] u pointer to the UDT instance
+    /// @param [in] size packet size in bytes
+    void charge(const CUDT* u, int size);
+
 private:
+    /// Moves the sockets due for sending from the heap to the round
+    /// and selects the one to send (SRT_SCHED_DRR).
+    CSNode* selectDue_(const sync::steady_clock::time_point& now);
+
     /// Doubles the size of the list.
     ///
     void realloc_();// REQUIRES(m_ListLock);
@@ -210,9 +263,13 @@ private:
     int      m_iArrayLength; // physical length of the array
     int      m_iLastEntry;   // position of last entry on the heap array or -1 if empty.
 
-    mutable sync::Mutex     m_ListLock; // Protects the list (m_pHeap, m_iArrayLength, m_iLastEntry).
+    mutable sync::Mutex     m_ListLock; // Protects the list (m_pHeap, m_iArrayLength, m_iLastEntry, m_DueRound).
     mutable sync::Condition m_ListCond;
 
+    sync::atomic<int>   m_iScheduler; // SRT_SCHED_TIME or SRT_SCHED_DRR
+    std::deque<CSNode*> m_DueRound;   // Sockets due for sending in the order of turns (SRT_SCHED_DRR)
+    CSNode*             m_pDueTurn;   // The socket whose turn it is
+
     sync::CTimer* const m_pTimer;
 
 private:
@@ -452,6 +509,9 @@ private:
     CChannel*     m_pChannel;  // The UDP channel for data sending
     sync::CTimer* m_pTimer;    // Timing facility
 
+    CSndBlockPool m_BlockPool; // Payload memory for the sender buffers of the sockets
+    CSndShaper    m_Shaper;    // Rate budget of the sockets (SRTO_MUXMAXBW)
+
     sync::atomic<bool> m_bClosing;            // closing the worker
 
 public:
@@ -165,6 +165,97 @@ struct CSrtConfigSetter<SRTO_UDP_SNDBUF>
     }
 };
 
+template<>
+struct CSrtConfigSetter<SRTO_SNDMEMLIMIT>
+{
+    static void set(CSrtConfig& co, const void* optval, int optlen)
+    {
+        const int64_t val = cast_optval<int64_t>(optval, optlen);
+        if (val < 0)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        co.llSndMemLimit = val;
+    }
+};
+
+template<>
+struct CSrtConfigSetter<SRTO_RCVMEMLIMIT>
+{
+    static void set(CSrtConfig& co, const void* optval, int optlen)
+    {
+        const int64_t val = cast_optval<int64_t>(optval, optlen);
+        if (val < 0)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        co.llRcvMemLimit = val;
+    }
+};
+
+template<>
+struct CSrtConfigSetter<SRTO_PACING>
+{
+    static void set(CSrtConfig& co, const void* optval, int optlen)
+    {
+        const int val = cast_optval<int>(optval, optlen);
+        if (val != SRT_PACING_SLEEP && val != SRT_PACING_HYBRID)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        co.iPacing = val;
+    }
+};
+
+template<>
+struct CSrtConfigSetter<SRTO_MUXMAXBW>
+{
+    static void set(CSrtConfig& co, const void* optval, int optlen)
+    {
+        const int64_t val = cast_optval<int64_t>(optval, optlen);
+        if (val < 0)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        co.llMuxMaxBW = val;
+    }
+};
+
+template<>
+struct CSrtConfigSetter<SRTO_SNDMINBW>
+{
+    static void set(CSrtConfig& co, const void* optval, int optlen)
+    {
+        const int64_t val = cast_optval<int64_t>(optval, optlen);
+        if (val < 0)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        co.llSndMinBW = val;
+    }
+};
+
+template<>
+struct CSrtConfigSetter<SRTO_SNDWEIGHT>
+{
+    static void set(CSrtConfig& co, const void* optval, int optlen)
+    {
+        const int val = cast_optval<int>(optval, optlen);
+        if (val < 1 || val > 100)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        co.iSndWeight = val;
+    }
+};
+
+template<>
+struct CSrtConfigSetter<SRTO_SCHEDULER>
+{
+    static void set(CSrtConfig& co, const void* optval, int optlen)
+    {
+        const int val = cast_optval<int>(optval, optlen);
+        if (val != SRT_SCHED_TIME && val != SRT_SCHED_DRR)
+            throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
+
+        co.iScheduler = val;
+    }
+};
+
 template<>
 struct CSrtConfigSetter<SRTO_UDP_RCVBUF>
 {
@@ -882,7 +973,7 @@ struct CSrtConfigSetter<SRTO_RETRANSMITALGO>
     static void set(CSrtConfig& co, const void* optval, int optlen)
     {
         const int val = cast_optval<int>(optval, optlen);
-        if (val < 0 || val > 1)
+        if (val < 0 || val > 2)
             throw CUDTException(MJ_NOTSUP, MN_INVAL, 0);
 
         co.iRetransmitAlgo = val;
@@ -935,6 +1026,13 @@ int dispatchSet(SRT_SOCKOPT optName, CSrtConfig& co, const void* optval, int opt
         DISPATCH(SRTO_RCVBUF);
         DISPATCH(SRTO_LINGER);
         DISPATCH(SRTO_UDP_SNDBUF);
+        DISPATCH(SRTO_SNDMEMLIMIT);
+        DISPATCH(SRTO_PACING);
+        DISPATCH(SRTO_MUXMAXBW);
+        DISPATCH(SRTO_SNDMINBW);
+        DISPATCH(SRTO_SNDWEIGHT);
+        DISPATCH(SRTO_SCHEDULER);
+        DISPATCH(SRTO_RCVMEMLIMIT);
         DISPATCH(SRTO_UDP_RCVBUF);
         DISPATCH(SRTO_RENDEZVOUS);
         DISPATCH(SRTO_SNDTIMEO);
@@ -1064,18 +1162,25 @@ bool SRT_SocketOptionObject::add(SRT_SOCKOPT optname, const void* optval, size_t
         //SRTO_MAXBW - per transmission setting
         //SRTO_MESSAGEAPI - groups are live mode only
         //SRTO_MINVERSION - per group connection setting
+    case SRTO_MUXMAXBW:
     case SRTO_NAKREPORT:
         //SRTO_OHEADBW - per transmission setting
         //SRTO_PACKETFILTER - per transmission setting
         //SRTO_PASSPHRASE - per group connection setting
         //SRTO_PASSPHRASE - per transmission setting
         //SRTO_PBKEYLEN - per group connection setting
+    case SRTO_PACING:
     case SRTO_PEERIDLETIMEO:
     case SRTO_RCVBUF:
+    case SRTO_RCVMEMLIMIT:
         //SRTO_RCVSYN - must be always false in groups
         //SRTO_RCVTIMEO - must be always -1 in groups
+    case SRTO_SCHEDULER:
     case SRTO_SNDBUF:
     case SRTO_SNDDROPDELAY:
+    case SRTO_SNDMEMLIMIT:
+    case SRTO_SNDMINBW:
+    case SRTO_SNDWEIGHT:
         //SRTO_TLPKTDROP - per transmission setting
         //SRTO_TSBPDMODE - per transmission setting
     case SRTO_UDP_RCVBUF:
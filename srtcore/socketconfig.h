@@ -81,6 +81,11 @@ namespace srt
 struct CSrtMuxerConfig
 {
     static const int DEF_UDP_BUFFER_SIZE = 65536;
+#if USE_BUSY_WAITING
+    static const int DEF_PACING = SRT_PACING_HYBRID;
+#else
+    static const int DEF_PACING = SRT_PACING_SLEEP;
+#endif
 
     int  iIpTTL;
     int  iIpToS;
@@ -93,6 +98,12 @@ struct CSrtMuxerConfig
     int iUDPSndBufSize; // UDP sending buffer size
     int iUDPRcvBufSize; // UDP receiving buffer size
 
+    int64_t llSndMemLimit; // Memory limit for all sender buffers (0 if unlimited)
+    int64_t llRcvMemLimit; // Memory limit for all received packets (0 if unlimited)
+    int     iPacing;       // Waiting for the sending time (SRT_PACING_MODE)
+    int64_t llMuxMaxBW;    // Maximum rate of all sockets (0 if unlimited)
+    int     iScheduler;    // Order of sending among the sockets due (SRT_SCHEDULER_MODE)
+
     // NOTE: this operator is not reversible. The syntax must use:
     //  muxer_entry == socket_entry
     bool isCompatWith(const CSrtMuxerConfig& other) const
@@ -106,6 +117,11 @@ struct CSrtMuxerConfig
 #endif
             && CEQUAL(iUDPSndBufSize)
             && CEQUAL(iUDPRcvBufSize)
+            && CEQUAL(llSndMemLimit)
+            && CEQUAL(llRcvMemLimit)
+            && CEQUAL(iPacing)
+            && CEQUAL(llMuxMaxBW)
+            && CEQUAL(iScheduler)
             && (other.iIpV6Only == -1 || CEQUAL(iIpV6Only))
             // NOTE: iIpV6Only is not regarded because
             // this matches only in case of IPv6 with "any" address.
@@ -123,6 +139,11 @@ struct CSrtMuxerConfig
         , bReuseAddr(true) // This is default in SRT
         , iUDPSndBufSize(DEF_UDP_BUFFER_SIZE)
         , iUDPRcvBufSize(DEF_UDP_BUFFER_SIZE)
+        , llSndMemLimit(0)
+        , llRcvMemLimit(0)
+        , iPacing(DEF_PACING)
+        , llMuxMaxBW(0)
+        , iScheduler(SRT_SCHED_TIME)
     {
     }
 };
@@ -238,6 +259,8 @@ struct CSrtConfig: CSrtMuxerConfig
 #ifdef ENABLE_MAXREXMITBW
     int64_t  llMaxRexmitBW; // maximum bandwidth limit for retransmissions (Bytes/s).
 #endif
+    int64_t  llSndMinBW;  // rate guaranteed within SRTO_MUXMAXBW (Bytes/s)
+    int      iSndWeight;  // weight in sharing the spare rate within SRTO_MUXMAXBW and in SRT_SCHED_DRR
 
     // These fields keep the options for encryption
     // (SRTO_PASSPHRASE, SRTO_PBKEYLEN). Crypto object is
@@ -303,6 +326,8 @@ struct CSrtConfig: CSrtMuxerConfig
 #ifdef ENABLE_MAXREXMITBW
         , llMaxRexmitBW(-1)
 #endif
+        , llSndMinBW(0)
+        , iSndWeight(1)
         , bDataSender(false)
         , bMessageAPI(true)
         , bTSBPD(true)
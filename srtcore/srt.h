@@ -239,6 +239,13 @@ typedef enum SRT_SOCKOPT {
 #ifdef ENABLE_MAXREXMITBW
    SRTO_MAXREXMITBW = 63,    // Maximum bandwidth limit for retransmision (Bytes/s)
 #endif
+   SRTO_SNDMEMLIMIT = 64,    // Memory limit for the sender buffers of all sockets sharing the UDP port (bytes, 0 if unlimited)
+   SRTO_RCVMEMLIMIT = 65,    // Memory limit for the received packets of all sockets sharing the UDP port (bytes, 0 if unlimited)
+   SRTO_PACING = 66,         // How the sender of the UDP port waits for the packet sending time (SRT_PACING_MODE)
+   SRTO_MUXMAXBW = 67,       // Maximum rate of the data sent by all sockets sharing the UDP port (bytes/s, 0 if unlimited)
+   SRTO_SNDMINBW = 68,       // Rate guaranteed to the socket within SRTO_MUXMAXBW (bytes/s)
+   SRTO_SNDWEIGHT = 69,      // Weight of the socket in sharing the spare rate within SRTO_MUXMAXBW and in SRT_SCHED_DRR
+   SRTO_SCHEDULER = 70,      // Order of sending by the sockets sharing the UDP port when more are due (SRT_SCHEDULER_MODE)
 
    SRTO_E_SIZE // Always last element, not a valid option.
 } SRT_SOCKOPT;
@@ -288,6 +295,18 @@ typedef enum SRT_TRANSTYPE
     SRTT_INVALID
 } SRT_TRANSTYPE;
 
+typedef enum SRT_PACING_MODE
+{
+    SRT_PACING_SLEEP,   // Wait on a condition variable until the sending time
+    SRT_PACING_HYBRID   // Wait until a calibrated margin before the sending time, then spin
+} SRT_PACING_MODE;
+
+typedef enum SRT_SCHEDULER_MODE
+{
+    SRT_SCHED_TIME,     // The socket with the earliest sending time first
+    SRT_SCHED_DRR       // Deficit round robin weighted by SRTO_SNDWEIGHT among the sockets due
+} SRT_SCHEDULER_MODE;
+
 // These sizes should be used for Live mode. In Live mode you should not
 // exceed the size that fits in a single MTU.
 
@@ -407,6 +426,16 @@ struct CBytePerfMon
    int64_t  pktRecvUnique;              // number of packets to be received by the application
    uint64_t byteSentUnique;             // number of data bytes, sent by the application
    uint64_t byteRecvUnique;             // number of data bytes to be received by the application
+
+   // Instant
+   int64_t  byteRcvBufAlloc;            // memory allocated for the receiver buffer bookkeeping
+   int      pktRcvUnitsHeld;            // number of units of the multiplexer's receiver memory held by the socket
+   int      pktRcvUnitsShare;           // fair share of the units under memory pressure (0 if SRTO_RCVMEMLIMIT is not set)
+
+   // Total for the sender of the UDP port
+   int64_t  sndPacingWaitsTotal;        // number of waits for the sending time of a packet
+   int64_t  usSndPacingErrorTotal;      // total lateness of the sender after these waits
+   int64_t  usSndPacingSpinTotal;       // total time spent spinning before the sending time (SRT_PACING_HYBRID)
 };
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -841,6 +870,48 @@ SRT_API int srt_send    (SRTSOCKET u, const char* buf, int len);
 SRT_API int srt_sendmsg (SRTSOCKET u, const char* buf, int len, int ttl/* = -1*/, int inorder/* = false*/);
 SRT_API int srt_sendmsg2(SRTSOCKET u, const char* buf, int len, SRT_MSGCTRL *mctrl);
 
+// Scatter-gather variants: the message is gathered from (or scattered into)
+// several buffers. The layout is the same as of the POSIX struct iovec.
+typedef struct SRT_IOVEC
+{
+    void* iov_base;
+    size_t iov_len;
+} SRT_IOVEC;
+
+SRT_API int srt_sendmsgv(SRTSOCKET u, const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL *mctrl);
+
+// Zero-copy sending: the buffer is not copied, but referenced by the sender
+// buffer until the message is acknowledged or dropped. The caller must keep
+// the memory intact until the completion callback reports it for this buffer.
+// Message API only and not available with encryption.
+typedef enum SRT_ZC_STATUS
+{
+    SRT_ZC_ACKED   = 0, // the message has been acknowledged by the peer
+    SRT_ZC_DROPPED = 1, // the message has been dropped (TTL, too-late-to-send)
+    SRT_ZC_CLOSED  = 2  // the socket was closed with the message still in the buffer
+} SRT_ZC_STATUS;
+
+typedef void srt_send_complete_callback_fn(void* opaq, SRTSOCKET u, const char* buf, int len, int status);
+SRT_API int srt_send_complete_callback(SRTSOCKET u, srt_send_complete_callback_fn* hook_fn, void* hook_opaque);
+SRT_API int srt_sendmsg_zc(SRTSOCKET u, const char* buf, int len, SRT_MSGCTRL *mctrl);
+
+// Batch sending: as many messages as possible from the array are scheduled
+// for sending in one call. Returns the number of messages scheduled; the
+// 'result' field of every message scheduled is set to its length. If sending
+// stopped at a message because of an error, its 'result' is set to SRT_ERROR
+// and 'errcode' to the error code (the call fails only if no message could be
+// scheduled at all). Message API only.
+typedef struct SRT_MSGVEC
+{
+    char* buf;
+    int len;
+    SRT_MSGCTRL mctrl;
+    int result;
+    int errcode;
+} SRT_MSGVEC;
+
+SRT_API int srt_sendmmsg(SRTSOCKET u, SRT_MSGVEC* msgs, int n);
+
 //
 // Receiving functions
 //
@@ -849,6 +920,26 @@ SRT_API int srt_recv    (SRTSOCKET u, char* buf, int len);
 // srt_recvmsg is actually an alias to srt_recv, it stays under the old name for compat reasons.
 SRT_API int srt_recvmsg (SRTSOCKET u, char* buf, int len);
 SRT_API int srt_recvmsg2(SRTSOCKET u, char *buf, int len, SRT_MSGCTRL *mctrl);
+SRT_API int srt_recvmsgv(SRTSOCKET u, const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL *mctrl);
+
+// Zero-copy receiving: the next message is returned as read-only views of
+// the payload of its packets, which stay in the SRT receiver memory until
+// released with srt_recvmsg_zc_release. Message API only.
+typedef struct SRT_PKTVIEW
+{
+    const char* data;
+    int len;
+} SRT_PKTVIEW;
+
+SRT_API int srt_recvmsg_zc(SRTSOCKET u, SRT_PKTVIEW* views, int nviews, SRT_MSGCTRL *mctrl);
+SRT_API int srt_recvmsg_zc_release(SRTSOCKET u, const SRT_PKTVIEW* views, int nviews);
+
+// Batch receiving: all messages ready to be delivered, up to n, are read into
+// the buffers of the array in one call. If no message is ready, it waits for one
+// up to msTimeOut milliseconds (-1: infinitely, 0: no waiting, regardless of
+// SRTO_RCVSYN). Returns the number of messages read, with the 'result' field
+// of each set to the message size. Message API only.
+SRT_API int srt_recvmmsg(SRTSOCKET u, SRT_MSGVEC* msgs, int n, int msTimeOut);
 
 
 // Special send/receive functions for files only.
@@ -857,6 +948,12 @@ SRT_API int srt_recvmsg2(SRTSOCKET u, char *buf, int len, SRT_MSGCTRL *mctrl);
 SRT_API int64_t srt_sendfile(SRTSOCKET u, const char* path, int64_t* offset, int64_t size, int block);
 SRT_API int64_t srt_recvfile(SRTSOCKET u, const char* path, int64_t* offset, int64_t size, int block);
 
+// The same as srt_sendfile/srt_recvfile, but with a file descriptor open by the
+// application. The data are read (pread) and written (pwritev) at the given offset
+// directly to/from the SRT buffers; the file offset of the descriptor is not changed.
+SRT_API int64_t srt_sendfile_fd(SRTSOCKET u, int fd, int64_t* offset, int64_t size, int block);
+SRT_API int64_t srt_recvfile_fd(SRTSOCKET u, int fd, int64_t* offset, int64_t size, int block);
+
 
 // last error detection
 SRT_API const char* srt_getlasterror_str(void);
@@ -898,6 +995,59 @@ SRT_API int srt_epoll_uwait(int eid, SRT_EPOLL_EVENT* fdsSet, int fdsSize, int64
 SRT_API int32_t srt_epoll_set(int eid, int32_t flags);
 SRT_API int srt_epoll_release(int eid);
 
+// User-defined congestion control
+
+// Connection state passed to the congestion control callbacks.
+typedef struct SRT_CONGCTL_INFO_STR
+{
+    SRTSOCKET sock;
+    int32_t   snd_seqno;       // Latest sequence number sent
+    int32_t   ack_seqno;       // First sequence number not yet acknowledged
+    int       srtt_us;         // Smoothed RTT
+    int       rttvar_us;       // RTT variance
+    int       delivery_rate;   // Packets per second received by the peer
+    int       bandwidth;       // Estimated link capacity, packets per second
+    int       mss;             // Maximum segment size, bytes
+    int       max_cwnd;        // Flow window, the upper limit of the congestion window
+    int       loss_length;     // Packets waiting for retransmission
+    int       sacked;          // Packets past the ACK reported received by the selective ACK
+} SRT_CONGCTL_INFO;
+
+// Stages passed to on_timer
+#define SRT_CONGCTL_TIMER_FASTREXMIT 1 // Periodic retransmission of unacknowledged packets (live mode)
+#define SRT_CONGCTL_TIMER_REXMIT     2 // ACK timeout, all unacknowledged packets are retransmitted
+
+// Callbacks of a congestion controller registered with srt_register_congctl().
+// All but create are optional. They are called from the SRT
+// internal threads with the socket's locks held, so they must not call
+// any SRT API function on the same socket.
+typedef struct SRT_CONGCTL_OPS_STR
+{
+    // Create the per-connection state. The returned value is passed as `state`
+    // to the other callbacks. Called when the connection is established.
+    void* (*create)(void* opaque, const SRT_CONGCTL_INFO* info);
+    void (*destroy)(void* state);
+
+    // A full ACK has been received.
+    void (*on_ack)(void* state, const SRT_CONGCTL_INFO* info);
+    // A loss report has been received. `ranges` holds `nranges` pairs of the
+    // first and the last lost sequence number.
+    void (*on_loss)(void* state, const int32_t* ranges, int nranges, const SRT_CONGCTL_INFO* info);
+    // A retransmission timer has expired; `stage` is SRT_CONGCTL_TIMER_*.
+    void (*on_timer)(void* state, int stage, const SRT_CONGCTL_INFO* info);
+
+    // Interval between two sent packets, in microseconds.
+    double (*snd_period_us)(void* state);
+    // Congestion window, in packets.
+    double (*cwnd)(void* state);
+    // Retransmission timeout, in microseconds. 0 for the internal one.
+    int64_t (*rto_us)(void* state);
+
+    void* opaque; // Passed to create
+} SRT_CONGCTL_OPS;
+
+SRT_API int srt_register_congctl(const char* name, const SRT_CONGCTL_OPS* ops);
+
 // Logging control
 
 SRT_API void srt_setloglevel(int ll);
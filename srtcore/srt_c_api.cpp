@@ -213,6 +213,24 @@ int64_t srt_recvfile(SRTSOCKET u, const char* path, int64_t* offset, int64_t siz
     return ret;
 }
 
+int64_t srt_sendfile_fd(SRTSOCKET u, int fd, int64_t* offset, int64_t size, int block)
+{
+    if (!offset)
+    {
+        return CUDT::APIError(MJ_NOTSUP, MN_INVAL, 0);
+    }
+    return CUDT::sendfile(u, fd, *offset, size, block);
+}
+
+int64_t srt_recvfile_fd(SRTSOCKET u, int fd, int64_t* offset, int64_t size, int block)
+{
+    if (!offset)
+    {
+        return CUDT::APIError(MJ_NOTSUP, MN_INVAL, 0);
+    }
+    return CUDT::recvfile(u, fd, *offset, size, block);
+}
+
 extern const SRT_MSGCTRL srt_msgctrl_default = {
     0,     // no flags set
     SRT_MSGTTL_INF,
@@ -239,6 +257,32 @@ int srt_sendmsg2(SRTSOCKET u, const char * buf, int len, SRT_MSGCTRL *mctrl)
     return CUDT::sendmsg2(u, buf, len, (mignore));
 }
 
+int srt_sendmsgv(SRTSOCKET u, const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL *mctrl)
+{
+    if (mctrl)
+        return CUDT::sendmsgv(u, iov, iovcnt, (*mctrl));
+    SRT_MSGCTRL mignore = srt_msgctrl_default;
+    return CUDT::sendmsgv(u, iov, iovcnt, (mignore));
+}
+
+int srt_sendmsg_zc(SRTSOCKET u, const char * buf, int len, SRT_MSGCTRL *mctrl)
+{
+    if (mctrl)
+        return CUDT::sendmsg_zc(u, buf, len, (*mctrl));
+    SRT_MSGCTRL mignore = srt_msgctrl_default;
+    return CUDT::sendmsg_zc(u, buf, len, (mignore));
+}
+
+int srt_sendmmsg(SRTSOCKET u, SRT_MSGVEC* msgs, int n)
+{
+    return CUDT::sendmmsg(u, msgs, n);
+}
+
+int srt_send_complete_callback(SRTSOCKET u, srt_send_complete_callback_fn* hook, void* opaq)
+{
+    return CUDT::installSendCompleteHook(u, hook, opaq);
+}
+
 int srt_recvmsg2(SRTSOCKET u, char * buf, int len, SRT_MSGCTRL *mctrl)
 {
     if (mctrl)
@@ -247,6 +291,32 @@ int srt_recvmsg2(SRTSOCKET u, char * buf, int len, SRT_MSGCTRL *mctrl)
     return CUDT::recvmsg2(u, buf, len, (mignore));
 }
 
+int srt_recvmsgv(SRTSOCKET u, const SRT_IOVEC* iov, int iovcnt, SRT_MSGCTRL *mctrl)
+{
+    if (mctrl)
+        return CUDT::recvmsgv(u, iov, iovcnt, (*mctrl));
+    SRT_MSGCTRL mignore = srt_msgctrl_default;
+    return CUDT::recvmsgv(u, iov, iovcnt, (mignore));
+}
+
+int srt_recvmsg_zc(SRTSOCKET u, SRT_PKTVIEW* views, int nviews, SRT_MSGCTRL *mctrl)
+{
+    if (mctrl)
+        return CUDT::recvmsg_zc(u, views, nviews, (*mctrl));
+    SRT_MSGCTRL mignore = srt_msgctrl_default;
+    return CUDT::recvmsg_zc(u, views, nviews, (mignore));
+}
+
+int srt_recvmsg_zc_release(SRTSOCKET u, const SRT_PKTVIEW* views, int nviews)
+{
+    return CUDT::recvmsg_zc_release(u, views, nviews);
+}
+
+int srt_recvmmsg(SRTSOCKET u, SRT_MSGVEC* msgs, int n, int msTimeOut)
+{
+    return CUDT::recvmmsg(u, msgs, n, msTimeOut);
+}
+
 const char* srt_getlasterror_str() { return UDT::getlasterror().getErrorMessage(); }
 
 int srt_getlasterror(int* loc_errno)
@@ -346,6 +416,11 @@ int32_t srt_epoll_set(int eid, int32_t flags) { return CUDT::epoll_set(eid, flag
 
 int srt_epoll_release(int eid) { return CUDT::epoll_release(eid); }
 
+int srt_register_congctl(const char* name, const SRT_CONGCTL_OPS* ops)
+{
+    return CUDT::registerCongctl(name, ops);
+}
+
 void srt_setloglevel(int ll)
 {
     UDT::setloglevel(srt_logging::LogLevel::type(ll));
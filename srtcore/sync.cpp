@@ -181,7 +181,52 @@ srt::sync::CEvent g_Sync;
 //
 ////////////////////////////////////////////////////////////////////////////////
 
+namespace srt
+{
+namespace sync
+{
+#if defined(_WIN32)
+// 10 ms on Windows: bad accuracy of timers
+static const int64_t MAX_SPIN_MARGIN_US = 10000;
+#else
+// 1 ms on non-Windows platforms
+static const int64_t MAX_SPIN_MARGIN_US = 1000;
+#endif
+static const int64_t MIN_SPIN_MARGIN_US = 20;
+
+static inline void spinPause()
+{
+#ifdef IA32
+    __asm__ volatile ("pause; rep; nop; nop; nop; nop; nop;");
+#elif IA64
+    __asm__ volatile ("nop 0; nop 0; nop 0; nop 0; nop 0;");
+#elif AMD64
+    __asm__ volatile ("nop; nop; nop; nop; nop;");
+#elif defined(_WIN32) && !defined(__MINGW32__)
+    __nop();
+    __nop();
+    __nop();
+    __nop();
+    __nop();
+#endif
+}
+} // namespace sync
+} // namespace srt
+
 srt::sync::CTimer::CTimer()
+#if USE_BUSY_WAITING
+    : m_iPacing(SRT_PACING_HYBRID)
+#else
+    : m_iPacing(SRT_PACING_SLEEP)
+#endif
+    // Start with a short margin: only the sleeps longer than
+    // the margin measure the wake-up lateness to calibrate it.
+    , m_tdSpinMargin(microseconds_from(MAX_SPIN_MARGIN_US / 10))
+    , m_iOversleepAvgUs(MAX_SPIN_MARGIN_US / 20)
+    , m_iOversleepVarUs(MAX_SPIN_MARGIN_US / 80)
+    , m_llWaits(0)
+    , m_llErrorUs(0)
+    , m_llSpinUs(0)
 {
 }
 
@@ -199,61 +244,70 @@ bool srt::sync::CTimer::sleep_until(TimePoint<steady_clock> tp)
     m_tsSchedTime = tp;
     leaveCS(m_event.mutex());
 
-#if USE_BUSY_WAITING
-#if defined(_WIN32)
-    // 10 ms on Windows: bad accuracy of timers
-    const steady_clock::duration
-        td_threshold = milliseconds_from(10);
-#else
-    // 1 ms on non-Windows platforms
-    const steady_clock::duration
-        td_threshold = milliseconds_from(1);
-#endif
-#endif // USE_BUSY_WAITING
-
+    const bool hybrid = m_iPacing == SRT_PACING_HYBRID;
     TimePoint<steady_clock> cur_tp = steady_clock::now();
-    
+
     while (cur_tp < m_tsSchedTime)
     {
-#if USE_BUSY_WAITING
-        steady_clock::duration td_wait = m_tsSchedTime - cur_tp;
-        if (td_wait <= 2 * td_threshold)
+        if (!hybrid)
+        {
+            m_event.lock_wait_until(m_tsSchedTime);
+            cur_tp = steady_clock::now();
+            continue;
+        }
+
+        // Wake up the margin ahead of the target time, so that
+        // the late wake-up of the system timer is absorbed by spinning.
+        const TimePoint<steady_clock> wake_tp = m_tsSchedTime - m_tdSpinMargin;
+        if (cur_tp >= wake_tp)
             break;
 
-        td_wait -= td_threshold;
-        m_event.lock_wait_for(td_wait);
-#else
-        m_event.lock_wait_until(m_tsSchedTime);
-#endif // USE_BUSY_WAITING
-
+        m_event.lock_wait_until(wake_tp);
         cur_tp = steady_clock::now();
+
+        // Only a wake-up at the time requested measures the lateness
+        // of the system timer; tick() and interrupt() wake up earlier.
+        if (cur_tp >= wake_tp)
+            updateSpinMargin(cur_tp - wake_tp);
     }
 
-#if USE_BUSY_WAITING
+    const TimePoint<steady_clock> spin_start = cur_tp;
     while (cur_tp < m_tsSchedTime)
     {
-#ifdef IA32
-        __asm__ volatile ("pause; rep; nop; nop; nop; nop; nop;");
-#elif IA64
-        __asm__ volatile ("nop 0; nop 0; nop 0; nop 0; nop 0;");
-#elif AMD64
-        __asm__ volatile ("nop; nop; nop; nop; nop;");
-#elif defined(_WIN32) && !defined(__MINGW32__)
-        __nop();
-        __nop();
-        __nop();
-        __nop();
-        __nop();
-#endif
-
+        spinPause();
         cur_tp = steady_clock::now();
     }
-#endif // USE_BUSY_WAITING
+
+    m_llWaits.store(m_llWaits.load() + 1);
+    m_llErrorUs.store(m_llErrorUs.load() + count_microseconds(cur_tp - m_tsSchedTime));
+    m_llSpinUs.store(m_llSpinUs.load() + count_microseconds(cur_tp - spin_start));
 
     return cur_tp >= m_tsSchedTime;
 }
 
 
+void srt::sync::CTimer::updateSpinMargin(const steady_clock::duration& oversleep)
+{
+    // Smoothed like the RTT: the margin covers the average lateness
+    // of the wake-up with four times its variation.
+    const int64_t oversleep_us = count_microseconds(oversleep);
+    const int64_t dev_us = oversleep_us > m_iOversleepAvgUs ? oversleep_us - m_iOversleepAvgUs : m_iOversleepAvgUs - oversleep_us;
+    m_iOversleepVarUs = avg_iir<4>(m_iOversleepVarUs, dev_us);
+    m_iOversleepAvgUs = avg_iir<8>(m_iOversleepAvgUs, oversleep_us);
+
+    const int64_t margin_us = std::min(MAX_SPIN_MARGIN_US, std::max(MIN_SPIN_MARGIN_US, m_iOversleepAvgUs + 4 * m_iOversleepVarUs));
+    m_tdSpinMargin = microseconds_from(margin_us);
+}
+
+
+void srt::sync::CTimer::getPacingStats(int64_t& w_waits, int64_t& w_error_us, int64_t& w_spin_us) const
+{
+    w_waits    = m_llWaits.load();
+    w_error_us = m_llErrorUs.load();
+    w_spin_us  = m_llSpinUs.load();
+}
+
+
 void srt::sync::CTimer::interrupt()
 {
     UniqueLock lck(m_event.mutex());
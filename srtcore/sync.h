@@ -833,6 +833,16 @@ public:
     }
 };
 
+} // namespace sync
+} // namespace srt
+
+// Included here, as without the atomic intrinsics
+// the atomic types are built on the Mutex above.
+#include "atomic.h"
+
+namespace srt {
+namespace sync {
+
 class CTimer
 {
 public:
@@ -859,9 +869,35 @@ public:
     /// of the current time in comparison to the target time.
     void tick();
 
+    /// Selects the way sleep_until(..) waits for the target time.
+    /// @param mode SRT_PACING_SLEEP to wait on the condition variable,
+    ///             SRT_PACING_HYBRID to wait on the condition variable until
+    ///             a calibrated margin before the target time and spin then.
+    void setPacing(int mode) { m_iPacing = mode; }
+    int pacing() const { return m_iPacing; }
+
+    /// Retrieves the measurements of sleep_until(..) since the timer was created.
+    /// @param [out] w_waits number of timed waits
+    /// @param [out] w_error_us sum of the lateness of the wake-ups in microseconds
+    /// @param [out] w_spin_us time spent spinning in microseconds
+    void getPacingStats(int64_t& w_waits, int64_t& w_error_us, int64_t& w_spin_us) const;
+
 private:
+    void updateSpinMargin(const steady_clock::duration& oversleep);
+
     CEvent m_event;
     steady_clock::time_point m_tsSchedTime;
+
+    int m_iPacing;                          // SRT_PACING_SLEEP or SRT_PACING_HYBRID (set before use)
+    steady_clock::duration m_tdSpinMargin;  // time before the target time to start spinning (hybrid mode)
+    int64_t m_iOversleepAvgUs;              // smoothed lateness of the condition variable wake-ups
+    int64_t m_iOversleepVarUs;              // smoothed variation of the lateness
+
+    // Written only by the thread in sleep_until(..), so that
+    // updating them takes no lock and no read-modify-write.
+    atomic<int64_t> m_llWaits;
+    atomic<int64_t> m_llErrorUs;
+    atomic<int64_t> m_llSpinUs;
 };
 
 
@@ -494,6 +494,320 @@ private:
     T* const    m_entries;
 };
 
+/// Array of a fixed logical size whose storage is allocated in chunks
+/// on first access, so that only the parts actually in use take memory.
+/// A const access to a position in a chunk not yet allocated returns
+/// a default-constructed element. Chunks that were not accessed since
+/// the previous call to @a releaseIdle() and are outside the range to
+/// keep are freed; their elements must be in the default state then.
+template <class T>
+class ChunkedArray
+{
+public:
+    ChunkedArray(size_t size, size_t chunk_size)
+        : m_size(size)
+        , m_zChunkSize(chunk_size)
+        , m_chunks((size + chunk_size - 1) / chunk_size, (T*)NULL)
+        , m_touched(m_chunks.size(), false)
+        , m_zAllocated(0)
+    {
+    }
+
+    ~ChunkedArray()
+    {
+        for (size_t i = 0; i < m_chunks.size(); ++i)
+            delete [] m_chunks[i];
+    }
+
+public:
+    const T& operator[](size_t index) const
+    {
+        if (index >= m_size)
+            throw_invalid_index(int(index));
+
+        const T* chunk = m_chunks[index / m_zChunkSize];
+        return chunk ? chunk[index % m_zChunkSize] : m_empty;
+    }
+
+    T& operator[](size_t index)
+    {
+        if (index >= m_size)
+            throw_invalid_index(int(index));
+
+        const size_t c = index / m_zChunkSize;
+        if (!m_chunks[c])
+        {
+            // The last chunk may be shorter; allocate it in full anyway.
+            m_chunks[c] = new T[m_zChunkSize];
+            ++m_zAllocated;
+        }
+        m_touched[c] = true;
+        return m_chunks[c][index % m_zChunkSize];
+    }
+
+    const T& operator[](int index) const
+    {
+        if (index < 0)
+            throw_invalid_index(index);
+        return (*this)[size_t(index)];
+    }
+
+    T& operator[](int index)
+    {
+        if (index < 0)
+            throw_invalid_index(index);
+        return (*this)[size_t(index)];
+    }
+
+    size_t size() const { return m_size; }
+
+    /// Number of elements for which the storage is currently allocated.
+    size_t capacity() const { return m_zAllocated * m_zChunkSize; }
+
+    bool isAllocated(size_t index) const { return m_chunks[index / m_zChunkSize] != NULL; }
+
+    /// Free the chunks not accessed since the previous call, except those
+    /// overlapping @a len positions from @a begin (wrapping around the end).
+    /// @return the number of chunks freed.
+    size_t releaseIdle(size_t begin, size_t len)
+    {
+        size_t nfreed = 0;
+        for (size_t c = 0; c < m_chunks.size(); ++c)
+        {
+            if (!m_chunks[c])
+                continue;
+
+            if (m_touched[c] || overlaps(c, begin, len))
+            {
+                m_touched[c] = false;
+                continue;
+            }
+
+            delete [] m_chunks[c];
+            m_chunks[c] = NULL;
+            --m_zAllocated;
+            ++nfreed;
+        }
+        return nfreed;
+    }
+
+private:
+    ChunkedArray(const ChunkedArray<T>& );
+    ChunkedArray<T>& operator=(const ChunkedArray<T>&);
+
+    bool overlaps(size_t c, size_t begin, size_t len) const
+    {
+        if (len == 0)
+            return false;
+
+        const size_t cbegin = c * m_zChunkSize;
+        const size_t cend   = std::min(cbegin + m_zChunkSize, m_size);
+        const size_t end    = begin + len; // may exceed m_size when wrapping
+        if (cbegin < end && begin < cend)
+            return true;
+        // The wrapped part of the range: [0, end - m_size).
+        return end > m_size && cbegin < end - m_size;
+    }
+
+    void throw_invalid_index(int i) const
+    {
+        std::stringstream ss;
+        ss << "Index " << i << "out of range";
+        throw std::runtime_error(ss.str());
+    }
+
+private:
+    const size_t      m_size;
+    const size_t      m_zChunkSize;
+    std::vector<T*>   m_chunks;
+    std::vector<bool> m_touched;
+    size_t            m_zAllocated;
+    T                 m_empty;
+};
+
+/// Fixed-size bitmap indexed by the positions of a circular buffer.
+/// Searches and counting go word by word, so a range of N positions
+/// is processed in about N/64 steps regardless of the bit pattern.
+class CircularBitmap
+{
+    typedef uint64_t word_t;
+    static const size_t WORD_BITS = 64;
+
+public:
+    explicit CircularBitmap(size_t size)
+        : m_size(size)
+        , m_words((size + WORD_BITS - 1) / WORD_BITS, 0)
+    {
+    }
+
+    size_t size() const { return m_size; }
+
+    /// Memory taken by the bits.
+    size_t memsize() const { return m_words.size() * sizeof(word_t); }
+
+    bool test(size_t pos) const { return (m_words[pos / WORD_BITS] >> (pos % WORD_BITS)) & 1; }
+    void set(size_t pos) { m_words[pos / WORD_BITS] |= word_t(1) << (pos % WORD_BITS); }
+    void clear(size_t pos) { m_words[pos / WORD_BITS] &= ~(word_t(1) << (pos % WORD_BITS)); }
+
+    void set(size_t pos, bool value)
+    {
+        if (value)
+            set(pos);
+        else
+            clear(pos);
+    }
+
+    /// Find the first position with the given value among @a len positions
+    /// starting from @a pos and going forward (wrapping around the end).
+    /// @return offset of the found position from @a pos, or -1 if not found.
+    int findNext(size_t pos, size_t len, bool value) const
+    {
+        const size_t tail = std::min(len, m_size - pos);
+        size_t found = findForward(pos, pos + tail, value);
+        if (found < pos + tail)
+            return int(found - pos);
+
+        found = findForward(0, len - tail, value);
+        if (found < len - tail)
+            return int(tail + found);
+        return -1;
+    }
+
+    /// Find the first position with the given value among @a len positions
+    /// starting from @a pos and going backward (wrapping around the beginning).
+    /// @return offset of the found position back from @a pos, or -1 if not found.
+    int findPrev(size_t pos, size_t len, bool value) const
+    {
+        const size_t head = std::min(len, pos + 1);
+        size_t found = findBackward(pos + 1 - head, pos + 1, value);
+        if (found != NPOS)
+            return int(pos - found);
+
+        found = findBackward(m_size - (len - head), m_size, value);
+        if (found != NPOS)
+            return int(head + (m_size - 1 - found));
+        return -1;
+    }
+
+    /// Count the set positions among @a len positions starting from @a pos.
+    size_t count(size_t pos, size_t len) const
+    {
+        const size_t tail = std::min(len, m_size - pos);
+        return countRange(pos, pos + tail) + countRange(0, len - tail);
+    }
+
+    /// Set @a len positions starting from @a pos (wrapping around the end) to @a value.
+    void setRange(size_t pos, size_t len, bool value)
+    {
+        const size_t tail = std::min(len, m_size - pos);
+        fillRange(pos, pos + tail, value);
+        fillRange(0, len - tail, value);
+    }
+
+private:
+    static const size_t NPOS = size_t(-1);
+
+    word_t load(size_t w, bool value) const { return value ? m_words[w] : ~m_words[w]; }
+
+    // First index in [begin, end) with the value, or end.
+    size_t findForward(size_t begin, size_t end, bool value) const
+    {
+        while (begin < end)
+        {
+            const size_t w    = begin / WORD_BITS;
+            const word_t word = load(w, value) & (~word_t(0) << (begin % WORD_BITS));
+            if (word)
+                return std::min(end, w * WORD_BITS + countTrailingZeros(word));
+            begin = (w + 1) * WORD_BITS;
+        }
+        return end;
+    }
+
+    // Last index in [begin, end) with the value, or NPOS.
+    size_t findBackward(size_t begin, size_t end, bool value) const
+    {
+        while (end > begin)
+        {
+            const size_t last = end - 1;
+            const size_t w    = last / WORD_BITS;
+            const word_t word = load(w, value) & (~word_t(0) >> (WORD_BITS - 1 - last % WORD_BITS));
+            if (word)
+            {
+                const size_t found = w * WORD_BITS + WORD_BITS - 1 - countLeadingZeros(word);
+                return found >= begin ? found : NPOS;
+            }
+            end = w * WORD_BITS;
+        }
+        return NPOS;
+    }
+
+    void fillRange(size_t begin, size_t end, bool value)
+    {
+        while (begin < end)
+        {
+            const size_t w    = begin / WORD_BITS;
+            const size_t next = (w + 1) * WORD_BITS;
+            word_t       mask = ~word_t(0) << (begin % WORD_BITS);
+            if (end < next)
+                mask &= ~word_t(0) >> (next - end);
+            if (value)
+                m_words[w] |= mask;
+            else
+                m_words[w] &= ~mask;
+            begin = next;
+        }
+    }
+
+    size_t countRange(size_t begin, size_t end) const
+    {
+        size_t n = 0;
+        while (begin < end)
+        {
+            const size_t w    = begin / WORD_BITS;
+            word_t       word = m_words[w] & (~word_t(0) << (begin % WORD_BITS));
+            const size_t next = (w + 1) * WORD_BITS;
+            if (end < next)
+                word &= ~word_t(0) >> (next - end);
+            n += popCount(word);
+            begin = next;
+        }
+        return n;
+    }
+
+#if defined(__GNUC__)
+    static size_t countTrailingZeros(word_t x) { return __builtin_ctzll(x); }
+    static size_t countLeadingZeros(word_t x) { return __builtin_clzll(x); }
+    static size_t popCount(word_t x) { return __builtin_popcountll(x); }
+#else
+    static size_t countTrailingZeros(word_t x)
+    {
+        size_t n = 0;
+        for (; !(x & 1); x >>= 1)
+            ++n;
+        return n;
+    }
+
+    static size_t countLeadingZeros(word_t x)
+    {
+        size_t n = 0;
+        for (; !(x & (word_t(1) << (WORD_BITS - 1))); x <<= 1)
+            ++n;
+        return n;
+    }
+
+    static size_t popCount(word_t x)
+    {
+        size_t n = 0;
+        for (; x; x &= x - 1)
+            ++n;
+        return n;
+    }
+#endif
+
+    size_t              m_size;
+    std::vector<word_t> m_words;
+};
+
 } // namespace srt
 
 // ------------------------------------------------------------
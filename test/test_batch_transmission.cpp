@@ -0,0 +1,130 @@
+#include <array>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_env.h"
+#include "srt.h"
+#include "common.h"
+#include "netinet_any.h"
+
+using namespace std;
+
+// Messages sent in batches with srt_sendmmsg arrive intact and in order.
+TEST(SendMMsg, LiveTransmission)
+{
+    srt::TestInit srtinit;
+
+    MAKE_UNIQUE_SOCK(listener, "listener", srt_create_socket());
+    MAKE_UNIQUE_SOCK(caller, "caller", srt_create_socket());
+
+    srt::sockaddr_any sa = srt::CreateAddr("127.0.0.1", 5212, AF_INET);
+    ASSERT_NE(srt_bind(listener, sa.get(), sa.size()), SRT_ERROR);
+    ASSERT_NE(srt_listen(listener, 1), SRT_ERROR);
+    ASSERT_NE(srt_connect(caller, sa.get(), sa.size()), SRT_ERROR);
+
+    MAKE_UNIQUE_SOCK(accepted, "accepted", srt_accept(listener, NULL, NULL));
+
+    const int nmsgs = 20;
+    vector<array<char, 1316>> payloads(nmsgs);
+    vector<SRT_MSGVEC> msgs(nmsgs);
+    for (int i = 0; i < nmsgs; ++i)
+    {
+        payloads[i].fill(char(i));
+        msgs[i].buf   = payloads[i].data();
+        msgs[i].len   = int(payloads[i].size());
+        msgs[i].mctrl = srt_msgctrl_default;
+    }
+
+    EXPECT_EQ(srt_sendmmsg(caller, msgs.data(), 0), SRT_ERROR);
+
+    // A message too big for a live packet stops the batch and gets the error reported.
+    vector<char> toobig(2000);
+    msgs[nmsgs - 1].buf = toobig.data();
+    msgs[nmsgs - 1].len = int(toobig.size());
+
+    ASSERT_EQ(srt_sendmmsg(caller, msgs.data(), nmsgs), nmsgs - 1);
+    for (int i = 0; i < nmsgs - 1; ++i)
+    {
+        EXPECT_EQ(msgs[i].result, 1316);
+        if (i > 0)
+        {
+            EXPECT_EQ(msgs[i].mctrl.pktseq, srt::CSeqNo::incseq(msgs[i - 1].mctrl.pktseq));
+        }
+    }
+    EXPECT_EQ(msgs[nmsgs - 1].result, SRT_ERROR);
+    EXPECT_EQ(msgs[nmsgs - 1].errcode, int(SRT_EINVALMSGAPI));
+
+    // Failing on the first message fails the call.
+    EXPECT_EQ(srt_sendmmsg(caller, &msgs[nmsgs - 1], 1), SRT_ERROR);
+    EXPECT_EQ(srt_getlasterror(NULL), int(SRT_EINVALMSGAPI));
+
+    array<char, 1500> rbuf;
+    for (int i = 0; i < nmsgs - 1; ++i)
+    {
+        SRT_MSGCTRL mctrl = srt_msgctrl_default;
+        ASSERT_EQ(srt_recvmsg2(accepted, rbuf.data(), int(rbuf.size()), &mctrl), 1316);
+        EXPECT_EQ(rbuf[0], char(i));
+        EXPECT_EQ(rbuf[1315], char(i));
+        EXPECT_EQ(mctrl.pktseq, msgs[i].mctrl.pktseq);
+    }
+}
+
+// All messages ready are read with one srt_recvmmsg call.
+TEST(RecvMMsg, LiveTransmission)
+{
+    srt::TestInit srtinit;
+
+    MAKE_UNIQUE_SOCK(listener, "listener", srt_create_socket());
+    MAKE_UNIQUE_SOCK(caller, "caller", srt_create_socket());
+
+    srt::sockaddr_any sa = srt::CreateAddr("127.0.0.1", 5213, AF_INET);
+    ASSERT_NE(srt_bind(listener, sa.get(), sa.size()), SRT_ERROR);
+    ASSERT_NE(srt_listen(listener, 1), SRT_ERROR);
+    ASSERT_NE(srt_connect(caller, sa.get(), sa.size()), SRT_ERROR);
+
+    MAKE_UNIQUE_SOCK(accepted, "accepted", srt_accept(listener, NULL, NULL));
+
+    const int nbufs = 8;
+    vector<array<char, 1500>> rbufs(nbufs);
+    vector<SRT_MSGVEC> msgs(nbufs);
+    for (int i = 0; i < nbufs; ++i)
+    {
+        msgs[i].buf   = rbufs[i].data();
+        msgs[i].len   = int(rbufs[i].size());
+        msgs[i].mctrl = srt_msgctrl_default;
+    }
+
+    // Nothing to read yet.
+    EXPECT_EQ(srt_recvmmsg(accepted, msgs.data(), nbufs, 0), SRT_ERROR);
+    EXPECT_EQ(srt_getlasterror(NULL), int(SRT_EASYNCRCV));
+    EXPECT_EQ(srt_recvmmsg(accepted, msgs.data(), nbufs, 50), SRT_ERROR);
+    EXPECT_EQ(srt_getlasterror(NULL), int(SRT_ETIMEOUT));
+
+    const int nmsgs = 20;
+    array<char, 1316> msg;
+    for (int i = 0; i < nmsgs; ++i)
+    {
+        msg.fill(char(i));
+        ASSERT_EQ(srt_sendmsg(caller, msg.data(), int(msg.size()), -1, true), int(msg.size()));
+    }
+
+    // Wait until all messages have passed their delivery time.
+    this_thread::sleep_for(chrono::milliseconds(300));
+
+    int nread = 0;
+    while (nread < nmsgs)
+    {
+        const int n = srt_recvmmsg(accepted, msgs.data(), nbufs, 1000);
+        ASSERT_GT(n, 0);
+        ASSERT_LE(n, nbufs);
+        for (int i = 0; i < n; ++i)
+        {
+            EXPECT_EQ(msgs[i].result, 1316);
+            EXPECT_EQ(rbufs[i][0], char(nread + i));
+            EXPECT_EQ(rbufs[i][1315], char(nread + i));
+        }
+        nread += n;
+    }
+    EXPECT_EQ(nread, nmsgs);
+}
@@ -191,6 +191,186 @@ TEST_F(CRcvBufferReadMsg, FullBuffer)
     EXPECT_EQ(m_unit_queue->size(), m_unit_queue->capacity());
 }
 
+// Reading a message by views hands out the units holding the payload,
+// which are freed only when the views are released.
+TEST_F(CRcvBufferReadMsg, ReadMessageViews)
+{
+    const size_t msg_pkts = 3;
+    EXPECT_EQ(addMessage(msg_pkts, 1, m_init_seqno), 0);
+    EXPECT_EQ(addMessage(1, 2, CSeqNo::incseq(m_init_seqno, msg_pkts)), 0);
+    ackPackets(msg_pkts + 1);
+
+    // Too few views: nothing is read.
+    array<SRT_PKTVIEW, 4> views;
+    EXPECT_EQ(m_rcv_buffer->readMessageViews(views.data(), 2), -1);
+    EXPECT_TRUE(hasAvailablePackets());
+
+    SRT_MSGCTRL mctrl = srt_msgctrl_default;
+    ASSERT_EQ(m_rcv_buffer->readMessageViews(views.data(), int(views.size()), &mctrl), int(msg_pkts));
+    EXPECT_EQ(mctrl.msgno, 1);
+    for (size_t i = 0; i < msg_pkts; ++i)
+    {
+        ASSERT_EQ(views[i].len, int(m_payload_sz));
+        EXPECT_TRUE(verifyPayload(const_cast<char*>(views[i].data), views[i].len, CSeqNo::incseq(m_init_seqno, int(i))));
+    }
+    EXPECT_EQ(m_rcv_buffer->countHeldUnits(), msg_pkts);
+    EXPECT_EQ(m_unit_queue->size(), m_unit_queue->capacity() - int(msg_pkts) - 1);
+
+    // The next message is read by copying, independently of the held units.
+    array<char, m_payload_sz> buff;
+    EXPECT_EQ(readMessage(buff.data(), buff.size()), int(m_payload_sz));
+    EXPECT_TRUE(verifyPayload(buff.data(), m_payload_sz, CSeqNo::incseq(m_init_seqno, msg_pkts)));
+
+    // Release out of order; an unknown view is ignored.
+    EXPECT_EQ(m_rcv_buffer->releaseViews(&views[1], 1), 1);
+    EXPECT_EQ(m_rcv_buffer->releaseViews(&views[1], 1), 0);
+    EXPECT_EQ(m_rcv_buffer->releaseViews(views.data(), int(msg_pkts)), int(msg_pkts) - 1);
+    EXPECT_EQ(m_rcv_buffer->countHeldUnits(), 0u);
+    EXPECT_EQ(m_unit_queue->size(), m_unit_queue->capacity());
+
+    // Units still held are freed together with the buffer.
+    EXPECT_EQ(addMessage(1, 3, CSeqNo::incseq(m_init_seqno, msg_pkts + 1)), 0);
+    ackPackets(1);
+    EXPECT_EQ(m_rcv_buffer->readMessageViews(views.data(), 1), 1);
+    m_rcv_buffer.reset();
+    EXPECT_EQ(m_unit_queue->size(), m_unit_queue->capacity());
+}
+
+// A message read with readMessagev is scattered over the buffers in order.
+TEST_F(CRcvBufferReadMsg, ReadMessageScattered)
+{
+    EXPECT_EQ(addMessage(2, 1, m_init_seqno), 0);
+    ackPackets(2);
+
+    array<char, 100> head;
+    array<char, 2000> body;
+    array<char, 1000> tail;
+    SRT_IOVEC iov[3] = {{head.data(), head.size()}, {body.data(), body.size()}, {tail.data(), tail.size()}};
+
+    SRT_MSGCTRL mctrl = srt_msgctrl_default;
+    ASSERT_EQ(m_rcv_buffer->readMessagev(iov, 3, &mctrl), int(2 * m_payload_sz));
+    EXPECT_EQ(mctrl.msgno, 1);
+
+    const int seqno2 = CSeqNo::incseq(m_init_seqno);
+    const size_t in_body = m_payload_sz - head.size();
+    EXPECT_TRUE(verifyPayload(head.data(), head.size(), m_init_seqno));
+    EXPECT_TRUE(verifyPayload(body.data(), in_body, m_init_seqno + int(head.size())));
+    EXPECT_TRUE(verifyPayload(body.data() + in_body, body.size() - in_body, seqno2));
+    EXPECT_TRUE(verifyPayload(tail.data(), 2 * m_payload_sz - head.size() - body.size(), seqno2 + int(body.size() - in_body)));
+    EXPECT_FALSE(hasAvailablePackets());
+}
+
+// The storage for the entries is allocated in chunks as the packets
+// come in and released after the chunks were not used for a period.
+TEST_F(CRcvBufferReadMsg, StorageOnDemand)
+{
+    m_rcv_buffer.reset(new CRcvBuffer(m_init_seqno, 4096, m_unit_queue.get(), m_use_message_api));
+    const size_t usage_empty = m_rcv_buffer->getMemoryUsage();
+
+    EXPECT_EQ(addMessage(1, 1, m_init_seqno), 0);
+    const size_t usage_one = m_rcv_buffer->getMemoryUsage();
+    EXPECT_GT(usage_one, usage_empty);
+
+    // A packet far ahead takes one more chunk, not the entries in between.
+    EXPECT_EQ(addMessage(1, 2, CSeqNo::incseq(m_init_seqno, 3000)), 0);
+    const size_t usage_two = m_rcv_buffer->getMemoryUsage();
+    EXPECT_EQ(usage_two - usage_empty, 2 * (usage_one - usage_empty));
+
+    // The storage in use is kept.
+    m_rcv_buffer->releaseIdleStorage();
+    m_rcv_buffer->releaseIdleStorage();
+    EXPECT_EQ(m_rcv_buffer->getMemoryUsage(), usage_two);
+
+    // Dropping the packets doesn't allocate the gap.
+    m_rcv_buffer->dropAll();
+    EXPECT_EQ(m_rcv_buffer->getMemoryUsage(), usage_two);
+
+    // Released after a whole period without use.
+    m_rcv_buffer->releaseIdleStorage();
+    EXPECT_EQ(m_rcv_buffer->getMemoryUsage(), usage_two);
+    m_rcv_buffer->releaseIdleStorage();
+    EXPECT_EQ(m_rcv_buffer->getMemoryUsage(), usage_empty);
+
+    // And allocated again when needed.
+    EXPECT_EQ(addMessage(1, 3, CSeqNo::incseq(m_init_seqno, 3001)), 0);
+    EXPECT_EQ(m_rcv_buffer->getMemoryUsage(), usage_one);
+}
+
+// Dropping missing packets records the drop without
+// allocating the storage for the entries in the gap.
+TEST_F(CRcvBufferReadMsg, DropGapNoStorage)
+{
+    m_rcv_buffer.reset(new CRcvBuffer(m_init_seqno, 4096, m_unit_queue.get(), m_use_message_api));
+    EXPECT_EQ(addMessage(1, 1, m_init_seqno), 0);
+    const size_t usage_one = m_rcv_buffer->getMemoryUsage();
+
+    const int32_t gap_lo = CSeqNo::incseq(m_init_seqno, 1);
+    const int32_t gap_hi = CSeqNo::incseq(m_init_seqno, 3000);
+    EXPECT_EQ(m_rcv_buffer->dropMessage(gap_lo, gap_hi, SRT_MSGNO_NONE, CRcvBuffer::KEEP_EXISTING), 3000);
+    EXPECT_EQ(m_rcv_buffer->getMemoryUsage(), usage_one);
+    EXPECT_EQ(m_rcv_buffer->dropMessage(gap_lo, gap_hi, 2, CRcvBuffer::DROP_EXISTING), 0);
+    EXPECT_EQ(m_rcv_buffer->getMemoryUsage(), usage_one);
+
+    // A packet coming late for the dropped range is rejected.
+    EXPECT_EQ(addMessage(1, 2, CSeqNo::incseq(m_init_seqno, 2000)), -1);
+    EXPECT_EQ(m_rcv_buffer->getMemoryUsage(), usage_one);
+
+    // Reading skips the dropped range.
+    array<char, m_payload_sz> buff;
+    EXPECT_EQ(readMessage(buff.data(), buff.size()), int(m_payload_sz));
+    EXPECT_TRUE(verifyPayload(buff.data(), m_payload_sz, m_init_seqno));
+    EXPECT_EQ(addMessage(1, 3, CSeqNo::incseq(m_init_seqno, 3001)), 0);
+    EXPECT_EQ(readMessage(buff.data(), buff.size()), int(m_payload_sz));
+    EXPECT_TRUE(verifyPayload(buff.data(), m_payload_sz, CSeqNo::incseq(m_init_seqno, 3001)));
+    EXPECT_EQ(m_unit_queue->size(), m_unit_queue->capacity());
+}
+
+TEST_F(CRcvBufferReadMsg, MemoryShare)
+{
+    // 256 units shared by two buffers.
+    m_unit_queue->setMemoryLimit(256 * 1500);
+    m_rcv_buffer.reset(new CRcvBuffer(m_init_seqno, 512, m_unit_queue.get(), m_use_message_api));
+    unique_ptr<CRcvBuffer> other(new CRcvBuffer(m_init_seqno, 512, m_unit_queue.get(), m_use_message_api));
+
+    for (int i = 0; i < 150; ++i)
+        ASSERT_EQ(addMessage(1, i + 1, CSeqNo::incseq(m_init_seqno, i)), 0);
+    EXPECT_EQ(m_rcv_buffer->getUnitsHeld(), 150);
+    EXPECT_EQ(m_rcv_buffer->getMemShare(), 128);
+
+    // Enough memory left: nobody is throttled.
+    EXPECT_EQ(m_rcv_buffer->getMemShareLeft(), numeric_limits<int>::max());
+
+    for (int i = 0; i < 80; ++i)
+    {
+        CUnit* unit = m_unit_queue->getNextAvailUnit();
+        ASSERT_NE(unit, nullptr);
+        unit->m_Packet.set_seqno(CSeqNo::incseq(m_init_seqno, i));
+        unit->m_Packet.set_msgflags(PacketBoundaryBits(PB_SOLO) | MSGNO_PACKET_INORDER::wrap(1) | (i + 1));
+        unit->m_Packet.setLength(m_payload_sz);
+        ASSERT_EQ(other->insert(unit), 0);
+    }
+    EXPECT_EQ(other->getUnitsHeld(), 80);
+
+    // Over 3/4 of the budget taken: the buffer over its share is throttled.
+    EXPECT_EQ(m_rcv_buffer->getMemShareLeft(), 0);
+    EXPECT_EQ(other->getMemShareLeft(), 128 - 80);
+
+    // The queue does not grow beyond the budget.
+    EXPECT_LE(m_unit_queue->capacity(), 256);
+
+    // Reading gives the units back.
+    array<char, m_payload_sz> buff;
+    for (int i = 0; i < 30; ++i)
+        EXPECT_EQ(m_rcv_buffer->readMessage(buff.data(), buff.size()), int(m_payload_sz));
+    EXPECT_EQ(m_rcv_buffer->getUnitsHeld(), 120);
+    EXPECT_EQ(m_rcv_buffer->getMemShareLeft(), 8);
+
+    // The share of the remaining buffer covers the whole budget.
+    other.reset();
+    EXPECT_EQ(m_rcv_buffer->getMemShare(), 256);
+    EXPECT_EQ(m_rcv_buffer->getMemShareLeft(), numeric_limits<int>::max());
+}
+
 // BUG in the old RCV buffer!!!
 // In this test case a packet is added to receiver buffer with offset 1,
 // thus leaving offset 0 with an empty pointer.
@@ -0,0 +1,527 @@
+#include <array>
+#include <cstring>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include "gtest/gtest.h"
+#include "buffer_snd.h"
+
+using namespace srt;
+using namespace std;
+
+class CSndBufferTest
+    : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        m_snd_buffer.reset(new CSndBuffer(AF_INET, m_buff_size_pkts, m_payload_sz, 0));
+        m_next_seqno = m_init_seqno;
+    }
+
+    void TearDown() override
+    {
+        m_snd_buffer.reset();
+    }
+
+    /// Add a message of @a npkts packets, each filled with its sequence number.
+    void addMessage(int npkts, int ttl = -1)
+    {
+        vector<char> data(npkts * m_payload_sz);
+        for (int i = 0; i < npkts; ++i)
+            fill(data.begin() + i * m_payload_sz, data.begin() + (i + 1) * m_payload_sz,
+                 char(CSeqNo::incseq(m_next_seqno, i)));
+
+        SRT_MSGCTRL mctrl = srt_msgctrl_default;
+        mctrl.pktseq = m_next_seqno;
+        mctrl.msgttl = ttl;
+        m_snd_buffer->addBuffer(data.data(), int(data.size()), (mctrl));
+        m_next_seqno = mctrl.pktseq;
+    }
+
+    /// Read the packet at the given offset from the first one as for retransmission.
+    int readRexmit(int offset, CPacket& w_packet, CSndBuffer::DropRange& w_drop)
+    {
+        w_packet.set_seqno(CSeqNo::incseq(m_init_seqno, m_acked + offset));
+        sync::steady_clock::time_point tsorigin;
+        return m_snd_buffer->readData(offset, (w_packet), (tsorigin), (w_drop));
+    }
+
+    void ack(int npkts)
+    {
+        m_snd_buffer->ackData(npkts);
+        m_acked += npkts;
+    }
+
+protected:
+    // Declared before the buffer, which gives its memory back to it on destruction.
+    CSndBlockPool m_pool;
+    unique_ptr<CSndBuffer> m_snd_buffer;
+    const int m_buff_size_pkts = 16;
+    const int m_payload_sz     = 1456;
+    const int m_init_seqno     = 1000;
+    int m_next_seqno = 0;
+    int m_acked      = 0;
+};
+
+// Rexmit reads at any offset must return the packet with
+// the matching sequence number, also after the buffer wrapped.
+TEST_F(CSndBufferTest, ReadAtOffset)
+{
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+
+    for (int round = 0; round < 5; ++round)
+    {
+        for (int i = 0; i < 10; ++i)
+            addMessage(1);
+        EXPECT_EQ(m_snd_buffer->getCurrBufSize(), 10);
+
+        for (int off = 9; off >= 0; --off)
+        {
+            const int len = readRexmit(off, (pkt), (drop));
+            ASSERT_EQ(len, m_payload_sz);
+            EXPECT_EQ(pkt.data()[0], char(CSeqNo::incseq(m_init_seqno, m_acked + off)));
+        }
+
+        EXPECT_EQ(readRexmit(10, (pkt), (drop)), int(CSndBuffer::READ_NONE));
+        ack(10);
+        EXPECT_EQ(m_snd_buffer->getCurrBufSize(), 0);
+    }
+}
+
+// Growing the buffer keeps the unacknowledged packets, their
+// order, and the position of the next packet to send originally.
+TEST_F(CSndBufferTest, IncreaseKeepsOrder)
+{
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+    sync::steady_clock::time_point tsorigin;
+    int seqnoinc = 0;
+
+    // Move the first position in the middle of the ring.
+    for (int i = 0; i < 10; ++i)
+        addMessage(1);
+    for (int i = 0; i < 10; ++i)
+        ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+    ack(10);
+
+    // Now make it wrap and grow several times.
+    for (int i = 0; i < 50; ++i)
+        addMessage(1);
+    for (int i = 0; i < 5; ++i)
+        ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+    EXPECT_EQ(m_snd_buffer->getCurrBufSize(), 50);
+
+    for (int off = 0; off < 50; ++off)
+    {
+        ASSERT_EQ(readRexmit(off, (pkt), (drop)), m_payload_sz);
+        EXPECT_EQ(pkt.seqno(), CSeqNo::incseq(m_init_seqno, m_acked + off));
+        EXPECT_EQ(pkt.data()[0], char(CSeqNo::incseq(m_init_seqno, m_acked + off)));
+    }
+
+    // The next original packet is the 6th one after the ACK point.
+    ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+    EXPECT_EQ(pkt.seqno(), CSeqNo::incseq(m_init_seqno, m_acked + 5));
+
+    int bytes = 0, timespan = 0;
+    EXPECT_EQ(m_snd_buffer->getCurrBufSize((bytes), (timespan)), 50);
+    EXPECT_EQ(bytes, 50 * m_payload_sz);
+
+    // ACK past the current position moves it too.
+    ack(20);
+    ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+    EXPECT_EQ(pkt.seqno(), CSeqNo::incseq(m_init_seqno, m_acked));
+    EXPECT_EQ(m_snd_buffer->getCurrBufSize((bytes), (timespan)), 30);
+    EXPECT_EQ(bytes, 30 * m_payload_sz);
+}
+
+// The send time of a packet is the time of its latest transmission,
+// original or retransmission, and zero while the packet wasn't sent.
+TEST_F(CSndBufferTest, PacketSentTime)
+{
+    using namespace sync;
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+    steady_clock::time_point tsorigin;
+    int seqnoinc = 0;
+
+    addMessage(1);
+    addMessage(1);
+    EXPECT_TRUE(is_zero(m_snd_buffer->getPacketSentTime(0)));
+    EXPECT_TRUE(is_zero(m_snd_buffer->getPacketSentTime(1)));
+    EXPECT_TRUE(is_zero(m_snd_buffer->getPacketSentTime(2)));
+
+    const steady_clock::time_point before = steady_clock::now();
+    ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+    const steady_clock::time_point sent = m_snd_buffer->getPacketSentTime(0);
+    EXPECT_GE(sent, before);
+    EXPECT_TRUE(is_zero(m_snd_buffer->getPacketRexmitTime(0)));
+    EXPECT_TRUE(is_zero(m_snd_buffer->getPacketSentTime(1)));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    ASSERT_EQ(readRexmit(0, (pkt), (drop)), m_payload_sz);
+    EXPECT_GT(m_snd_buffer->getPacketSentTime(0), sent);
+    EXPECT_EQ(m_snd_buffer->getPacketSentTime(0), m_snd_buffer->getPacketRexmitTime(0));
+
+    ack(1);
+    EXPECT_TRUE(is_zero(m_snd_buffer->getPacketSentTime(0)));
+    EXPECT_TRUE(is_zero(m_snd_buffer->getPacketSentTime(-1)));
+}
+
+static int fillFromSource(char* dst, int len, void*)
+{
+    memset(dst, 'f', size_t(len));
+    return len;
+}
+
+// Blocks reused for the data read from a source carry no
+// transmission times of the packets they held before.
+TEST_F(CSndBufferTest, AddBufferFromResetsTimes)
+{
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+    sync::steady_clock::time_point tsorigin;
+    int seqnoinc = 0;
+
+    // Go around the whole ring with packets sent and retransmitted.
+    for (int i = 0; i < m_buff_size_pkts; ++i)
+    {
+        addMessage(1);
+        ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+        ASSERT_EQ(readRexmit(0, (pkt), (drop)), m_payload_sz);
+        ack(1);
+    }
+
+    ASSERT_EQ(m_snd_buffer->addBufferFrom(2 * m_payload_sz, fillFromSource, NULL, (m_next_seqno)), 2 * m_payload_sz);
+    for (int off = 0; off < 2; ++off)
+    {
+        EXPECT_TRUE(is_zero(m_snd_buffer->getPacketSentTime(off)));
+        EXPECT_TRUE(is_zero(m_snd_buffer->getPacketRexmitTime(off)));
+    }
+}
+
+// Packets of the data read from a source are stamped with the scheduling
+// sequence numbers and can be retransmitted like those of a message.
+TEST_F(CSndBufferTest, AddBufferFromRexmit)
+{
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+    sync::steady_clock::time_point tsorigin;
+    int seqnoinc = 0;
+
+    addMessage(1);
+    ASSERT_EQ(m_snd_buffer->addBufferFrom(3 * m_payload_sz, fillFromSource, NULL, (m_next_seqno)), 3 * m_payload_sz);
+    EXPECT_EQ(m_next_seqno, CSeqNo::incseq(m_init_seqno, 4));
+    addMessage(1);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+        EXPECT_EQ(pkt.seqno(), CSeqNo::incseq(m_init_seqno, i));
+    }
+
+    for (int off = 4; off >= 0; --off)
+    {
+        ASSERT_EQ(readRexmit(off, (pkt), (drop)), m_payload_sz);
+        EXPECT_EQ(pkt.seqno(), CSeqNo::incseq(m_init_seqno, off));
+        if (off >= 1 && off <= 3)
+            EXPECT_EQ(pkt.m_pcData[0], 'f');
+        else
+            EXPECT_EQ(pkt.m_pcData[0], char(CSeqNo::incseq(m_init_seqno, off)));
+    }
+}
+
+// Message numbers are reported per offset, and the retransmission
+// of a message with expired TTL asks for dropping the whole message.
+TEST_F(CSndBufferTest, MsgNoAndTTLDrop)
+{
+    addMessage(3);
+    addMessage(2, 0);
+    addMessage(1);
+
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(0), 1);
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(2), 1);
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(3), 2);
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(5), 3);
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(6), SRT_MSGNO_CONTROL);
+
+    sync::this_thread::sleep_for(sync::milliseconds_from(2));
+
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+    EXPECT_EQ(readRexmit(3, (pkt), (drop)), int(CSndBuffer::READ_DROP));
+    EXPECT_EQ(drop.msgno, 2);
+    EXPECT_EQ(drop.seqno[CSndBuffer::DropRange::BEGIN], CSeqNo::incseq(m_init_seqno, 3));
+    EXPECT_EQ(drop.seqno[CSndBuffer::DropRange::END], CSeqNo::incseq(m_init_seqno, 4));
+
+    EXPECT_EQ(readRexmit(5, (pkt), (drop)), m_payload_sz);
+}
+
+// Dropping late data releases the packets from the front of the buffer.
+TEST_F(CSndBufferTest, DropLateData)
+{
+    for (int i = 0; i < 30; ++i)
+        addMessage(1);
+
+    int bytes = 0;
+    int32_t first_msgno = 0;
+    const int dropped = m_snd_buffer->dropLateData((bytes), (first_msgno), sync::steady_clock::now() + sync::seconds_from(1));
+    EXPECT_EQ(dropped, 30);
+    EXPECT_EQ(bytes, 30 * m_payload_sz);
+    EXPECT_EQ(first_msgno, 31);
+    EXPECT_EQ(m_snd_buffer->getCurrBufSize(), 0);
+}
+
+// User buffers added by reference are sent without copying and given
+// back once all their packets are released from the buffer.
+TEST_F(CSndBufferTest, ZeroCopyRelease)
+{
+    vector<char> msg1(3 * m_payload_sz, 'a');
+    vector<char> msg2(m_payload_sz, 'b');
+    vector<char> msg3(2 * m_payload_sz, 'c');
+
+    SRT_MSGCTRL mctrl = srt_msgctrl_default;
+    mctrl.pktseq = m_init_seqno;
+    m_snd_buffer->addBuffer(msg1.data(), int(msg1.size()), (mctrl), true);
+    m_snd_buffer->addBuffer(msg2.data(), int(msg2.size()), (mctrl), true);
+    m_snd_buffer->addBuffer(msg3.data(), int(msg3.size()), (mctrl), true);
+
+    CPacket pkt;
+    sync::steady_clock::time_point tsorigin;
+    int seqnoinc = 0;
+    ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+    EXPECT_EQ(pkt.data(), msg1.data());
+    ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+    EXPECT_EQ(pkt.data(), msg1.data() + m_payload_sz);
+
+    // A partially acknowledged message is still referenced.
+    ack(2);
+    EXPECT_FALSE(m_snd_buffer->hasReleasedUserBuffers());
+
+    ack(2);
+    ASSERT_TRUE(m_snd_buffer->hasReleasedUserBuffers());
+    vector<CSndBuffer::UserBuffer> released;
+    m_snd_buffer->takeReleasedUserBuffers((released));
+    ASSERT_EQ(released.size(), 2u);
+    EXPECT_EQ(released[0].data, msg1.data());
+    EXPECT_EQ(released[0].len, int(msg1.size()));
+    EXPECT_EQ(released[0].status, int(SRT_ZC_ACKED));
+    EXPECT_EQ(released[1].data, msg2.data());
+    EXPECT_FALSE(m_snd_buffer->hasReleasedUserBuffers());
+
+    // The rest is given back when the buffer is going to be deleted.
+    released.clear();
+    m_snd_buffer->releaseAllUserBuffers();
+    m_snd_buffer->takeReleasedUserBuffers((released));
+    ASSERT_EQ(released.size(), 1u);
+    EXPECT_EQ(released[0].data, msg3.data());
+    EXPECT_EQ(released[0].status, int(SRT_ZC_CLOSED));
+}
+
+// User buffers of messages dropped by TTL or as too late are reported dropped.
+TEST_F(CSndBufferTest, ZeroCopyDropped)
+{
+    vector<char> msg1(m_payload_sz, 'a');
+    vector<char> msg2(2 * m_payload_sz, 'b');
+
+    SRT_MSGCTRL mctrl = srt_msgctrl_default;
+    mctrl.pktseq = m_init_seqno;
+    mctrl.msgttl = 0;
+    m_snd_buffer->addBuffer(msg1.data(), int(msg1.size()), (mctrl), true);
+    mctrl.msgttl = -1;
+    m_snd_buffer->addBuffer(msg2.data(), int(msg2.size()), (mctrl), true);
+
+    sync::this_thread::sleep_for(sync::milliseconds_from(2));
+
+    // The first message is skipped when sending due to expired TTL.
+    CPacket pkt;
+    sync::steady_clock::time_point tsorigin;
+    int seqnoinc = 0;
+    ASSERT_EQ(m_snd_buffer->readData((pkt), (tsorigin), 0, (seqnoinc)), m_payload_sz);
+    EXPECT_EQ(seqnoinc, 1);
+    EXPECT_EQ(pkt.data(), msg2.data());
+
+    int bytes = 0;
+    int32_t first_msgno = 0;
+    EXPECT_EQ(m_snd_buffer->dropLateData((bytes), (first_msgno), sync::steady_clock::now()), 3);
+
+    vector<CSndBuffer::UserBuffer> released;
+    m_snd_buffer->takeReleasedUserBuffers((released));
+    ASSERT_EQ(released.size(), 2u);
+    EXPECT_EQ(released[0].data, msg1.data());
+    EXPECT_EQ(released[0].status, int(SRT_ZC_DROPPED));
+    EXPECT_EQ(released[1].data, msg2.data());
+    EXPECT_EQ(released[1].status, int(SRT_ZC_DROPPED));
+}
+
+// Adding messages in a batch stamps them like separate calls would.
+TEST_F(CSndBufferTest, AddBuffers)
+{
+    vector<char> msg1(2 * m_payload_sz, 'a');
+    vector<char> msg2(m_payload_sz, 'b');
+    vector<char> msg3(3 * m_payload_sz, 'c');
+
+    SRT_MSGVEC msgs[3];
+    char* bufs[3] = {msg1.data(), msg2.data(), msg3.data()};
+    const int lens[3] = {int(msg1.size()), int(msg2.size()), int(msg3.size())};
+    for (int i = 0; i < 3; ++i)
+    {
+        msgs[i].buf   = bufs[i];
+        msgs[i].len   = lens[i];
+        msgs[i].mctrl = srt_msgctrl_default;
+    }
+
+    EXPECT_EQ(m_snd_buffer->addBuffers(msgs, 3, m_init_seqno), CSeqNo::incseq(m_init_seqno, 6));
+    EXPECT_EQ(msgs[0].mctrl.pktseq, m_init_seqno);
+    EXPECT_EQ(msgs[1].mctrl.pktseq, CSeqNo::incseq(m_init_seqno, 2));
+    EXPECT_EQ(msgs[2].mctrl.pktseq, CSeqNo::incseq(m_init_seqno, 3));
+    EXPECT_EQ(msgs[0].mctrl.msgno, 1);
+    EXPECT_EQ(msgs[2].mctrl.msgno, 3);
+    EXPECT_EQ(m_snd_buffer->getCurrBufSize(), 6);
+
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(1), 1);
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(2), 2);
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(5), 3);
+
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+    ASSERT_EQ(readRexmit(3, (pkt), (drop)), m_payload_sz);
+    EXPECT_EQ(pkt.seqno(), CSeqNo::incseq(m_init_seqno, 3));
+    EXPECT_EQ(pkt.data()[0], 'c');
+}
+
+// A message gathered from several pieces is split into packets
+// as if it was given in one buffer.
+TEST_F(CSndBufferTest, AddBufferGathered)
+{
+    vector<char> head(100, 'h');
+    vector<char> body(2000, 'b');
+    vector<char> tail(500, 't');
+    SRT_IOVEC iov[3] = {{head.data(), head.size()}, {body.data(), body.size()}, {tail.data(), tail.size()}};
+
+    SRT_MSGCTRL mctrl = srt_msgctrl_default;
+    mctrl.pktseq = m_init_seqno;
+    m_snd_buffer->addBufferv(iov, 3, 2600, (mctrl));
+    EXPECT_EQ(mctrl.pktseq, CSeqNo::incseq(m_init_seqno, 2));
+    EXPECT_EQ(m_snd_buffer->getCurrBufSize(), 2);
+
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+    ASSERT_EQ(readRexmit(0, (pkt), (drop)), m_payload_sz);
+    EXPECT_EQ(pkt.data()[99], 'h');
+    EXPECT_EQ(pkt.data()[100], 'b');
+    EXPECT_EQ(pkt.data()[m_payload_sz - 1], 'b');
+
+    ASSERT_EQ(readRexmit(1, (pkt), (drop)), 2600 - m_payload_sz);
+    const int body_left = 2100 - m_payload_sz;
+    EXPECT_EQ(pkt.data()[body_left - 1], 'b');
+    EXPECT_EQ(pkt.data()[body_left], 't');
+    EXPECT_EQ(pkt.data()[2600 - m_payload_sz - 1], 't');
+}
+
+TEST(CSndBlockPool, Limit)
+{
+    CSndBlockPool pool;
+    pool.setLimit(3000);
+
+    char* a = pool.allocate(1000);
+    char* b = pool.allocate(1000);
+    char* c = pool.allocate(1000);
+    ASSERT_TRUE(a && b && c);
+    EXPECT_EQ(pool.available(), 0);
+    EXPECT_EQ(pool.allocate(1000), nullptr);
+
+    // Forced allocation goes over the limit.
+    char* d = pool.allocate(1000, true);
+    ASSERT_NE(d, nullptr);
+    EXPECT_EQ(pool.used(), 4000);
+
+    pool.release(a, 1000);
+    EXPECT_EQ(pool.available(), 0);
+    pool.release(b, 1000);
+    EXPECT_EQ(pool.available(), 1000);
+
+    // A chunk given back is reused.
+    EXPECT_EQ(pool.allocate(1000), b);
+
+    pool.release(b, 1000);
+    pool.release(c, 1000);
+    pool.release(d, 1000);
+    EXPECT_EQ(pool.used(), 0);
+}
+
+// The buffer grows only as far as the shared pool allows
+// and gives the memory back when it stays empty.
+TEST_F(CSndBufferTest, SharedPool)
+{
+    const int64_t chunk = int64_t(m_buff_size_pkts) * m_payload_sz;
+    m_pool.setLimit(2 * chunk);
+
+    m_snd_buffer.reset(new CSndBuffer(AF_INET, m_buff_size_pkts, m_payload_sz, 0, &m_pool));
+    EXPECT_EQ(m_pool.used(), chunk);
+    EXPECT_EQ(m_snd_buffer->getFreeBlocks(), 2 * m_buff_size_pkts - 1);
+
+    addMessage(m_buff_size_pkts);
+    EXPECT_EQ(m_pool.used(), 2 * chunk);
+    EXPECT_EQ(m_snd_buffer->getFreeBlocks(), m_buff_size_pkts - 1);
+    EXPECT_THROW(addMessage(m_buff_size_pkts), CUDTException);
+
+    // Another buffer still gets its initial blocks, but can't grow.
+    CSndBuffer other(AF_INET, m_buff_size_pkts, m_payload_sz, 0, &m_pool);
+    EXPECT_EQ(m_pool.used(), 3 * chunk);
+    EXPECT_EQ(other.getFreeBlocks(), m_buff_size_pkts - 1);
+
+    // The memory is given back after a period of being empty.
+    ack(m_buff_size_pkts);
+    m_snd_buffer->releaseIdleStorage();
+    EXPECT_EQ(m_pool.used(), 3 * chunk);
+    m_snd_buffer->releaseIdleStorage();
+    EXPECT_EQ(m_pool.used(), 2 * chunk);
+    EXPECT_EQ(other.getFreeBlocks(), m_buff_size_pkts - 1);
+
+    // The buffer remains usable.
+    addMessage(2);
+    CPacket pkt;
+    CSndBuffer::DropRange drop;
+    for (int off = 0; off < 2; ++off)
+    {
+        ASSERT_EQ(readRexmit(off, (pkt), (drop)), m_payload_sz);
+        EXPECT_EQ(pkt.data()[0], char(CSeqNo::incseq(m_init_seqno, m_acked + off)));
+    }
+    ack(2);
+    m_snd_buffer.reset();
+    EXPECT_EQ(m_pool.used(), chunk);
+}
+
+// When the pool can't give all the blocks a batch needs,
+// nothing of it is added.
+TEST_F(CSndBufferTest, SharedPoolExhausted)
+{
+    const int64_t chunk = int64_t(m_buff_size_pkts) * m_payload_sz;
+    m_pool.setLimit(2 * chunk);
+    m_snd_buffer.reset(new CSndBuffer(AF_INET, m_buff_size_pkts, m_payload_sz, 0, &m_pool));
+
+    vector<char> msg1(m_buff_size_pkts * m_payload_sz, 'a');
+    vector<char> msg2(m_buff_size_pkts * m_payload_sz, 'b');
+    SRT_MSGVEC msgs[2];
+    msgs[0].buf   = msg1.data();
+    msgs[0].len   = int(msg1.size());
+    msgs[0].mctrl = srt_msgctrl_default;
+    msgs[1].buf   = msg2.data();
+    msgs[1].len   = int(msg2.size());
+    msgs[1].mctrl = srt_msgctrl_default;
+
+    EXPECT_FALSE(m_snd_buffer->reserve(2 * m_buff_size_pkts));
+    EXPECT_THROW(m_snd_buffer->addBuffers(msgs, 2, m_init_seqno), CUDTException);
+    EXPECT_EQ(m_snd_buffer->getCurrBufSize(), 0);
+
+    // The first message alone fits.
+    EXPECT_TRUE(m_snd_buffer->reserve(m_buff_size_pkts));
+    EXPECT_EQ(m_snd_buffer->addBuffers(msgs, 1, m_init_seqno), CSeqNo::incseq(m_init_seqno, m_buff_size_pkts));
+    EXPECT_EQ(m_snd_buffer->getCurrBufSize(), m_buff_size_pkts);
+    EXPECT_EQ(m_snd_buffer->getMsgNoAt(0), 1);
+
+    m_snd_buffer.reset();
+    EXPECT_EQ(m_pool.used(), 0);
+}
@@ -0,0 +1,587 @@
+/*
+ * SRT - Secure, Reliable, Transport
+ * Copyright (c) 2025 Haivision Systems Inc.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#include <gtest/gtest.h>
+#include "test_env.h"
+
+#include "srt.h"
+#include "common.h"
+#include "api.h"
+#include "congctl.h"
+
+#include <algorithm>
+#include <cmath>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace srt {
+// Drives the congestion control of a socket that is not connected
+// with made-up events, as the connection would with real ones.
+class TestMockCongctl
+{
+public:
+    explicit TestMockCongctl(const std::string& name)
+    {
+        m_sid = CUDT::uglobal().newSocket(&m_socket);
+        CUDT& u = core();
+        u.m_iFlowWindowSize = 8192;
+        u.m_pSndLossList = new CSndLossSet(1024); // deleted with the socket
+        m_iNextAck = u.sndSeqNo();
+        EXPECT_TRUE(u.m_CongCtl.select(name));
+        EXPECT_TRUE(u.m_CongCtl.configure(&u));
+    }
+
+    ~TestMockCongctl()
+    {
+        core().m_CongCtl.dispose();
+        srt_close(m_sid);
+    }
+
+    /// Acknowledge @a npkts more packets with the RTT measured at @a rtt_us.
+    void ack(int npkts, int rtt_us)
+    {
+        CUDT& u = core();
+        u.m_iSRTT = rtt_us;
+        u.m_bIsFirstRTTReceived = true;
+        m_iNextAck = CSeqNo::incseq(m_iNextAck, npkts);
+        u.EmitSignal(TEV_ACK, EventVariant(m_iNextAck));
+    }
+
+    /// Mark @a npkts more packets as sent.
+    void send(int npkts)
+    {
+        CUDT& u = core();
+        u.m_iSndCurrSeqNo = CSeqNo::incseq(u.m_iSndCurrSeqNo, npkts);
+    }
+
+    /// Report the loss of the packet sent @a back packets before the last one.
+    void lose(int back)
+    {
+        CUDT& u = core();
+        const int32_t seqno = CSeqNo::decseq(u.sndSeqNo(), back);
+        u.EmitSignal(TEV_LOSSREPORT, EventVariant(&seqno, 1));
+    }
+
+    double cwnd() { return core().m_CongCtl->cgWindowSize(); }
+    double period() { return core().m_CongCtl->pktSndPeriod_us(); }
+
+private:
+    CUDT& core() { return m_socket->core(); }
+
+    SRTSOCKET   m_sid;
+    CUDTSocket* m_socket;
+    int32_t     m_iNextAck;
+};
+}
+
+// The base delay is the minimum RTT over the last ten one-minute
+// buckets, so an old minimum is forgotten after ten minutes.
+TEST(CongestionControl, LEDBATBaseDelay)
+{
+    using namespace srt::sync;
+    steady_clock::time_point t = steady_clock::now();
+    srt::LedbatBaseDelay base(t);
+
+    EXPECT_EQ(base.update(50000, t), 0);
+    EXPECT_EQ(base.update(40000, t + seconds_from(1)), 0);
+    EXPECT_EQ(base.update(60000, t + seconds_from(2)), 20000);
+
+    for (int i = 1; i < srt::LedbatBaseDelay::HISTORY; ++i)
+    {
+        t += seconds_from(61);
+        EXPECT_EQ(base.update(70000, t), 30000) << "bucket " << i;
+    }
+
+    // The bucket with 40 ms is reused now.
+    t += seconds_from(61);
+    EXPECT_EQ(base.update(70000, t), 0);
+    EXPECT_EQ(base.update(75000, t), 5000);
+}
+
+// Slow start ends at a quarter of the target delay. Then the window grows
+// below the target of 25 ms and shrinks above it, as in LEDBAT++, by at
+// most a half per window.
+TEST(CongestionControl, LEDBATWindow)
+{
+    srt::TestInit srtinit;
+    srt::TestMockCongctl cc("ledbat");
+
+    const int base = 20000;
+    const double initial = cc.cwnd();
+    cc.ack(4, base);
+    EXPECT_DOUBLE_EQ(cc.cwnd(), initial + 4);
+
+    // Still below TARGET/4: the window grows by what was acknowledged.
+    cc.ack(4, base + 6000);
+    EXPECT_DOUBLE_EQ(cc.cwnd(), initial + 8);
+
+    // Above TARGET/4 the window grows for the last time in slow start.
+    cc.ack(4, base + 7000);
+    double cwnd = initial + 12;
+    EXPECT_DOUBLE_EQ(cc.cwnd(), cwnd);
+
+    // Below the target, the window grows in proportion to the distance from it.
+    cc.ack(10, base + 10000);
+    cwnd += (25000 - 10000) / 25000.0 * 10 / cwnd;
+    EXPECT_DOUBLE_EQ(cc.cwnd(), cwnd);
+    // The period of the congestion avoidance: RTT over 1.25 windows.
+    EXPECT_NEAR(cc.period(), (base + 10000 + 10000) / (1.25 * cwnd), 0.001);
+
+    // Above the target, the window shrinks.
+    const double before = cwnd;
+    cc.ack(10, base + 40000);
+    const double off_target = (25000 - 40000) / 25000.0;
+    cwnd += std::max(1 + off_target * cwnd, -cwnd / 2) * 10 / cwnd;
+    EXPECT_DOUBLE_EQ(cc.cwnd(), cwnd);
+    EXPECT_LT(cwnd, before);
+
+    // Far above the target, a whole window acknowledged halves it.
+    const int acked = int(cwnd);
+    cc.ack(acked, base + 200000);
+    cwnd -= cwnd / 2 * acked / cwnd;
+    EXPECT_DOUBLE_EQ(cc.cwnd(), cwnd);
+
+    // And it grows again when the queue is gone.
+    cc.ack(10, base);
+    EXPECT_GT(cc.cwnd(), cwnd);
+}
+
+// After a reduction the window follows W_cubic(t) = C*(t-K)^3 + W_max:
+// it is back at W_max after K seconds and then probes beyond it, by no
+// more than half of the window per round trip.
+TEST(CongestionControl, CUBICWindowGrowth)
+{
+    using namespace srt::sync;
+    typedef srt::CubicWindow CubicWindow;
+    const steady_clock::time_point t0 = steady_clock::now();
+    const double rtt = 0.1;
+    CubicWindow w(8192);
+
+    // Slow start: the window grows by what was acknowledged.
+    EXPECT_TRUE(w.slowStart());
+    w.onAck(84, rtt, t0);
+    EXPECT_DOUBLE_EQ(w.cwnd(), 100);
+
+    // A congestion event cuts the window to beta * W_max and ends slow start.
+    w.reduce();
+    EXPECT_DOUBLE_EQ(w.cwnd(), 100 * CubicWindow::beta());
+    EXPECT_DOUBLE_EQ(w.ssthresh(), w.cwnd());
+    EXPECT_DOUBLE_EQ(w.wmax(), 100);
+    EXPECT_FALSE(w.slowStart());
+
+    // The epoch starts with the first ACK after the reduction.
+    const double K = std::pow((100 - w.cwnd()) / CubicWindow::cubeC(), 1.0 / 3);
+    w.onAck(1, rtt, t0);
+
+    // A window acknowledged at K brings it to W_cubic(K + RTT), close to W_max.
+    w.onAck(int(w.cwnd()), rtt, t0 + microseconds_from(int64_t(K * 1000000)));
+    EXPECT_NEAR(w.cwnd(), 100 + CubicWindow::cubeC() * rtt * rtt * rtt, 0.05);
+
+    // Past K the window grows convexly above W_max.
+    const double t = K + 2;
+    w.onAck(int(w.cwnd()), rtt, t0 + microseconds_from(int64_t(t * 1000000)));
+    EXPECT_NEAR(w.cwnd(), 100 + CubicWindow::cubeC() * std::pow(t + rtt - K, 3), 0.05);
+
+    // Far past K the target is limited to 1.5 times the window.
+    const double before = w.cwnd();
+    w.onAck(int(before), rtt, t0 + seconds_from(60));
+    EXPECT_NEAR(w.cwnd(), 1.5 * before, 0.5);
+}
+
+// While W_cubic(t) grows slower than Reno would with the same average
+// rate, the window follows the Reno estimate instead.
+TEST(CongestionControl, CUBICRenoFriendly)
+{
+    using namespace srt::sync;
+    typedef srt::CubicWindow CubicWindow;
+    const steady_clock::time_point t0 = steady_clock::now();
+    CubicWindow w(8192);
+
+    w.onAck(84, 0.1, t0);
+    w.reduce();
+
+    // All at the start of the epoch, where W_cubic(0) is the reduced window.
+    double west = w.cwnd();
+    const double alpha = 3 * (1 - CubicWindow::beta()) / (1 + CubicWindow::beta());
+    for (int i = 0; i < 10; ++i)
+    {
+        const int acked = 70;
+        west += alpha * acked / west;
+        w.onAck(acked, 0.1, t0);
+        EXPECT_DOUBLE_EQ(w.cwnd(), west) << "window " << i;
+    }
+    EXPECT_GT(w.cwnd(), 75);
+}
+
+// A flow that loses again before its window gets back to W_max
+// gives up more: W_max is set below the window at the loss.
+TEST(CongestionControl, CUBICFastConvergence)
+{
+    typedef srt::CubicWindow CubicWindow;
+    CubicWindow w(8192);
+    const double beta = CubicWindow::beta();
+
+    w.onAck(84, 0.1, srt::sync::steady_clock::now());
+    w.reduce();
+    EXPECT_DOUBLE_EQ(w.wmax(), 100);
+
+    w.reduce();
+    EXPECT_DOUBLE_EQ(w.cwnd(), 100 * beta * beta);
+    EXPECT_DOUBLE_EQ(w.wmax(), 100 * beta * (1 + beta) / 2);
+
+    // The window never goes below the minimum.
+    for (int i = 0; i < 20; ++i)
+        w.reduce();
+    EXPECT_DOUBLE_EQ(w.cwnd(), double(CubicWindow::MIN_CWND_PKTS));
+}
+
+// Only the first loss among the packets sent after the last reduction cuts
+// the window; the later losses of the earlier packets are the same event.
+TEST(CongestionControl, CUBICLossEvent)
+{
+    srt::TestInit srtinit;
+    srt::TestMockCongctl cc("cubic");
+    const double beta = srt::CubicWindow::beta();
+
+    cc.send(100);
+    cc.ack(84, 20000);
+    EXPECT_DOUBLE_EQ(cc.cwnd(), 100);
+
+    cc.lose(10);
+    EXPECT_DOUBLE_EQ(cc.cwnd(), 100 * beta);
+
+    // Sent before the reduction.
+    cc.lose(5);
+    cc.lose(0);
+    EXPECT_DOUBLE_EQ(cc.cwnd(), 100 * beta);
+
+    // Sent after it: a new congestion event.
+    cc.send(10);
+    cc.lose(5);
+    EXPECT_DOUBLE_EQ(cc.cwnd(), 100 * beta * beta);
+}
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+// A UDP relay between the caller and the listener that drops
+// a given share of the data packets sent by the caller.
+class LossyRelay
+{
+public:
+    LossyRelay(int target_port, double loss)
+        : m_Loss(loss)
+        , m_bStop(false)
+        , m_iDropped(0)
+    {
+        m_Front = socket(AF_INET, SOCK_DGRAM, 0);
+        m_Back  = socket(AF_INET, SOCK_DGRAM, 0);
+
+        sockaddr_in sa = sockaddr_in();
+        sa.sin_family = AF_INET;
+        inet_pton(AF_INET, "127.0.0.1", &sa.sin_addr);
+        bind(m_Front, (sockaddr*)&sa, sizeof sa);
+        bind(m_Back, (sockaddr*)&sa, sizeof sa);
+
+        socklen_t len = sizeof m_FrontAddr;
+        getsockname(m_Front, (sockaddr*)&m_FrontAddr, &len);
+
+        m_Target = sa;
+        m_Target.sin_port = htons(target_port);
+
+        m_Thread = std::thread([this] { run(); });
+    }
+
+    ~LossyRelay()
+    {
+        m_bStop = true;
+        m_Thread.join();
+        close(m_Front);
+        close(m_Back);
+    }
+
+    const sockaddr_in& address() const { return m_FrontAddr; }
+    int dropped() const { return m_iDropped; }
+
+private:
+    void run()
+    {
+        std::mt19937 rnd(1);
+        std::uniform_real_distribution<double> dis(0, 1);
+        sockaddr_in client = sockaddr_in();
+        std::vector<char> buf(65536);
+        pollfd fds[2] = { { m_Front, POLLIN, 0 }, { m_Back, POLLIN, 0 } };
+
+        while (!m_bStop)
+        {
+            if (poll(fds, 2, 10) <= 0)
+                continue;
+
+            if (fds[0].revents & POLLIN)
+            {
+                socklen_t len = sizeof client;
+                const ssize_t n = recvfrom(m_Front, buf.data(), buf.size(), 0, (sockaddr*)&client, &len);
+                // Only the data packets are dropped, so that the handshake is not delayed.
+                if (n > 1000 && dis(rnd) < m_Loss)
+                    ++m_iDropped;
+                else if (n > 0)
+                    sendto(m_Back, buf.data(), n, 0, (sockaddr*)&m_Target, sizeof m_Target);
+            }
+            if (fds[1].revents & POLLIN)
+            {
+                const ssize_t n = recv(m_Back, buf.data(), buf.size(), 0);
+                if (n > 0)
+                    sendto(m_Front, buf.data(), n, 0, (sockaddr*)&client, sizeof client);
+            }
+        }
+    }
+
+    int m_Front, m_Back;
+    sockaddr_in m_FrontAddr;
+    sockaddr_in m_Target;
+    double m_Loss;
+    std::atomic<bool> m_bStop;
+    std::atomic<int> m_iDropped;
+    std::thread m_Thread;
+};
+
+// Transfer a buffer in file mode over a lossy relay with the given
+// congestion control and check that it arrives intact.
+static void TransferOverLossyLink(const std::string& congctl, double loss)
+{
+    srt::TestInit srtinit;
+
+    SRTSOCKET sock_lsn = srt_create_socket(), sock_clr = srt_create_socket();
+    MAKE_UNIQUE_SOCK(sock_lsn_u, "listener", sock_lsn);
+    MAKE_UNIQUE_SOCK(sock_clr_u, "caller", sock_clr);
+
+    const int tt = SRTT_FILE;
+    for (SRTSOCKET s : { sock_lsn, sock_clr })
+    {
+        ASSERT_NE(srt_setsockflag(s, SRTO_TRANSTYPE, &tt, sizeof tt), SRT_ERROR);
+        ASSERT_NE(srt_setsockflag(s, SRTO_CONGESTION, congctl.c_str(), int(congctl.size())), SRT_ERROR)
+            << srt_getlasterror_str();
+    }
+
+    sockaddr_in sa = sockaddr_in();
+    sa.sin_family = AF_INET;
+    ASSERT_EQ(inet_pton(AF_INET, "127.0.0.1", &sa.sin_addr), 1);
+
+    int bind_res = -1;
+    int port = 5000;
+    for (; port <= 5555; ++port)
+    {
+        sa.sin_port = htons(port);
+        bind_res = srt_bind(sock_lsn, (sockaddr*)&sa, sizeof sa);
+        if (bind_res == 0)
+            break;
+    }
+    ASSERT_EQ(bind_res, 0);
+    ASSERT_NE(srt_listen(sock_lsn, 1), SRT_ERROR);
+
+    std::vector<char> source(4 * 1024 * 1024);
+    std::mt19937 mtrd(source.size());
+    std::generate(source.begin(), source.end(), [&] { return char(mtrd()); });
+    std::vector<char> target;
+
+    LossyRelay relay(port, loss);
+
+    auto receiver = std::thread([&]
+    {
+        const SRTSOCKET acc = srt_accept(sock_lsn, nullptr, nullptr);
+        ASSERT_NE(acc, SRT_INVALID_SOCK) << srt_getlasterror_str();
+
+        char optval[16] = {};
+        int optlen = sizeof optval;
+        EXPECT_NE(srt_getsockflag(acc, SRTO_CONGESTION, optval, &optlen), SRT_ERROR);
+        EXPECT_EQ(std::string(optval, optlen), congctl);
+
+        std::vector<char> buf(1456);
+        for (;;)
+        {
+            const int n = srt_recv(acc, buf.data(), int(buf.size()));
+            if (n <= 0)
+                break;
+            target.insert(target.end(), buf.begin(), buf.begin() + n);
+        }
+        srt_close(acc);
+    });
+
+    ASSERT_NE(srt_connect(sock_clr, (sockaddr*)&relay.address(), sizeof(sockaddr_in)), SRT_ERROR)
+        << srt_getlasterror_str();
+
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t sent = 0; sent < source.size();)
+    {
+        const int st = srt_send(sock_clr, source.data() + sent, int(std::min<size_t>(1456, source.size() - sent)));
+        ASSERT_GT(st, 0) << srt_getlasterror_str();
+        sent += st;
+    }
+
+    // Wait until everything is acknowledged before closing.
+    for (;;)
+    {
+        size_t blocks = 0;
+        ASSERT_NE(srt_getsndbuffer(sock_clr, &blocks, nullptr), SRT_ERROR);
+        if (blocks == 0)
+            break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+
+    SRT_TRACEBSTATS stats;
+    ASSERT_NE(srt_bstats(sock_clr, &stats, 0), SRT_ERROR);
+    srt_close(sock_clr);
+    receiver.join();
+
+    std::cout << congctl << ": " << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()
+        << " ms, " << relay.dropped() << " packets dropped, " << stats.pktRetransTotal << " retransmitted\n";
+
+    EXPECT_GT(relay.dropped(), 0);
+    ASSERT_EQ(target.size(), source.size());
+    EXPECT_TRUE(target == source);
+}
+
+TEST(CongestionControl, FileOverLossyLink)
+{
+    TransferOverLossyLink("file", 0.02);
+}
+
+TEST(CongestionControl, BBROverLossyLink)
+{
+    TransferOverLossyLink("bbr", 0.02);
+}
+
+TEST(CongestionControl, CUBICOverLossyLink)
+{
+    // CUBIC backs off on every loss as TCP does, so it gets less loss to keep the test short.
+    TransferOverLossyLink("cubic", 0.005);
+}
+
+TEST(CongestionControl, LEDBATOverLossyLink)
+{
+    // LEDBAT halves the window on loss as TCP does.
+    TransferOverLossyLink("ledbat", 0.005);
+}
+
+// A simple AIMD controller through the C API, counting the events it gets.
+struct TestCongctl
+{
+    std::atomic<int> created { 0 }, destroyed { 0 }, acks { 0 }, losses { 0 };
+};
+
+struct TestCongctlState
+{
+    TestCongctl* counters;
+    double cwnd;
+    int srtt_us;
+};
+
+static void* TestCongctlCreate(void* opaque, const SRT_CONGCTL_INFO* info)
+{
+    TestCongctl* t = static_cast<TestCongctl*>(opaque);
+    ++t->created;
+    return new TestCongctlState { t, 16, info->srtt_us };
+}
+
+static void TestCongctlDestroy(void* state)
+{
+    TestCongctlState* s = static_cast<TestCongctlState*>(state);
+    ++s->counters->destroyed;
+    delete s;
+}
+
+static void TestCongctlOnAck(void* state, const SRT_CONGCTL_INFO* info)
+{
+    TestCongctlState* s = static_cast<TestCongctlState*>(state);
+    ++s->counters->acks;
+    s->cwnd = std::min<double>(s->cwnd + 4, info->max_cwnd);
+    s->srtt_us = info->srtt_us;
+}
+
+static void TestCongctlOnLoss(void* state, const int32_t* ranges, int nranges, const SRT_CONGCTL_INFO* info)
+{
+    TestCongctlState* s = static_cast<TestCongctlState*>(state);
+    ++s->counters->losses;
+    EXPECT_GT(nranges, 0);
+    for (int i = 0; i < nranges; ++i)
+        EXPECT_LE(srt::CSeqNo::seqcmp(ranges[2 * i], ranges[2 * i + 1]), 0);
+    EXPECT_LE(srt::CSeqNo::seqcmp(ranges[2 * nranges - 1], info->snd_seqno), 0);
+    s->cwnd = std::max(s->cwnd / 2, 4.0);
+}
+
+static double TestCongctlPeriod(void* state)
+{
+    const TestCongctlState* s = static_cast<TestCongctlState*>(state);
+    return (s->srtt_us + 10000) / s->cwnd;
+}
+
+static double TestCongctlWindow(void* state)
+{
+    return static_cast<TestCongctlState*>(state)->cwnd;
+}
+
+TEST(CongestionControl, UserDefined)
+{
+    srt::TestInit srtinit;
+
+    TestCongctl counters;
+    SRT_CONGCTL_OPS ops = SRT_CONGCTL_OPS();
+    ops.create = TestCongctlCreate;
+    ops.destroy = TestCongctlDestroy;
+    ops.on_ack = TestCongctlOnAck;
+    ops.on_loss = TestCongctlOnLoss;
+    ops.snd_period_us = TestCongctlPeriod;
+    ops.cwnd = TestCongctlWindow;
+    ops.opaque = &counters;
+
+    // Invalid registrations
+    EXPECT_EQ(srt_register_congctl(nullptr, &ops), SRT_ERROR);
+    EXPECT_EQ(srt_register_congctl("", &ops), SRT_ERROR);
+    EXPECT_EQ(srt_register_congctl("longer-than-sixteen", &ops), SRT_ERROR);
+    EXPECT_EQ(srt_register_congctl("file", &ops), SRT_ERROR);
+    EXPECT_EQ(srt_getlasterror(NULL), SRT_EINVPARAM);
+    SRT_CONGCTL_OPS nocreate = ops;
+    nocreate.create = nullptr;
+    EXPECT_EQ(srt_register_congctl("test-aimd", &nocreate), SRT_ERROR);
+
+    SRTSOCKET s = srt_create_socket();
+    const std::string name = "test-aimd";
+    EXPECT_EQ(srt_setsockflag(s, SRTO_CONGESTION, name.c_str(), int(name.size())), SRT_ERROR);
+
+    ASSERT_EQ(srt_register_congctl("test-aimd", &ops), 0);
+    EXPECT_EQ(srt_setsockflag(s, SRTO_CONGESTION, name.c_str(), int(name.size())), 0);
+    srt_close(s);
+
+    TransferOverLossyLink(name, 0.02);
+
+    // One instance on each side, both destroyed when the closed sockets are collected.
+    for (int i = 0; i < 100 && counters.destroyed < 2; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(counters.created, 2);
+    EXPECT_EQ(counters.destroyed, 2);
+    EXPECT_GT(counters.acks, 0);
+    EXPECT_GT(counters.losses, 0);
+
+    // Unregistered, it can't be selected anymore.
+    ASSERT_EQ(srt_register_congctl("test-aimd", nullptr), 0);
+    s = srt_create_socket();
+    EXPECT_EQ(srt_setsockflag(s, SRTO_CONGESTION, name.c_str(), int(name.size())), SRT_ERROR);
+    srt_close(s);
+}
+#endif
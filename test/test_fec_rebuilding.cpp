@@ -946,3 +946,130 @@ TEST_F(TestFECRebuilding, Rebuild)
 
     EXPECT_EQ(memcmp(skipped.data(), rebuilt.data(), rebuilt.size()), 0);
 }
+
+TEST(TestFEC, XorKernels)
+{
+    const vector<FECFilterBuiltin::XorKernel> kernels = FECFilterBuiltin::XorKernels();
+    ASSERT_FALSE(kernels.empty());
+    EXPECT_EQ(FECFilterBuiltin::XorPayload, kernels.back().func);
+
+    vector<char> src(SRT_LIVE_MAX_PLSIZE + 8), dst(src.size());
+    for (size_t i = 0; i < src.size(); ++i)
+    {
+        src[i] = char(rand());
+        dst[i] = char(rand());
+    }
+
+    for (size_t k = 0; k < kernels.size(); ++k)
+    {
+        // All sizes of the tails and unaligned buffers.
+        for (size_t size = 0; size <= SRT_LIVE_MAX_PLSIZE; size += (size < 100 ? 1 : 97))
+        {
+            for (size_t off = 0; off < 4; ++off)
+            {
+                vector<char> expected(dst), clip(dst);
+                for (size_t i = 0; i < size; ++i)
+                    expected[off + i] ^= src[2 * off + i];
+
+                kernels[k].func(&clip[off], &src[2 * off], size);
+                ASSERT_TRUE(clip == expected) << kernels[k].name << " size=" << size << " off=" << off;
+            }
+        }
+    }
+}
+
+// The clip function used before the XOR kernels, for comparison.
+static void XorBytesReference(char* dst, const char* src, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+        dst[i] = dst[i] ^ src[i];
+}
+
+// Benchmark, not a test. Run with --gtest_also_run_disabled_tests.
+TEST(TestFECBench, DISABLED_Clip10x10)
+{
+    const size_t plsize = 1316;
+    const int npackets = 100000;
+
+    vector<char> payload(plsize), clip(plsize);
+    for (size_t i = 0; i < plsize; ++i)
+        payload[i] = char(rand());
+
+    vector<FECFilterBuiltin::XorKernel> kernels = FECFilterBuiltin::XorKernels();
+    const FECFilterBuiltin::XorKernel bytes = { "bytes", &XorBytesReference };
+    kernels.insert(kernels.begin(), bytes);
+
+    // Every data packet is clipped into a row and a column group.
+    // The best of several rounds is taken to skip the noise.
+    for (size_t k = 0; k < kernels.size(); ++k)
+    {
+        double ns = 0;
+        for (int round = 0; round < 10; ++round)
+        {
+            const auto start = chrono::steady_clock::now();
+            for (int n = 0; n < 2 * npackets; ++n)
+                kernels[k].func(&clip[0], &payload[0], plsize);
+            const double t = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / (2 * npackets);
+            ns = round == 0 ? t : min(ns, t);
+        }
+        cout << kernels[k].name << ": " << ns << " ns per clip of " << plsize << " bytes (" << int(clip[0]) << ")\n";
+    }
+
+    // The whole filter on both sides, with the kernel selected at startup.
+    const int sockid = 54321;
+    const int32_t isn = 123456;
+    SrtFilterInitializer init = { sockid, isn - 1, isn - 1, plsize, CSrtConfig::DEF_BUFFER_SIZE };
+    vector<SrtPacket> provided;
+    FECFilterBuiltin snd(init, provided, "fec,cols:10,rows:10");
+    FECFilterBuiltin rcv(init, provided, "fec,cols:10,rows:10");
+
+    CPacket p;
+    p.allocate(SRT_LIVE_MAX_PLSIZE);
+    p.setLength(plsize);
+    memcpy(p.data(), &payload[0], plsize);
+    uint32_t* hdr = p.getHeader();
+    hdr[SRT_PH_MSGNO] = 1 | MSGNO_PACKET_BOUNDARY::wrap(PB_SOLO);
+    hdr[SRT_PH_ID] = sockid;
+
+    vector<unique_ptr<CPacket>> ctl;
+    SrtPacket fec_ctl(SRT_LIVE_MAX_PLSIZE);
+    FECFilterBuiltin::loss_seqs_t loss;
+    chrono::steady_clock::duration snd_time {}, rcv_time {};
+
+    int32_t seq = isn;
+    for (int n = 0; n < npackets; ++n)
+    {
+        hdr[SRT_PH_SEQNO] = seq;
+        hdr[SRT_PH_TIMESTAMP] = n * 10;
+
+        auto start = chrono::steady_clock::now();
+        snd.feedSource(p);
+        ctl.clear();
+        while (snd.packControlPacket(fec_ctl, seq))
+        {
+            // As in PacketFilter::packControlPacket.
+            ctl.emplace_back(new CPacket);
+            CPacket& c = *ctl.back();
+            c.allocate(SRT_LIVE_MAX_PLSIZE);
+            memcpy(c.getHeader(), fec_ctl.hdr, SRT_PH_E_SIZE * sizeof(uint32_t));
+            memcpy(c.data(), fec_ctl.buffer, fec_ctl.length);
+            c.setLength(fec_ctl.length);
+            c.set_msgflags(MSGNO_PACKET_BOUNDARY::wrap(PB_SOLO));
+            c.setMsgCryptoFlags(EncryptionKeySpec(0));
+        }
+        snd_time += chrono::steady_clock::now() - start;
+
+        start = chrono::steady_clock::now();
+        rcv.receive(p, loss);
+        for (size_t i = 0; i < ctl.size(); ++i)
+            rcv.receive(*ctl[i], loss);
+        rcv_time += chrono::steady_clock::now() - start;
+
+        seq = CSeqNo::incseq(seq);
+    }
+
+    EXPECT_TRUE(provided.empty());
+    cout << "10x10 FEC, " << plsize << " bytes, " << FECFilterBuiltin::XorKernels().back().name << ": sender "
+         << chrono::duration<double, nano>(snd_time).count() / npackets << " ns, receiver "
+         << chrono::duration<double, nano>(rcv_time).count() / npackets << " ns per packet\n";
+}
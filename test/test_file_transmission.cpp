@@ -19,7 +19,9 @@
 
 #include "srt.h"
 
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <thread>
 #include <fstream>
 #include <ctime>
@@ -222,3 +224,150 @@ TEST(Transmission, FileUpload)
     remove("file.target");
 
 }
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+
+// Transfer file.source into file.target with either the path based
+// (fstream) file functions or the file descriptor based ones. The sender
+// asks for @a sendsize bytes if given, otherwise for the whole file.
+static void TransferFile(bool use_fd, int64_t filesize, std::chrono::steady_clock::duration& w_duration,
+        int64_t sendsize = 0)
+{
+    SRTSOCKET sock_lsn = srt_create_socket(), sock_clr = srt_create_socket();
+    MAKE_UNIQUE_SOCK(sock_lsn_u, "listener", sock_lsn);
+    MAKE_UNIQUE_SOCK(sock_clr_u, "caller", sock_clr);
+
+    const int tt = SRTT_FILE;
+    srt_setsockflag(sock_lsn, SRTO_TRANSTYPE, &tt, sizeof tt);
+    srt_setsockflag(sock_clr, SRTO_TRANSTYPE, &tt, sizeof tt);
+
+    sockaddr_in sa = sockaddr_in();
+    sa.sin_family = AF_INET;
+    ASSERT_EQ(inet_pton(AF_INET, "127.0.0.1", &sa.sin_addr), 1);
+
+    int bind_res = -1;
+    for (int port = 5000; port <= 5555; ++port)
+    {
+        sa.sin_port = htons(port);
+        bind_res = srt_bind(sock_lsn, (sockaddr*)&sa, sizeof sa);
+        if (bind_res == 0)
+            break;
+    }
+    ASSERT_EQ(bind_res, 0);
+    ASSERT_NE(srt_listen(sock_lsn, 1), SRT_ERROR);
+
+    auto receiver = std::thread([&]
+    {
+        const SRTSOCKET acc = srt_accept(sock_lsn, nullptr, nullptr);
+        ASSERT_NE(acc, SRT_INVALID_SOCK) << srt_getlasterror_str();
+
+        int64_t offset = 0;
+        if (use_fd)
+        {
+            const int fd = open("file.target", O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            ASSERT_GE(fd, 0);
+            EXPECT_EQ(srt_recvfile_fd(acc, fd, &offset, filesize, SRT_DEFAULT_RECVFILE_BLOCK), filesize) << srt_getlasterror_str();
+            close(fd);
+        }
+        else
+        {
+            EXPECT_EQ(srt_recvfile(acc, "file.target", &offset, filesize, SRT_DEFAULT_RECVFILE_BLOCK), filesize) << srt_getlasterror_str();
+        }
+        EXPECT_EQ(offset, filesize);
+        srt_close(acc);
+    });
+
+    ASSERT_NE(srt_connect(sock_clr, (sockaddr*)&sa, sizeof sa), SRT_ERROR) << srt_getlasterror_str();
+
+    const auto start = std::chrono::steady_clock::now();
+    int64_t offset = 0;
+    if (use_fd)
+    {
+        const int fd = open("file.source", O_RDONLY);
+        EXPECT_GE(fd, 0);
+        // Size -1: up to the end of the file.
+        EXPECT_EQ(srt_sendfile_fd(sock_clr, fd, &offset, sendsize ? sendsize : -1, SRT_DEFAULT_SENDFILE_BLOCK), filesize) << srt_getlasterror_str();
+        close(fd);
+    }
+    else
+    {
+        EXPECT_EQ(srt_sendfile(sock_clr, "file.source", &offset, sendsize ? sendsize : filesize, SRT_DEFAULT_SENDFILE_BLOCK), filesize) << srt_getlasterror_str();
+    }
+    EXPECT_EQ(offset, filesize);
+
+    receiver.join();
+    w_duration = std::chrono::steady_clock::now() - start;
+}
+
+TEST(Transmission, FileDescriptor)
+{
+    srt::TestInit srtinit;
+
+    const int64_t filesize = 24 * 1024 * 1024 + 123;
+    {
+        std::ofstream outfile("file.source", std::ios::out | std::ios::binary);
+        ASSERT_TRUE(!!outfile);
+
+        std::mt19937 mtrd(filesize);
+        std::vector<char> block(1024 * 1024);
+        for (int64_t written = 0; written < filesize; written += int64_t(block.size()))
+        {
+            for (size_t i = 0; i < block.size(); ++i)
+                block[i] = char(mtrd());
+            outfile.write(block.data(), std::min<int64_t>(filesize - written, int64_t(block.size())));
+        }
+    }
+
+    std::chrono::steady_clock::duration tstream, tfd;
+    TransferFile(false, filesize, (tstream));
+    TransferFile(true, filesize, (tfd));
+
+    // For information only; both depend on the machine and its load.
+    using namespace std::chrono;
+    std::cout << "fstream path: " << duration_cast<milliseconds>(tstream).count() << " ms, fd path: "
+        << duration_cast<milliseconds>(tfd).count() << " ms for " << filesize << " bytes\n";
+
+    std::ifstream srcfile("file.source", std::ios::in | std::ios::binary);
+    std::ifstream tarfile("file.target", std::ios::in | std::ios::binary);
+    std::vector<char> srcbuf(64 * 1024), tarbuf(64 * 1024);
+    int64_t compared = 0;
+    while (srcfile && tarfile)
+    {
+        srcfile.read(srcbuf.data(), srcbuf.size());
+        tarfile.read(tarbuf.data(), tarbuf.size());
+        ASSERT_EQ(srcfile.gcount(), tarfile.gcount());
+        ASSERT_TRUE(std::equal(srcbuf.begin(), srcbuf.begin() + srcfile.gcount(), tarbuf.begin()));
+        compared += srcfile.gcount();
+    }
+    EXPECT_EQ(compared, filesize);
+
+    remove("file.source");
+    remove("file.target");
+}
+// Asking for more than the file has sends the file up to its end
+// and reports the size actually sent, not a reading failure.
+TEST(Transmission, FileSizeOverEnd)
+{
+    srt::TestInit srtinit;
+
+    const int64_t filesize = 1024 * 1024 + 123;
+    {
+        std::ofstream outfile("file.source", std::ios::out | std::ios::binary);
+        ASSERT_TRUE(!!outfile);
+        std::vector<char> block(filesize);
+        std::mt19937 mtrd(filesize);
+        for (size_t i = 0; i < block.size(); ++i)
+            block[i] = char(mtrd());
+        outfile.write(block.data(), filesize);
+    }
+
+    std::chrono::steady_clock::duration tstream, tfd;
+    TransferFile(false, filesize, (tstream), filesize + 5000);
+    TransferFile(true, filesize, (tfd), filesize + 5000);
+
+    remove("file.source");
+    remove("file.target");
+}
+#endif
@@ -0,0 +1,189 @@
+#include <chrono>
+#include <future>
+#include <thread>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_env.h"
+#include "idtable.h"
+
+using namespace std;
+using namespace srt;
+
+namespace
+{
+struct Item
+{
+    int id;
+    explicit Item(int i) : id(i) {}
+};
+}
+
+TEST(CIdTable, InsertFindErase)
+{
+    CIdTable<Item> table;
+    vector<Item> items;
+    for (int i = 0; i < 1000; ++i)
+        items.push_back(Item(1000000 - i));
+
+    for (size_t i = 0; i < items.size(); ++i)
+        table.insert(items[i].id, &items[i]);
+    EXPECT_EQ(table.size(), items.size());
+
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        Item* found = table.find(items[i].id);
+        ASSERT_NE(found, nullptr);
+        EXPECT_EQ(found->id, items[i].id);
+    }
+    EXPECT_EQ(table.find(5), nullptr);
+
+    // Erase every second item; the remaining ones must still be found
+    // through the tombstones left in the probe sequences.
+    for (size_t i = 0; i < items.size(); i += 2)
+        EXPECT_TRUE(table.erase(items[i].id));
+    EXPECT_FALSE(table.erase(items[0].id));
+    EXPECT_EQ(table.size(), items.size() / 2);
+
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        Item* found = table.find(items[i].id);
+        if (i % 2)
+            EXPECT_EQ(found, &items[i]);
+        else
+            EXPECT_EQ(found, nullptr);
+    }
+
+    table.clear();
+    EXPECT_EQ(table.size(), 0u);
+    EXPECT_EQ(table.find(items[1].id), nullptr);
+}
+
+// Many insert/erase cycles with a small number of live entries must
+// not grow the table nor lose entries due to accumulated tombstones.
+TEST(CIdTable, Churn)
+{
+    CIdTable<Item> table;
+    vector<Item> items;
+    for (int i = 0; i < 20000; ++i)
+        items.push_back(Item(i + 1));
+
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        table.insert(items[i].id, &items[i]);
+        if (i >= 10)
+            table.erase(items[i - 10].id);
+    }
+
+    EXPECT_EQ(table.size(), 10u);
+    for (size_t i = items.size() - 10; i < items.size(); ++i)
+        EXPECT_EQ(table.find(items[i].id), &items[i]);
+}
+
+// Readers run concurrently with a writer that keeps inserting and
+// erasing; every entry that is never erased must always be found.
+TEST(CIdTable, ConcurrentReaders)
+{
+    CIdTable<Item> table;
+    vector<Item> stable, volatile_items;
+    for (int i = 0; i < 100; ++i)
+        stable.push_back(Item(i + 1));
+    for (int i = 0; i < 5000; ++i)
+        volatile_items.push_back(Item(1000 + i));
+
+    for (size_t i = 0; i < stable.size(); ++i)
+        table.insert(stable[i].id, &stable[i]);
+
+    srt::sync::atomic<bool> done(false);
+    srt::sync::atomic<int> misses(0);
+
+    vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t)
+    {
+        readers.push_back(std::thread([&]() {
+            while (!done)
+            {
+                for (size_t i = 0; i < stable.size(); ++i)
+                {
+                    CIdTable<Item>::ReadGuard rg(table);
+                    if (table.find(stable[i].id) != &stable[i])
+                        ++misses;
+                }
+            }
+        }));
+    }
+
+    for (size_t i = 0; i < volatile_items.size(); ++i)
+    {
+        table.insert(volatile_items[i].id, &volatile_items[i]);
+        if (i % 3 == 0)
+            table.erase(volatile_items[i].id);
+    }
+    table.synchronize();
+
+    done = true;
+    for (size_t t = 0; t < readers.size(); ++t)
+        readers[t].join();
+
+    EXPECT_EQ(misses.load(), 0);
+}
+
+
+static srt::sync::atomic<bool> s_bHoldEntering(false);
+static srt::sync::atomic<bool> s_bEntering(false);
+
+namespace
+{
+// Lets the test stop a reader after it has read the epoch
+// and before it has registered in it.
+struct HoldEntering
+{
+    static void entering()
+    {
+        if (!s_bHoldEntering)
+            return;
+        s_bEntering = true;
+        while (s_bHoldEntering)
+            std::this_thread::yield();
+    }
+};
+}
+
+// A reader that was entering the critical section while synchronize()
+// flipped the epoch must still be waited for by the next synchronize().
+TEST(CIdTable, SynchronizeAgainstEnteringReader)
+{
+    typedef CIdTable<Item, HoldEntering> Table;
+    Table table;
+    Item item(1);
+    table.insert(item.id, &item);
+
+    srt::sync::atomic<bool> found(false), release(false);
+
+    s_bHoldEntering = true;
+    std::thread reader([&]() {
+        Table::ReadGuard rg(table);
+        found = table.find(item.id) == &item;
+        while (!release)
+            std::this_thread::yield();
+    });
+
+    // Flip the epoch while the reader is between reading
+    // the epoch and registering in it.
+    while (!s_bEntering)
+        std::this_thread::yield();
+    table.synchronize();
+    s_bHoldEntering = false;
+
+    while (!found)
+        std::this_thread::yield();
+
+    // The reader holds the item, so it must not be considered
+    // unused after it is removed from the table.
+    table.erase(item.id);
+    std::future<void> sync = std::async(std::launch::async, [&]() { table.synchronize(); });
+    EXPECT_EQ(sync.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+
+    release = true;
+    reader.join();
+    EXPECT_EQ(sync.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+}
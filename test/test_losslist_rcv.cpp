@@ -1,19 +1,39 @@
+#include <chrono>
+#include <deque>
 #include <iostream>
+#include <iterator>
+#include <random>
+#include <set>
 #include "gtest/gtest.h"
 #include "test_env.h"
 #include "common.h"
+#include "packet.h"
 #include "list.h"
 
 using namespace std;
 using namespace srt;
 
+template <class LossList>
+static LossList* CreateLossList(int size)
+{
+    return new LossList(size);
+}
+
+template <>
+CRcvLossRanges* CreateLossList<CRcvLossRanges>(int)
+{
+    return new CRcvLossRanges();
+}
+
+// The tests are run for both implementations of the receiver loss list.
+template <class LossList>
 class CRcvLossListTest
     : public ::testing::Test
 {
 protected:
     void SetUp() override
     {
-        m_lossList = new CRcvLossList(CRcvLossListTest::SIZE);
+        m_lossList = CreateLossList<LossList>(CRcvLossListTest::SIZE);
     }
 
     void TearDown() override
@@ -27,22 +47,31 @@ protected:
         EXPECT_EQ(m_lossList->getFirstLostSeq(), SRT_SEQNO_NONE);
     }
 
-    void CleanUpList()
+    void CheckLossArray(const vector<int32_t>& expected, int limit = 64)
     {
-        //while (m_lossList->popLostSeq() != -1);
+        vector<int32_t> array(limit + 1, SRT_SEQNO_NONE);
+        int len = -1;
+        m_lossList->getLossArray(array.data(), (len), limit);
+        array.resize(len < 0 ? 0 : len);
+        EXPECT_EQ(array, expected);
     }
 
-    CRcvLossList* m_lossList;
+    LossList* m_lossList;
 
 public:
     const int SIZE = 256;
 };
 
+typedef ::testing::Types<CRcvLossList, CRcvLossRanges> RcvLossListTypes;
+TYPED_TEST_SUITE(CRcvLossListTest, RcvLossListTypes);
+
+static const int32_t F = LOSSDATA_SEQNO_RANGE_FIRST;
+
 /// Check the state of the freshly created list.
 /// Capacity, loss length and pop().
-TEST_F(CRcvLossListTest, Create)
+TYPED_TEST(CRcvLossListTest, Create)
 {
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -52,25 +81,170 @@ TEST_F(CRcvLossListTest, Create)
 ///////////////////////////////////////////////////////////////////////////////
 
 /// Insert and remove one element from the list.
-TEST_F(CRcvLossListTest, InsertRemoveOneElem)
+TYPED_TEST(CRcvLossListTest, InsertRemoveOneElem)
 {
-    EXPECT_EQ(m_lossList->insert(1, 1), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 1), 1);
 
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_TRUE(m_lossList->remove(1, 1));
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_TRUE(this->m_lossList->remove(1, 1));
+    this->CheckEmptyArray();
 }
 
 
 /// Insert and pop one element from the list.
-TEST_F(CRcvLossListTest, InsertTwoElemsEdge)
+TYPED_TEST(CRcvLossListTest, InsertTwoElemsEdge)
+{
+    EXPECT_EQ(this->m_lossList->insert(CSeqNo::m_iMaxSeqNo, 1), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
+    EXPECT_TRUE(this->m_lossList->remove(CSeqNo::m_iMaxSeqNo, 1));
+    this->CheckEmptyArray();
+}
+
+/// Remove losses from the front, the back and the middle of the ranges
+/// and check the encoded loss report after each change.
+TYPED_TEST(CRcvLossListTest, RemoveAndReport)
 {
-    EXPECT_EQ(m_lossList->insert(CSeqNo::m_iMaxSeqNo, 1), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
-    EXPECT_TRUE(m_lossList->remove(CSeqNo::m_iMaxSeqNo, 1));
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->insert(10, 12), 3);
+    EXPECT_EQ(this->m_lossList->insert(15, 15), 1);
+    EXPECT_EQ(this->m_lossList->insert(20, 25), 6);
+    this->CheckLossArray({10 | F, 12, 15, 20 | F, 25});
+    // The report is cut at the last range that fits, oldest first.
+    this->CheckLossArray({10 | F, 12}, 2);
+    this->CheckLossArray({10 | F, 12, 15}, 4);
+
+    EXPECT_TRUE(this->m_lossList->remove(15));
+    EXPECT_FALSE(this->m_lossList->remove(15));
+    this->CheckLossArray({10 | F, 12, 20 | F, 25});
+
+    EXPECT_TRUE(this->m_lossList->remove(10));
+    this->CheckLossArray({11 | F, 12, 20 | F, 25});
+    EXPECT_TRUE(this->m_lossList->remove(11));
+    this->CheckLossArray({12, 20 | F, 25});
+    EXPECT_EQ(this->m_lossList->getFirstLostSeq(), 12);
+
+    EXPECT_TRUE(this->m_lossList->remove(23));
+    this->CheckLossArray({12, 20 | F, 22, 24 | F, 25});
+    EXPECT_TRUE(this->m_lossList->remove(25));
+    this->CheckLossArray({12, 20 | F, 22, 24});
+    EXPECT_EQ(this->m_lossList->getLossLength(), 5);
+
+    EXPECT_TRUE(this->m_lossList->find(13, 20));
+    EXPECT_TRUE(this->m_lossList->find(24, 30));
+    EXPECT_FALSE(this->m_lossList->find(13, 19));
+    EXPECT_FALSE(this->m_lossList->find(23, 23));
+    EXPECT_FALSE(this->m_lossList->find(25, 30));
+
+    EXPECT_EQ(this->m_lossList->removeUpTo(21), 12);
+    this->CheckLossArray({22, 24});
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+
+    // Losses up to the largest sequence seen so far are cut off.
+    EXPECT_EQ(this->m_lossList->insert(23, 25), 0);
+    EXPECT_EQ(this->m_lossList->insert(23, 27), 2);
+    this->CheckLossArray({22, 24, 26 | F, 27});
+
+    EXPECT_EQ(this->m_lossList->removeUpTo(30), 22);
+    this->CheckEmptyArray();
+    this->CheckLossArray({});
+}
+
+/// The received ranges (for selective ACK) are the gaps between the losses.
+TEST(CRcvLossRangesTest, ReceivedRanges)
+{
+    CRcvLossRanges losslist;
+    losslist.insert(10, 12);
+    losslist.insert(15, 15);
+    losslist.insert(20, 25);
+
+    int32_t ranges[6];
+    EXPECT_EQ(losslist.getReceivedRanges(30, ranges, 3), 3);
+    EXPECT_EQ(vector<int32_t>(ranges, ranges + 6), vector<int32_t>({13, 14, 16, 19, 26, 30}));
+
+    EXPECT_EQ(losslist.getReceivedRanges(30, ranges, 1), 1);
+    EXPECT_EQ(vector<int32_t>(ranges, ranges + 2), vector<int32_t>({13, 14}));
+
+    // Nothing received after the last loss.
+    EXPECT_EQ(losslist.getReceivedRanges(25, ranges, 3), 2);
+
+    CRcvLossRanges empty;
+    EXPECT_EQ(empty.getReceivedRanges(30, ranges, 3), 0);
 }
 
+/// Check the incrementally maintained loss report against a simple model
+/// under random loss, recovery and drops, including the sequence number wrap.
+TEST(CRcvLossRangesTest, RandomAgainstModel)
+{
+    srt::TestInit srtinit;
+    CRcvLossRanges losslist;
+    set<int> lost; // offsets from base
+    mt19937 rnd(7);
+    uniform_int_distribution<int> percent(0, 99);
+
+    const int32_t base = CSeqNo::decseq(0, 3000);
+    int next = 0; // offset of the next packet to arrive
+    for (int step = 0; step < 20000; ++step)
+    {
+        const int action = percent(rnd);
+        if (action < 50)
+        {
+            // New packet, possibly after a gap of lost ones.
+            const int gap = percent(rnd) < 60 ? 0 : 1 + percent(rnd) % 4;
+            if (gap)
+            {
+                losslist.insert(CSeqNo::incseq(base, next), CSeqNo::incseq(base, next + gap - 1));
+                for (int i = 0; i < gap; ++i)
+                    lost.insert(next + i);
+            }
+            next += gap + 1;
+        }
+        else if (action < 85 && !lost.empty())
+        {
+            // Recovered, mostly the oldest losses.
+            set<int>::iterator i = lost.begin();
+            if (percent(rnd) < 40)
+                advance(i, percent(rnd) % lost.size());
+            EXPECT_TRUE(losslist.remove(CSeqNo::incseq(base, *i)));
+            lost.erase(i);
+        }
+        else if (action < 88 && !lost.empty())
+        {
+            // Dropped up to some loss.
+            const int upto = min(*lost.begin() + percent(rnd) % 20, next - 1);
+            losslist.removeUpTo(CSeqNo::incseq(base, upto));
+            lost.erase(lost.begin(), lost.upper_bound(upto));
+        }
+        else
+        {
+            const int limit = 2 + percent(rnd) % 40;
+            vector<int32_t> expected;
+            for (set<int>::iterator i = lost.begin(); i != lost.end();)
+            {
+                set<int>::iterator last = i;
+                for (set<int>::iterator n = std::next(i); n != lost.end() && *n == *last + 1; ++n)
+                    last = n;
+                const int w = (*i == *last) ? 1 : 2;
+                if (int(expected.size()) + w > limit)
+                    break;
+                if (w == 1)
+                {
+                    expected.push_back(CSeqNo::incseq(base, *i));
+                }
+                else
+                {
+                    expected.push_back(CSeqNo::incseq(base, *i) | F);
+                    expected.push_back(CSeqNo::incseq(base, *last));
+                }
+                i = ++last;
+            }
+
+            int len = 0;
+            const int32_t* report = losslist.getLossReport((len), limit);
+            ASSERT_EQ(vector<int32_t>(report, report + len), expected) << "step " << step;
+        }
+
+        ASSERT_EQ(losslist.getLossLength(), int(lost.size()));
+    }
+}
 TEST(CRcvFreshLossListTest, CheckFreshLossList)
 {
     srt::TestInit srtinit;
@@ -137,3 +311,61 @@ TEST(CRcvFreshLossListTest, CheckFreshLossList)
     EXPECT_EQ(floss.size(), 4u);
 
 }
+
+// Simulates a receiver over a window with random loss. The losses are
+// recovered about one window later, and a NAK report is taken every
+// 64 packets while the losses are outstanding.
+template <class LossList>
+static double BenchRandomLoss(int loss_percent, int packets)
+{
+    LossList* losslist = CreateLossList<LossList>(16384);
+    std::mt19937 rnd(loss_percent);
+    std::uniform_int_distribution<int> percent(0, 99);
+    std::vector<int32_t> report(366);
+    std::deque<int32_t> pending;
+
+    const auto start = std::chrono::steady_clock::now();
+    int32_t gap_start = SRT_SEQNO_NONE;
+    for (int32_t seq = 0; seq < packets; ++seq)
+    {
+        if (percent(rnd) < loss_percent)
+        {
+            if (gap_start == SRT_SEQNO_NONE)
+                gap_start = seq;
+            pending.push_back(seq);
+        }
+        else if (gap_start != SRT_SEQNO_NONE)
+        {
+            losslist->insert(gap_start, seq - 1);
+            gap_start = SRT_SEQNO_NONE;
+        }
+
+        while (!pending.empty() && pending.front() < seq - 4096)
+        {
+            losslist->remove(pending.front());
+            pending.pop_front();
+        }
+
+        if (seq % 64 == 0)
+        {
+            int len = 0;
+            losslist->getLossArray(report.data(), (len), int(report.size()));
+        }
+    }
+    const double us = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+    delete losslist;
+    return us / packets;
+}
+
+// Benchmark, not a test. Run with --gtest_also_run_disabled_tests.
+TEST(CRcvLossListBench, DISABLED_RandomLoss)
+{
+    const int loss_rates[] = {10, 30};
+    for (int loss_percent : loss_rates)
+    {
+        const double tlist   = BenchRandomLoss<CRcvLossList>(loss_percent, 1000000);
+        const double tranges = BenchRandomLoss<CRcvLossRanges>(loss_percent, 1000000);
+        cout << loss_percent << "% loss: CRcvLossList " << tlist * 1000 << " ns, CRcvLossRanges " << tranges * 1000
+             << " ns per packet (NAK report every 64 packets)\n";
+    }
+}
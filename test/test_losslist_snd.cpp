@@ -1,4 +1,6 @@
+#include <chrono>
 #include <iostream>
+#include <random>
 #include "gtest/gtest.h"
 #include "common.h"
 #include "list.h"
@@ -6,13 +8,15 @@
 using namespace std;
 using namespace srt;
 
+// The tests are run for both implementations of the sender loss list.
+template <class LossList>
 class CSndLossListTest
     : public ::testing::Test
 {
 protected:
     void SetUp() override
     {
-        m_lossList = new CSndLossList(CSndLossListTest::SIZE);
+        m_lossList = new LossList(CSndLossListTest::SIZE);
     }
 
     void TearDown() override
@@ -31,17 +35,20 @@ protected:
         while (m_lossList->popLostSeq() != SRT_SEQNO_NONE);
     }
 
-    CSndLossList* m_lossList;
+    LossList* m_lossList;
 
 public:
     const int SIZE = 256;
 };
 
+typedef ::testing::Types<CSndLossList, CSndLossSet> SndLossListTypes;
+TYPED_TEST_SUITE(CSndLossListTest, SndLossListTypes);
+
 /// Check the state of the freshly created list.
 /// Capacity, loss length and pop().
-TEST_F(CSndLossListTest, Create)
+TYPED_TEST(CSndLossListTest, Create)
 {
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -51,113 +58,113 @@ TEST_F(CSndLossListTest, Create)
 ///////////////////////////////////////////////////////////////////////////////
 
 /// Insert and pop one element from the list.
-TEST_F(CSndLossListTest, InsertPopOneElem)
+TYPED_TEST(CSndLossListTest, InsertPopOneElem)
 {
-    EXPECT_EQ(m_lossList->insert(1, 1), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 1), 1);
 
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertNegativeSeqno)
+TYPED_TEST(CSndLossListTest, InsertNegativeSeqno)
 {
     cerr << "Expecting IPE message:" << endl;
-    EXPECT_EQ(m_lossList->insert(1, SRT_SEQNO_NONE), 0);
-    EXPECT_EQ(m_lossList->insert(SRT_SEQNO_NONE, SRT_SEQNO_NONE), 0);
-    EXPECT_EQ(m_lossList->insert(SRT_SEQNO_NONE, 1), 0);
+    EXPECT_EQ(this->m_lossList->insert(1, SRT_SEQNO_NONE), 0);
+    EXPECT_EQ(this->m_lossList->insert(SRT_SEQNO_NONE, SRT_SEQNO_NONE), 0);
+    EXPECT_EQ(this->m_lossList->insert(SRT_SEQNO_NONE, 1), 0);
     
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
 /// Insert two elements at once and pop one by one
-TEST_F(CSndLossListTest, InsertPopTwoElemsRange)
+TYPED_TEST(CSndLossListTest, InsertPopTwoElemsRange)
 {
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
 
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 2);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 2);
+    this->CheckEmptyArray();
 }
 
 /// Insert 1 and 4 and pop() one by one
-TEST_F(CSndLossListTest, InsertPopTwoElems)
+TYPED_TEST(CSndLossListTest, InsertPopTwoElems)
 {
-    EXPECT_EQ(m_lossList->insert(1, 1), 1);
-    EXPECT_EQ(m_lossList->insert(4, 4), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 1), 1);
+    EXPECT_EQ(this->m_lossList->insert(4, 4), 1);
 
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 4);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 4);
+    this->CheckEmptyArray();
 }
 
 /// Insert 1 and 2 and pop() one by one
-TEST_F(CSndLossListTest, InsertPopTwoSerialElems)
+TYPED_TEST(CSndLossListTest, InsertPopTwoSerialElems)
 {
-    EXPECT_EQ(m_lossList->insert(1, 1), 1);
-    EXPECT_EQ(m_lossList->insert(2, 2), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 1), 1);
+    EXPECT_EQ(this->m_lossList->insert(2, 2), 1);
 
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 2);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 2);
+    this->CheckEmptyArray();
 }
 
 /// Insert (1,2) and 4, then pop one by one
-TEST_F(CSndLossListTest, InsertPopRangeAndSingle)
+TYPED_TEST(CSndLossListTest, InsertPopRangeAndSingle)
 {
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 4), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 4), 1);
 
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 4);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 4);
+    this->CheckEmptyArray();
 }
 
 /// Insert 1, 4, 2, 0, then pop
-TEST_F(CSndLossListTest, InsertPopFourElems)
+TYPED_TEST(CSndLossListTest, InsertPopFourElems)
 {
-    EXPECT_EQ(m_lossList->insert(1, 1), 1);
-    EXPECT_EQ(m_lossList->insert(4, 4), 1);
-    EXPECT_EQ(m_lossList->insert(0, 0), 1);
-    EXPECT_EQ(m_lossList->insert(2, 2), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 1), 1);
+    EXPECT_EQ(this->m_lossList->insert(4, 4), 1);
+    EXPECT_EQ(this->m_lossList->insert(0, 0), 1);
+    EXPECT_EQ(this->m_lossList->insert(2, 2), 1);
 
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    EXPECT_EQ(m_lossList->popLostSeq(), 0);
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 4);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 0);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 4);
+    this->CheckEmptyArray();
 }
 
 /// Insert (1,2) and 4, then pop one by one
-TEST_F(CSndLossListTest, InsertCoalesce)
+TYPED_TEST(CSndLossListTest, InsertCoalesce)
 {
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 4), 1);
-    EXPECT_EQ(m_lossList->insert(3, 3), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 4), 1);
+    EXPECT_EQ(this->m_lossList->insert(3, 3), 1);
 
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
-    EXPECT_EQ(m_lossList->popLostSeq(), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 4);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 4);
+    this->CheckEmptyArray();
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -169,467 +176,562 @@ TEST_F(CSndLossListTest, InsertCoalesce)
 ///
 ///
 ///
-TEST_F(CSndLossListTest, BasicRemoveInListNodeHead01)
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNodeHead01)
 {
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 4), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 4), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
     // Remove up to element 4
-    m_lossList->removeUpTo(4);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNodeHead02)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 5), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    m_lossList->removeUpTo(4);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 5);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNodeHead03)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 4), 1);
-    EXPECT_EQ(m_lossList->insert(8, 8), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    m_lossList->removeUpTo(4);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 8);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNodeHead04)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 6), 3);
-    EXPECT_EQ(m_lossList->insert(8, 8), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 6);
-    m_lossList->removeUpTo(4);
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
-    EXPECT_EQ(m_lossList->popLostSeq(), 5);
-    EXPECT_EQ(m_lossList->popLostSeq(), 6);
-    EXPECT_EQ(m_lossList->popLostSeq(), 8);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead01)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 5), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead02)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 5), 2);
-    EXPECT_EQ(m_lossList->insert(8, 8), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 5);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 8);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead03)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 8), 5);
-    EXPECT_EQ(m_lossList->getLossLength(), 7);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
-    EXPECT_EQ(m_lossList->popLostSeq(), 6);
-    EXPECT_EQ(m_lossList->popLostSeq(), 7);
-    EXPECT_EQ(m_lossList->popLostSeq(), 8);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead04)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 8), 5);
-    EXPECT_EQ(m_lossList->insert(10, 12), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 10);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 6);
-    EXPECT_EQ(m_lossList->popLostSeq(), 6);
-    EXPECT_EQ(m_lossList->popLostSeq(), 7);
-    EXPECT_EQ(m_lossList->popLostSeq(), 8);
-    EXPECT_EQ(m_lossList->popLostSeq(), 10);
-    EXPECT_EQ(m_lossList->popLostSeq(), 11);
-    EXPECT_EQ(m_lossList->popLostSeq(), 12);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead05)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 8), 5);
-    EXPECT_EQ(m_lossList->insert(10, 12), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 10);
-    m_lossList->removeUpTo(9);
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
-    EXPECT_EQ(m_lossList->popLostSeq(), 10);
-    EXPECT_EQ(m_lossList->popLostSeq(), 11);
-    EXPECT_EQ(m_lossList->popLostSeq(), 12);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead06)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 8), 5);
-    EXPECT_EQ(m_lossList->insert(10, 12), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 10);
-    m_lossList->removeUpTo(50);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead07)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(4, 8), 5);
-    EXPECT_EQ(m_lossList->insert(10, 12), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 10);
-    m_lossList->removeUpTo(-50);
-    EXPECT_EQ(m_lossList->getLossLength(), 10);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 4);
-    EXPECT_EQ(m_lossList->popLostSeq(), 5);
-    EXPECT_EQ(m_lossList->popLostSeq(), 6);
-    EXPECT_EQ(m_lossList->popLostSeq(), 7);
-    EXPECT_EQ(m_lossList->popLostSeq(), 8);
-    EXPECT_EQ(m_lossList->popLostSeq(), 10);
-    EXPECT_EQ(m_lossList->popLostSeq(), 11);
-    EXPECT_EQ(m_lossList->popLostSeq(), 12);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead08)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(5, 6), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    m_lossList->removeUpTo(6);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead09)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(5, 6), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    m_lossList->removeUpTo(6);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead10)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(5, 6), 2);
-    EXPECT_EQ(m_lossList->insert(10, 10), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 5);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    m_lossList->removeUpTo(7);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 10);
-    CheckEmptyArray();
-}
-
-TEST_F(CSndLossListTest, BasicRemoveInListNotInNodeHead11)
-{
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(5, 6), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    m_lossList->removeUpTo(7);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    CheckEmptyArray();
+    this->m_lossList->removeUpTo(4);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNodeHead02)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 5), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    this->m_lossList->removeUpTo(4);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNodeHead03)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 4), 1);
+    EXPECT_EQ(this->m_lossList->insert(8, 8), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    this->m_lossList->removeUpTo(4);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 8);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNodeHead04)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 6), 3);
+    EXPECT_EQ(this->m_lossList->insert(8, 8), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 6);
+    this->m_lossList->removeUpTo(4);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 5);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 6);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 8);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead01)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 5), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead02)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 5), 2);
+    EXPECT_EQ(this->m_lossList->insert(8, 8), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 5);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 8);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead03)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 8), 5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 7);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 6);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 7);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 8);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead04)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 8), 5);
+    EXPECT_EQ(this->m_lossList->insert(10, 12), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 10);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 6);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 6);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 7);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 8);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 10);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 11);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 12);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead05)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 8), 5);
+    EXPECT_EQ(this->m_lossList->insert(10, 12), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 10);
+    this->m_lossList->removeUpTo(9);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 10);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 11);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 12);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead06)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 8), 5);
+    EXPECT_EQ(this->m_lossList->insert(10, 12), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 10);
+    this->m_lossList->removeUpTo(50);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead07)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(4, 8), 5);
+    EXPECT_EQ(this->m_lossList->insert(10, 12), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 10);
+    this->m_lossList->removeUpTo(-50);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 10);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 4);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 5);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 6);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 7);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 8);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 10);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 11);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 12);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead08)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(5, 6), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    this->m_lossList->removeUpTo(6);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead09)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(5, 6), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    this->m_lossList->removeUpTo(6);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead10)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(5, 6), 2);
+    EXPECT_EQ(this->m_lossList->insert(10, 10), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 5);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    this->m_lossList->removeUpTo(7);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 10);
+    this->CheckEmptyArray();
+}
+
+TYPED_TEST(CSndLossListTest, BasicRemoveInListNotInNodeHead11)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(5, 6), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    this->m_lossList->removeUpTo(7);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    this->CheckEmptyArray();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
-TEST_F(CSndLossListTest, InsertRemoveInsert01)
+TYPED_TEST(CSndLossListTest, InsertRemoveInsert01)
 {
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->insert(5, 6), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    m_lossList->removeUpTo(5);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    m_lossList->removeUpTo(6);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->insert(5, 6), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    this->m_lossList->removeUpTo(5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    this->m_lossList->removeUpTo(6);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    this->CheckEmptyArray();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
-TEST_F(CSndLossListTest, InsertHead01)
+TYPED_TEST(CSndLossListTest, InsertHead01)
 {
-    EXPECT_EQ(m_lossList->insert(1, 2), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 2);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->insert(1, 2), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 2);
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertHead02)
+TYPED_TEST(CSndLossListTest, InsertHead02)
 {
-    EXPECT_EQ(m_lossList->insert(1, 1), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->insert(1, 1), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertHeadIncrease01)
+TYPED_TEST(CSndLossListTest, InsertHeadIncrease01)
 {
-    EXPECT_EQ(m_lossList->insert(1, 1), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->insert(2, 2), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 2);
-    CheckEmptyArray();
+    EXPECT_EQ(this->m_lossList->insert(1, 1), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->insert(2, 2), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 2);
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertHeadOverlap01)
+TYPED_TEST(CSndLossListTest, InsertHeadOverlap01)
 {
-    EXPECT_EQ(m_lossList->insert(1, 5), 5);
-    EXPECT_EQ(m_lossList->getLossLength(), 5);
-    EXPECT_EQ(m_lossList->insert(6, 8), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 8);
-    EXPECT_EQ(m_lossList->insert(2, 10), 2);
-    EXPECT_EQ(m_lossList->getLossLength(), 10);
+    EXPECT_EQ(this->m_lossList->insert(1, 5), 5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 5);
+    EXPECT_EQ(this->m_lossList->insert(6, 8), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 8);
+    EXPECT_EQ(this->m_lossList->insert(2, 10), 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 10);
     for (int i = 1; i < 11; i++)
     {
-        EXPECT_EQ(m_lossList->popLostSeq(), i);
-        EXPECT_EQ(m_lossList->getLossLength(), 10 - i);
+        EXPECT_EQ(this->m_lossList->popLostSeq(), i);
+        EXPECT_EQ(this->m_lossList->getLossLength(), 10 - i);
     }
 
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertHeadOverlap02)
+TYPED_TEST(CSndLossListTest, InsertHeadOverlap02)
 {
-    EXPECT_EQ(m_lossList->insert(1, 5), 5);
-    EXPECT_EQ(m_lossList->getLossLength(), 5);
-    EXPECT_EQ(m_lossList->insert(6, 8), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 8);
-    EXPECT_EQ(m_lossList->insert(2, 7), 0);
-    EXPECT_EQ(m_lossList->getLossLength(), 8);
-    EXPECT_EQ(m_lossList->insert(5, 5), 0);
-    EXPECT_EQ(m_lossList->getLossLength(), 8);
+    EXPECT_EQ(this->m_lossList->insert(1, 5), 5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 5);
+    EXPECT_EQ(this->m_lossList->insert(6, 8), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 8);
+    EXPECT_EQ(this->m_lossList->insert(2, 7), 0);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 8);
+    EXPECT_EQ(this->m_lossList->insert(5, 5), 0);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 8);
 
     for (int i = 1; i < 9; i++)
     {
-        EXPECT_EQ(m_lossList->popLostSeq(), i);
-        EXPECT_EQ(m_lossList->getLossLength(), 8 - i);
+        EXPECT_EQ(this->m_lossList->popLostSeq(), i);
+        EXPECT_EQ(this->m_lossList->getLossLength(), 8 - i);
     }
 
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertHeadNegativeOffset01)
+TYPED_TEST(CSndLossListTest, InsertHeadNegativeOffset01)
 {
-    EXPECT_EQ(m_lossList->insert(10000000, 10000000), 1);
-    EXPECT_EQ(m_lossList->insert(10000001, 10000001), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->insert(10000000, 10000000), 1);
+    EXPECT_EQ(this->m_lossList->insert(10000001, 10000001), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
 
     // The offset of the sequence number being added does not fit
     // into the size of the loss list, it must be ignored.
     // Normally this situation should not happen.
     cerr << "Expecting IPE message:" << endl;
-    EXPECT_EQ(m_lossList->insert(1, 1), 0);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 10000000);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 10000001);
+    EXPECT_EQ(this->m_lossList->insert(1, 1), 0);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 10000000);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 10000001);
 
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
 // Check the part of the loss report the can fit into the list
 // goes into the list.
-TEST_F(CSndLossListTest, InsertHeadNegativeOffset02)
+TYPED_TEST(CSndLossListTest, InsertHeadNegativeOffset02)
 {
     const int32_t head_seqno = 10000000;
-    EXPECT_EQ(m_lossList->insert(head_seqno,     head_seqno), 1);
-    EXPECT_EQ(m_lossList->insert(head_seqno + 1, head_seqno + 1), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->insert(head_seqno,     head_seqno), 1);
+    EXPECT_EQ(this->m_lossList->insert(head_seqno + 1, head_seqno + 1), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
 
     // The offset of the sequence number being added does not fit
     // into the size of the loss list, it must be ignored.
     // Normally this situation should not happen.
 
-    const int32_t outofbound_seqno = head_seqno - CSndLossListTest::SIZE;
-    EXPECT_EQ(m_lossList->insert(outofbound_seqno - 1, outofbound_seqno + 1), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 5);
-    EXPECT_EQ(m_lossList->popLostSeq(), outofbound_seqno - 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 4);
-    EXPECT_EQ(m_lossList->popLostSeq(), outofbound_seqno);
-    EXPECT_EQ(m_lossList->getLossLength(), 3);
-    EXPECT_EQ(m_lossList->popLostSeq(), outofbound_seqno + 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 10000000);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
-    EXPECT_EQ(m_lossList->popLostSeq(), 10000001);
+    const int32_t outofbound_seqno = head_seqno - this->SIZE;
+    EXPECT_EQ(this->m_lossList->insert(outofbound_seqno - 1, outofbound_seqno + 1), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 5);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), outofbound_seqno - 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 4);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), outofbound_seqno);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 3);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), outofbound_seqno + 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 10000000);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 10000001);
 
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
-TEST_F(CSndLossListTest, InsertFullListCoalesce)
+TYPED_TEST(CSndLossListTest, InsertFullListCoalesce)
 {
-    for (int i = 1; i <= CSndLossListTest::SIZE; i++)
-        EXPECT_EQ(m_lossList->insert(i, i), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), CSndLossListTest::SIZE);
+    for (int i = 1; i <= this->SIZE; i++)
+        EXPECT_EQ(this->m_lossList->insert(i, i), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), this->SIZE);
     // Inserting additional element: 1 item more than list size.
     // Given all elements coalesce into one entry, there is a place to insert it,
     // but sequence span now exceeds list size.
-    EXPECT_EQ(m_lossList->insert(CSndLossListTest::SIZE + 1, CSndLossListTest::SIZE + 1), 0);
-    EXPECT_EQ(m_lossList->getLossLength(), CSndLossListTest::SIZE);
-    for (int i = 1; i <= CSndLossListTest::SIZE; i++)
+    EXPECT_EQ(this->m_lossList->insert(this->SIZE + 1, this->SIZE + 1), 0);
+    EXPECT_EQ(this->m_lossList->getLossLength(), this->SIZE);
+    for (int i = 1; i <= this->SIZE; i++)
     {
-        EXPECT_EQ(m_lossList->popLostSeq(), i);
-        EXPECT_EQ(m_lossList->getLossLength(), CSndLossListTest::SIZE - i);
+        EXPECT_EQ(this->m_lossList->popLostSeq(), i);
+        EXPECT_EQ(this->m_lossList->getLossLength(), this->SIZE - i);
     }
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
 
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertFullListNoCoalesce)
+TYPED_TEST(CSndLossListTest, InsertFullListNoCoalesce)
 {
     // We will insert each element with a gap of one elements.
     // This should lead to having space for only [i; SIZE] sequence numbers.
-    for (int i = 1; i <= CSndLossListTest::SIZE / 2; i++)
-        EXPECT_EQ(m_lossList->insert(2 * i, 2 * i), 1);
+    for (int i = 1; i <= this->SIZE / 2; i++)
+        EXPECT_EQ(this->m_lossList->insert(2 * i, 2 * i), 1);
 
     // At this point the list has every second element empty
     // [0]:taken, [1]: empty, [2]: taken, [3]: empty, ...
-    EXPECT_EQ(m_lossList->getLossLength(), CSndLossListTest::SIZE / 2);
+    EXPECT_EQ(this->m_lossList->getLossLength(), this->SIZE / 2);
 
     // Inserting additional element out of the list span must fail.
-    const int seqno1 = CSndLossListTest::SIZE + 2;
-    EXPECT_EQ(m_lossList->insert(seqno1, seqno1), 0);
+    const int seqno1 = this->SIZE + 2;
+    EXPECT_EQ(this->m_lossList->insert(seqno1, seqno1), 0);
 
     // There should however be a place for one element right after the last inserted one.
-    const int seqno_last = CSndLossListTest::SIZE + 1;
-    EXPECT_EQ(m_lossList->insert(seqno_last, seqno_last), 1);
+    const int seqno_last = this->SIZE + 1;
+    EXPECT_EQ(this->m_lossList->insert(seqno_last, seqno_last), 1);
 
-    const int initial_length = m_lossList->getLossLength();
-    EXPECT_EQ(initial_length, CSndLossListTest::SIZE / 2 + 1);
-    for (int i = 1; i <= CSndLossListTest::SIZE / 2; i++)
+    const int initial_length = this->m_lossList->getLossLength();
+    EXPECT_EQ(initial_length, this->SIZE / 2 + 1);
+    for (int i = 1; i <= this->SIZE / 2; i++)
     {
-        EXPECT_EQ(m_lossList->popLostSeq(), 2 * i);
-        EXPECT_EQ(m_lossList->getLossLength(), initial_length - i);
+        EXPECT_EQ(this->m_lossList->popLostSeq(), 2 * i);
+        EXPECT_EQ(this->m_lossList->getLossLength(), initial_length - i);
     }
-    EXPECT_EQ(m_lossList->popLostSeq(), seqno_last);
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), seqno_last);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
 
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertFullListNegativeOffset)
+TYPED_TEST(CSndLossListTest, InsertFullListNegativeOffset)
 {
-    for (int i = 10000000; i < 10000000 + CSndLossListTest::SIZE; i++)
-        m_lossList->insert(i, i);
-    EXPECT_EQ(m_lossList->getLossLength(), CSndLossListTest::SIZE);
-    m_lossList->insert(1, CSndLossListTest::SIZE + 1);
-    EXPECT_EQ(m_lossList->getLossLength(), CSndLossListTest::SIZE);
-    for (int i = 10000000; i < 10000000 + CSndLossListTest::SIZE; i++)
+    for (int i = 10000000; i < 10000000 + this->SIZE; i++)
+        this->m_lossList->insert(i, i);
+    EXPECT_EQ(this->m_lossList->getLossLength(), this->SIZE);
+    this->m_lossList->insert(1, this->SIZE + 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), this->SIZE);
+    for (int i = 10000000; i < 10000000 + this->SIZE; i++)
     {
-        EXPECT_EQ(m_lossList->popLostSeq(), i);
-        EXPECT_EQ(m_lossList->getLossLength(), CSndLossListTest::SIZE - (i - 10000000 + 1));
+        EXPECT_EQ(this->m_lossList->popLostSeq(), i);
+        EXPECT_EQ(this->m_lossList->getLossLength(), this->SIZE - (i - 10000000 + 1));
     }
-    EXPECT_EQ(m_lossList->popLostSeq(), -1);
-    EXPECT_EQ(m_lossList->getLossLength(), 0);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), -1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 0);
 
-    CheckEmptyArray();
+    this->CheckEmptyArray();
 }
 
-TEST_F(CSndLossListTest, InsertPositiveOffsetTooFar)
+TYPED_TEST(CSndLossListTest, InsertPositiveOffsetTooFar)
 {
     const int32_t head_seqno = 1000;
-    EXPECT_EQ(m_lossList->insert(head_seqno, head_seqno), 1);
-    EXPECT_EQ(m_lossList->getLossLength(), 1);
+    EXPECT_EQ(this->m_lossList->insert(head_seqno, head_seqno), 1);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 1);
 
     // The offset of the sequence number being added does not fit
     // into the size of the loss list, it must be ignored.
     // Normally this situation should not happen.
 
-    const int32_t outofbound_seqno = head_seqno + CSndLossListTest::SIZE;
-    m_lossList->insert(outofbound_seqno, outofbound_seqno);
+    const int32_t outofbound_seqno = head_seqno + this->SIZE;
+    this->m_lossList->insert(outofbound_seqno, outofbound_seqno);
 
-    const int32_t outofbound_seqno2 = head_seqno + 2 * CSndLossListTest::SIZE;
-    m_lossList->insert(outofbound_seqno2, outofbound_seqno2);
+    const int32_t outofbound_seqno2 = head_seqno + 2 * this->SIZE;
+    this->m_lossList->insert(outofbound_seqno2, outofbound_seqno2);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
-TEST_F(CSndLossListTest, InsertNoUpdateElement01)
+TYPED_TEST(CSndLossListTest, InsertNoUpdateElement01)
+{
+    EXPECT_EQ(this->m_lossList->insert(0, 1), 2);
+    EXPECT_EQ(this->m_lossList->insert(3, 5), 3);
+    this->m_lossList->removeUpTo(3); // Remove all to seq no 3
+    EXPECT_EQ(this->m_lossList->insert(4, 5), 0); // Element not updated
+    EXPECT_EQ(this->m_lossList->getLossLength(), 2);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 4);
+    EXPECT_EQ(this->m_lossList->popLostSeq(), 5);
+}
+
+TYPED_TEST(CSndLossListTest, InsertNoUpdateElement03)
 {
-    EXPECT_EQ(m_lossList->insert(0, 1), 2);
-    EXPECT_EQ(m_lossList->insert(3, 5), 3);
-    m_lossList->removeUpTo(3); // Remove all to seq no 3
-    EXPECT_EQ(m_lossList->insert(4, 5), 0); // Element not updated
-    EXPECT_EQ(m_lossList->getLossLength(), 2);
-    EXPECT_EQ(m_lossList->popLostSeq(), 4);
-    EXPECT_EQ(m_lossList->popLostSeq(), 5);
+    EXPECT_EQ(this->m_lossList->insert(1, 5), 5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 5);
+    EXPECT_EQ(this->m_lossList->insert(6, 8), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 8);
+    EXPECT_EQ(this->m_lossList->insert(2, 5), 0);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 8);
 }
 
-TEST_F(CSndLossListTest, InsertNoUpdateElement03)
+/// Remove ranges reported as received (selective ACK), including the head.
+TEST(CSndLossSetTest, RemoveRange)
 {
-    EXPECT_EQ(m_lossList->insert(1, 5), 5);
-    EXPECT_EQ(m_lossList->getLossLength(), 5);
-    EXPECT_EQ(m_lossList->insert(6, 8), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 8);
-    EXPECT_EQ(m_lossList->insert(2, 5), 0);
-    EXPECT_EQ(m_lossList->getLossLength(), 8);
+    CSndLossSet losslist(256);
+    EXPECT_EQ(losslist.insert(10, 20), 11);
+    EXPECT_EQ(losslist.insert(30, 40), 11);
+
+    EXPECT_EQ(losslist.remove(15, 32), 9);
+    EXPECT_EQ(losslist.getLossLength(), 13);
+    EXPECT_EQ(losslist.remove(21, 29), 0);
+    EXPECT_EQ(losslist.remove(5, 12), 3);
+    EXPECT_EQ(losslist.getLossLength(), 10);
+
+    EXPECT_EQ(losslist.popLostSeq(), 13);
+    EXPECT_EQ(losslist.popLostSeq(), 14);
+    EXPECT_EQ(losslist.popLostSeq(), 33);
+
+    EXPECT_EQ(losslist.remove(34, 50), 7);
+    EXPECT_EQ(losslist.getLossLength(), 0);
+    EXPECT_EQ(losslist.popLostSeq(), SRT_SEQNO_NONE);
+
+    // The list is usable again after it was emptied by remove().
+    EXPECT_EQ(losslist.insert(100, 101), 2);
+    EXPECT_EQ(losslist.popLostSeq(), 100);
+}
+
+/// Walk the losses without removing them, also across the sequence wrap.
+TEST(CSndLossSetTest, GetNextLostSeq)
+{
+    CSndLossSet losslist(256);
+    EXPECT_EQ(losslist.getNextLostSeq(10), SRT_SEQNO_NONE);
+
+    const int32_t first = CSeqNo::decseq(0, 3);
+    EXPECT_EQ(losslist.insert(first, first), 1);
+    EXPECT_EQ(losslist.insert(1, 2), 2);
+    EXPECT_EQ(losslist.insert(40, 40), 1);
+
+    EXPECT_EQ(losslist.getNextLostSeq(CSeqNo::decseq(first)), first);
+    EXPECT_EQ(losslist.getNextLostSeq(first), 1);
+    EXPECT_EQ(losslist.getNextLostSeq(1), 2);
+    EXPECT_EQ(losslist.getNextLostSeq(2), 40);
+    EXPECT_EQ(losslist.getNextLostSeq(20), 40);
+    EXPECT_EQ(losslist.getNextLostSeq(40), SRT_SEQNO_NONE);
+
+    // Removing from the middle keeps the walk.
+    EXPECT_EQ(losslist.remove(1, 1), 1);
+    EXPECT_EQ(losslist.getNextLostSeq(first), 2);
+    EXPECT_EQ(losslist.getLossLength(), 3);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////
-TEST_F(CSndLossListTest, InsertUpdateElement01)
-{
-    EXPECT_EQ(m_lossList->insert(1, 5), 5);
-    EXPECT_EQ(m_lossList->getLossLength(), 5);
-    EXPECT_EQ(m_lossList->insert(1, 8), 3);
-    EXPECT_EQ(m_lossList->getLossLength(), 8);
-    EXPECT_EQ(m_lossList->insert(2, 5), 0);
-    EXPECT_EQ(m_lossList->getLossLength(), 8);
+TYPED_TEST(CSndLossListTest, InsertUpdateElement01)
+{
+    EXPECT_EQ(this->m_lossList->insert(1, 5), 5);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 5);
+    EXPECT_EQ(this->m_lossList->insert(1, 8), 3);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 8);
+    EXPECT_EQ(this->m_lossList->insert(2, 5), 0);
+    EXPECT_EQ(this->m_lossList->getLossLength(), 8);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////
+
+// Loss reports scattered over a large flight window: every report
+// brings a few short ranges in random order, and the losses are
+// retransmitted (popped) while new reports arrive.
+template <class LossList>
+static double BenchScatteredLoss(int window, int rounds)
+{
+    LossList losslist(window * 2);
+    std::mt19937 rnd(window);
+    std::uniform_int_distribution<int> offset_dist(0, window - 1);
+    std::uniform_int_distribution<int> len_dist(0, 3);
+
+    const auto start = std::chrono::steady_clock::now();
+    int32_t base = 1000;
+    for (int r = 0; r < rounds; ++r)
+    {
+        for (int i = 0; i < 64; ++i)
+        {
+            const int32_t lo = CSeqNo::incseq(base, offset_dist(rnd));
+            losslist.insert(lo, CSeqNo::incseq(lo, len_dist(rnd)));
+        }
+        for (int i = 0; i < 32; ++i)
+            losslist.popLostSeq();
+
+        // The window slides with the ACKs.
+        base = CSeqNo::incseq(base, 16);
+        losslist.removeUpTo(CSeqNo::decseq(base));
+    }
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count() / rounds;
+}
+
+// Benchmark, not a test. Run with --gtest_also_run_disabled_tests.
+TEST(CSndLossListBench, DISABLED_ScatteredLoss)
+{
+    for (int window = 1024; window <= 65536; window *= 4)
+    {
+        const double tlist = BenchScatteredLoss<CSndLossList>(window, 2000);
+        const double tset  = BenchScatteredLoss<CSndLossSet>(window, 2000);
+        cout << "window " << window << ": CSndLossList " << tlist << " us, CSndLossSet " << tset
+             << " us per round (64 inserts, 32 pops, 1 removeUpTo)\n";
+    }
 }
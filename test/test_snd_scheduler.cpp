@@ -0,0 +1,121 @@
+#include <algorithm>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_env.h"
+#include "api.h"
+#include "queue.h"
+
+using namespace srt;
+using namespace std;
+
+// Checks the order in which CSndUList gives the sockets that are all
+// due for sending, as when the sending thread can't keep up with them.
+class TestSndScheduler
+    : public srt::Test
+{
+protected:
+    void setup() override
+    {
+        m_timer.reset(new sync::CTimer);
+        m_list.reset(new CSndUList(m_timer.get()));
+    }
+
+    void teardown() override
+    {
+        for (size_t i = 0; i < m_sockets.size(); ++i)
+        {
+            m_list->remove(m_sockets[i]);
+            srt_close(m_sockets[i]->socketID());
+        }
+    }
+
+    // Creates a socket to be scheduled; it must be bound to have the list node.
+    void addSocket(int weight)
+    {
+        CUDTSocket* s = NULL;
+        const SRTSOCKET sid = CUDT::uglobal().newSocket(&s);
+        ASSERT_NE(sid, SRT_INVALID_SOCK);
+        ASSERT_NE(srt_setsockflag(sid, SRTO_SNDWEIGHT, &weight, sizeof weight), SRT_ERROR);
+
+        sockaddr_in sa = sockaddr_in();
+        sa.sin_family = AF_INET;
+        sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        ASSERT_NE(srt_bind(sid, (sockaddr*)&sa, sizeof sa), SRT_ERROR);
+
+        m_parents.push_back(s);
+        m_sockets.push_back(&s->core());
+    }
+
+    // Takes the given number of packets from the list, with all sockets
+    // staying due, and returns how many each socket has sent.
+    vector<int> run(int packets, const vector<int>& pkt_sizes)
+    {
+        const sync::steady_clock::time_point due = sync::steady_clock::now();
+        for (size_t i = 0; i < m_sockets.size(); ++i)
+            m_list->update(m_sockets[i], CSndUList::DO_RESCHEDULE, due);
+
+        vector<int> sent(m_sockets.size(), 0);
+        for (int n = 0; n < packets; ++n)
+        {
+            CUDT* u = m_list->pop();
+            EXPECT_NE(u, nullptr);
+            if (!u)
+                break;
+
+            const size_t i = find(m_sockets.begin(), m_sockets.end(), u) - m_sockets.begin();
+            ++sent[i];
+            if (m_list->scheduler() == SRT_SCHED_DRR)
+                m_list->charge(u, pkt_sizes[i]);
+            m_list->update(u, CSndUList::DO_RESCHEDULE, due);
+            m_parents[i]->apiRelease(); // acquired by pop()
+        }
+        return sent;
+    }
+
+    unique_ptr<sync::CTimer> m_timer;
+    unique_ptr<CSndUList>    m_list;
+    vector<CUDTSocket*>      m_parents;
+    vector<CUDT*>            m_sockets;
+};
+
+TEST_F(TestSndScheduler, DeficitRoundRobin)
+{
+    m_list->setScheduler(SRT_SCHED_DRR);
+    addSocket(1);
+    addSocket(3);
+    addSocket(2);
+
+    const vector<int> sent = run(600, vector<int>(3, 1360));
+    EXPECT_NEAR(sent[0], 100, 2);
+    EXPECT_NEAR(sent[1], 300, 2);
+    EXPECT_NEAR(sent[2], 200, 2);
+}
+
+TEST_F(TestSndScheduler, DeficitSmallPackets)
+{
+    // The quantum is counted in bytes, so smaller packets
+    // are sent in greater numbers in one turn.
+    m_list->setScheduler(SRT_SCHED_DRR);
+    addSocket(1);
+    addSocket(1);
+
+    vector<int> sizes;
+    sizes.push_back(680);
+    sizes.push_back(1360);
+
+    const vector<int> sent = run(600, sizes);
+    EXPECT_NEAR(sent[0], 400, 4);
+    EXPECT_NEAR(sent[1], 200, 4);
+}
+
+TEST_F(TestSndScheduler, TimeOrder)
+{
+    // Without DRR the sockets with the same sending time
+    // are served regardless of the weights.
+    addSocket(1);
+    addSocket(3);
+
+    const vector<int> sent = run(400, vector<int>(2, 1360));
+    EXPECT_EQ(sent[0], 200);
+    EXPECT_EQ(sent[1], 200);
+}
@@ -0,0 +1,151 @@
+#include <vector>
+#include "gtest/gtest.h"
+#include "buffer_tools.h"
+#include "sync.h"
+
+using namespace srt;
+using namespace std;
+
+// Simulates the sending thread of a multiplexer in virtual time,
+// checking the shaper for every packet of the sockets.
+class CSndShaperSim
+{
+public:
+    struct Socket
+    {
+        Socket(int64_t minbw, int weight, int64_t demand)
+            : leaf(MSS)
+            , minbw_Bps(minbw)
+            , weight(weight)
+            , demand_Bps(demand)
+            , sent(0)
+        {
+        }
+
+        CSndShaper::Leaf leaf;
+        int64_t minbw_Bps;
+        int weight;
+        int64_t demand_Bps; // 0 if always having data to send
+        sync::steady_clock::time_point next;
+        int64_t sent;
+    };
+
+    static const int MSS = 1500;
+    static const int PKT_SIZE = 1360;
+    static const int64_t RATE_Bps = 1250000; // 10 Mbps
+
+    CSndShaperSim()
+        : m_shaper(MSS)
+    {
+        m_shaper.setRate(RATE_Bps);
+    }
+
+    void add(int64_t minbw, int weight, int64_t demand = 0)
+    {
+        m_sockets.push_back(Socket(minbw, weight, demand));
+    }
+
+    // Runs the simulation and returns the rates measured after the warm-up.
+    vector<double> run(int warmup_ms = 1000, int measure_ms = 2000)
+    {
+        const sync::steady_clock::time_point start = sync::steady_clock::now();
+        const sync::steady_clock::time_point measure_start = start + sync::milliseconds_from(warmup_ms);
+        const sync::steady_clock::time_point end = measure_start + sync::milliseconds_from(measure_ms);
+
+        for (size_t i = 0; i < m_sockets.size(); ++i)
+            m_sockets[i].next = start;
+
+        for (;;)
+        {
+            size_t k = 0;
+            for (size_t i = 1; i < m_sockets.size(); ++i)
+            {
+                if (m_sockets[i].next < m_sockets[k].next)
+                    k = i;
+            }
+
+            Socket& s = m_sockets[k];
+            const sync::steady_clock::time_point now = s.next;
+            if (now >= end)
+                break;
+
+            bool borrow = false;
+            sync::steady_clock::time_point retry;
+            if (!m_shaper.allow(s.leaf, s.minbw_Bps, s.weight, MSS, now, (borrow), (retry)))
+            {
+                EXPECT_GT(retry, now);
+                s.next = retry;
+                continue;
+            }
+
+            m_shaper.consume(s.leaf, s.weight, PKT_SIZE, borrow, now);
+            if (now >= measure_start)
+                s.sent += PKT_SIZE;
+
+            s.next = s.demand_Bps
+                ? now + sync::microseconds_from(PKT_SIZE * 1000000LL / s.demand_Bps)
+                : now + sync::microseconds_from(1);
+        }
+
+        vector<double> rates;
+        for (size_t i = 0; i < m_sockets.size(); ++i)
+            rates.push_back(double(m_sockets[i].sent) * 1000 / measure_ms);
+        return rates;
+    }
+
+private:
+    CSndShaper m_shaper;
+    vector<Socket> m_sockets;
+};
+
+TEST(CSndShaper, AggregateRate)
+{
+    CSndShaperSim sim;
+    for (int i = 0; i < 4; ++i)
+        sim.add(0, 1);
+
+    const vector<double> rates = sim.run();
+    double total = 0;
+    for (size_t i = 0; i < rates.size(); ++i)
+    {
+        EXPECT_NEAR(rates[i], CSndShaperSim::RATE_Bps / 4.0, CSndShaperSim::RATE_Bps * 0.03);
+        total += rates[i];
+    }
+    EXPECT_NEAR(total, CSndShaperSim::RATE_Bps, CSndShaperSim::RATE_Bps * 0.02);
+}
+
+TEST(CSndShaper, Weights)
+{
+    CSndShaperSim sim;
+    sim.add(0, 1);
+    sim.add(0, 3);
+
+    const vector<double> rates = sim.run();
+    EXPECT_NEAR(rates[0], CSndShaperSim::RATE_Bps * 0.25, CSndShaperSim::RATE_Bps * 0.05);
+    EXPECT_NEAR(rates[1], CSndShaperSim::RATE_Bps * 0.75, CSndShaperSim::RATE_Bps * 0.05);
+}
+
+TEST(CSndShaper, Guarantee)
+{
+    // The first socket gets its guarantee and half of the rest.
+    CSndShaperSim sim;
+    sim.add(CSndShaperSim::RATE_Bps * 6 / 10, 1);
+    sim.add(0, 1);
+
+    const vector<double> rates = sim.run();
+    EXPECT_NEAR(rates[0], CSndShaperSim::RATE_Bps * 0.8, CSndShaperSim::RATE_Bps * 0.05);
+    EXPECT_NEAR(rates[1], CSndShaperSim::RATE_Bps * 0.2, CSndShaperSim::RATE_Bps * 0.05);
+}
+
+TEST(CSndShaper, UnusedShare)
+{
+    // The share left unused by a socket with a higher weight
+    // goes to the other socket.
+    CSndShaperSim sim;
+    sim.add(0, 3, CSndShaperSim::RATE_Bps / 10);
+    sim.add(0, 1);
+
+    const vector<double> rates = sim.run();
+    EXPECT_NEAR(rates[0], CSndShaperSim::RATE_Bps * 0.1, CSndShaperSim::RATE_Bps * 0.02);
+    EXPECT_NEAR(rates[1], CSndShaperSim::RATE_Bps * 0.9, CSndShaperSim::RATE_Bps * 0.05);
+}
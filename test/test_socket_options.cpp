@@ -343,8 +343,10 @@ const OptionTestEntry g_test_matrix_options[] =
     { SRTO_MININPUTBW,       "SRTO_MININPUTBW", RestrictionType::POST, sizeof(int64_t),       int64_t(0),  INT64_MAX,  int64_t(0), int64_t(200000),  {int64_t(-1)},    R | W | G | S | D | O | O },
     { SRTO_MINVERSION,       "SRTO_MINVERSION", RestrictionType::PRE,     sizeof(int),                 0,  INT32_MAX, 0x010000,    0x010300,    {},                    R | W | G | S | D | O | O },
     { SRTO_MSS,                     "SRTO_MSS", RestrictionType::PREBIND, sizeof(int),                76,     65536,     1500,        1400,    {-1, 0, 75},            R | W | G | S | D | O | O },
+    { SRTO_MUXMAXBW,          "SRTO_MUXMAXBW", RestrictionType::PREBIND, sizeof(int64_t),     int64_t(0), INT64_MAX, int64_t(0), int64_t(12500000), {int64_t(-1)},   R | W | G | S | D | O | M },
     { SRTO_NAKREPORT,         "SRTO_NAKREPORT", RestrictionType::PRE,    sizeof(bool),             false,      true,     true,        false,     {},                   R | W | G | S | D | O | M },
     { SRTO_OHEADBW,             "SRTO_OHEADBW", RestrictionType::POST,    sizeof(int),                 5,        100,       25,          20, {-1, 0, 4, 101},          R | W | G | S | D | O | O },
+    { SRTO_PACING,               "SRTO_PACING", RestrictionType::PREBIND, sizeof(int),                 0,          1,        0,           1, {-1, 2},                   R | W | G | S | D | O | M },
     //SRTO_PACKETFILTER
     //SRTO_PASSPHRASE
     { SRTO_PAYLOADSIZE,     "SRTO_PAYLOADSIZE", RestrictionType::PRE,     sizeof(int),                 0,      1456,      1316,        1400,   {-1, 1500},             O | W | G | S | D | O | O },
@@ -359,13 +361,18 @@ const OptionTestEntry g_test_matrix_options[] =
     //SRTO_RCVSYN
     { SRTO_RCVTIMEO,           "SRTO_RCVTIMEO", RestrictionType::POST,    sizeof(int),                -1, INT32_MAX,  -1, 2000, {-2},                                  R | W | G | S | O | I | O },
     //SRTO_RENDEZVOUS
-    { SRTO_RETRANSMITALGO, "SRTO_RETRANSMITALGO", RestrictionType::PRE,   sizeof(int),                 0,         1,   1,    0, {-1, 2},                               R | W | G | S | D | O | O },
+    { SRTO_RETRANSMITALGO, "SRTO_RETRANSMITALGO", RestrictionType::PRE,   sizeof(int),                 0,         2,   1,    0, {-1, 3},                               R | W | G | S | D | O | O },
     //SRTO_REUSEADDR
+    { SRTO_SCHEDULER,        "SRTO_SCHEDULER", RestrictionType::PREBIND, sizeof(int),                 0,          1,        0,           1, {-1, 2},                   R | W | G | S | D | O | M },
     //SRTO_SENDER
     { SRTO_SNDBUF,              "SRTO_SNDBUF",  RestrictionType::PREBIND, sizeof(int), (int)(32 * SRT_PKT_SIZE), 2147483256, (int)(8192 * SRT_PKT_SIZE), 1000000, {-1},R | W | G | S | D | O | M },
     //SRTO_SNDDATA
     { SRTO_SNDDROPDELAY,  "SRTO_SNDDROPDELAY", RestrictionType::POST,     sizeof(int),                -1, INT32_MAX, 0, 1500, {-2},                                    O | W | G | S | D | O | M },
     //SRTO_SNDKMSTATE
+    { SRTO_SNDMEMLIMIT,    "SRTO_SNDMEMLIMIT", RestrictionType::PREBIND, sizeof(int64_t),     int64_t(0), INT64_MAX, int64_t(0), int64_t(10000000), {int64_t(-1)},   R | W | G | S | D | O | M },
+    { SRTO_SNDMINBW,          "SRTO_SNDMINBW", RestrictionType::PRE,     sizeof(int64_t),     int64_t(0), INT64_MAX, int64_t(0), int64_t(1250000), {int64_t(-1)},    R | W | G | S | D | O | M },
+    { SRTO_SNDWEIGHT,        "SRTO_SNDWEIGHT", RestrictionType::PRE,     sizeof(int),                 1,       100,        1,          10, {-1, 0, 101},             R | W | G | S | D | O | M },
+    { SRTO_RCVMEMLIMIT,    "SRTO_RCVMEMLIMIT", RestrictionType::PREBIND, sizeof(int64_t),     int64_t(0), INT64_MAX, int64_t(0), int64_t(10000000), {int64_t(-1)},   R | W | G | S | D | O | M },
     //SRTO_SNDSYN
     { SRTO_SNDTIMEO,          "SRTO_SNDTIMEO", RestrictionType::POST,     sizeof(int),                -1, INT32_MAX, -1, 1400, {-2},                                   R | W | G | S | O | I | O },
     //SRTO_STATE
@@ -41,3 +41,37 @@ TEST(CTimer, DISABLED_SleeptoAccuracy)
 }
 
 
+
+TEST(CTimer, PacingStats)
+{
+    using namespace std;
+    using namespace srt::sync;
+
+    const int num_samples = 200;
+    const int modes[] = { SRT_PACING_SLEEP, SRT_PACING_HYBRID };
+
+    for (int mode : modes)
+    {
+        CTimer timer;
+        timer.setPacing(mode);
+        EXPECT_EQ(timer.pacing(), mode);
+
+        for (int i = 0; i < num_samples; i++)
+        {
+            timer.sleep_until(steady_clock::now() + microseconds_from(500));
+        }
+
+        int64_t waits = 0, error_us = 0, spin_us = 0;
+        timer.getPacingStats((waits), (error_us), (spin_us));
+
+        cerr << (mode == SRT_PACING_HYBRID ? "hybrid" : "sleep") << ": avg lateness " << error_us / waits
+             << " us, avg spin " << spin_us / waits << " us\n";
+
+        EXPECT_EQ(waits, num_samples);
+        EXPECT_GE(error_us, 0);
+        if (mode == SRT_PACING_HYBRID)
+            EXPECT_GT(spin_us, 0);
+        else
+            EXPECT_EQ(spin_us, 0);
+    }
+}
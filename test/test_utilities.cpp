@@ -212,6 +212,74 @@ TEST(CircularBuffer, Overall)
     IF_HEAVY_LOGGING(cerr << "DONE.\n");
 }
 
+TEST(CircularBitmap, FindWithWrap)
+{
+    // Odd size, spanning more than one word.
+    CircularBitmap bm(130);
+    EXPECT_EQ(bm.findNext(0, 130, true), -1);
+    EXPECT_EQ(bm.findNext(0, 130, false), 0);
+    EXPECT_EQ(bm.count(0, 130), 0U);
+
+    bm.set(3);
+    bm.set(70);
+    bm.set(129);
+    EXPECT_TRUE(bm.test(70));
+    EXPECT_FALSE(bm.test(71));
+    EXPECT_EQ(bm.count(0, 130), 3U);
+
+    EXPECT_EQ(bm.findNext(0, 130, true), 3);
+    EXPECT_EQ(bm.findNext(4, 126, true), 66);
+    EXPECT_EQ(bm.findNext(71, 50, true), -1);
+    // Wrapping around the end: 129 first, then 3.
+    EXPECT_EQ(bm.findNext(100, 60, true), 29);
+    EXPECT_EQ(bm.findNext(128, 10, true), 1);
+    EXPECT_EQ(bm.findNext(0, 10, true), 3);
+    EXPECT_EQ(bm.count(120, 20), 2U);
+
+    EXPECT_EQ(bm.findPrev(69, 70, true), 66);
+    EXPECT_EQ(bm.findPrev(2, 10, true), 3);  // 2, 1, 0, 129
+    EXPECT_EQ(bm.findPrev(128, 50, true), -1);
+
+    // Search for zeros in a fully set range.
+    for (size_t i = 0; i < 130; ++i)
+        bm.set(i);
+    EXPECT_EQ(bm.findNext(10, 130, false), -1);
+    bm.clear(5);
+    EXPECT_EQ(bm.findNext(10, 130, false), 125);
+    EXPECT_EQ(bm.findPrev(10, 130, false), 5);
+    EXPECT_EQ(bm.count(0, 130), 129U);
+    bm.set(5, false);
+    bm.set(6, false);
+    EXPECT_EQ(bm.count(0, 10), 8U);
+}
+
+TEST(CircularBitmap, SetRange)
+{
+    CircularBitmap bm(200);
+
+    // Within one word and across words.
+    bm.setRange(10, 5, true);
+    EXPECT_EQ(bm.count(0, 200), 5U);
+    EXPECT_FALSE(bm.test(9));
+    EXPECT_TRUE(bm.test(14));
+    EXPECT_FALSE(bm.test(15));
+
+    bm.setRange(60, 80, true);
+    EXPECT_EQ(bm.count(60, 80), 80U);
+    EXPECT_EQ(bm.findNext(60, 100, false), 80);
+
+    // Wrapping around the end.
+    bm.setRange(190, 20, true);
+    EXPECT_TRUE(bm.test(199));
+    EXPECT_TRUE(bm.test(0));
+    EXPECT_TRUE(bm.test(9));
+    EXPECT_EQ(bm.count(0, 200), 5U + 80U + 20U);
+
+    bm.setRange(195, 100, false);
+    EXPECT_EQ(bm.count(0, 200), 5U + 45U);
+    EXPECT_EQ(bm.findNext(0, 200, true), 95);
+}
+
 TEST(ConfigString, Setting)
 {
     using namespace std;
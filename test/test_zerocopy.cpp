@@ -0,0 +1,132 @@
+#include <array>
+#include <thread>
+#include <chrono>
+#include <mutex>
+#include <vector>
+#include "gtest/gtest.h"
+#include "test_env.h"
+#include "srt.h"
+#include "netinet_any.h"
+
+using namespace std;
+
+namespace
+{
+struct Completions
+{
+    mutex lock;
+    vector<const char*> acked;
+    int others = 0;
+};
+
+void OnSendComplete(void* opaq, SRTSOCKET, const char* buf, int, int status)
+{
+    Completions* c = static_cast<Completions*>(opaq);
+    lock_guard<mutex> lk(c->lock);
+    if (status == SRT_ZC_ACKED)
+        c->acked.push_back(buf);
+    else
+        ++c->others;
+}
+}
+
+// Messages sent with srt_sendmsg_zc arrive intact and every buffer
+// is reported back exactly once when acknowledged.
+TEST(SendMsgZeroCopy, LiveTransmission)
+{
+    srt::TestInit srtinit;
+    Completions completions;
+
+    MAKE_UNIQUE_SOCK(listener, "listener", srt_create_socket());
+    MAKE_UNIQUE_SOCK(caller, "caller", srt_create_socket());
+
+    // Without the callback the zero-copy sending is rejected.
+    char dummy[10] = {};
+    EXPECT_EQ(srt_sendmsg_zc(caller, dummy, sizeof dummy, NULL), SRT_ERROR);
+
+    ASSERT_NE(srt_send_complete_callback(caller, &OnSendComplete, &completions), SRT_ERROR);
+
+    srt::sockaddr_any sa = srt::CreateAddr("127.0.0.1", 5210, AF_INET);
+    ASSERT_NE(srt_bind(listener, sa.get(), sa.size()), SRT_ERROR);
+    ASSERT_NE(srt_listen(listener, 1), SRT_ERROR);
+    ASSERT_NE(srt_connect(caller, sa.get(), sa.size()), SRT_ERROR);
+
+    MAKE_UNIQUE_SOCK(accepted, "accepted", srt_accept(listener, NULL, NULL));
+
+    // Installing the callback is not allowed on a connected socket.
+    EXPECT_EQ(srt_send_complete_callback(caller, &OnSendComplete, &completions), SRT_ERROR);
+
+    const int nmsgs = 50;
+    vector<array<char, 1316>> msgs(nmsgs);
+    for (int i = 0; i < nmsgs; ++i)
+    {
+        msgs[i].fill(char(i));
+        ASSERT_EQ(srt_sendmsg_zc(caller, msgs[i].data(), int(msgs[i].size()), NULL), int(msgs[i].size()));
+    }
+
+    array<char, 1500> rbuf;
+    for (int i = 0; i < nmsgs; ++i)
+    {
+        ASSERT_EQ(srt_recvmsg(accepted, rbuf.data(), int(rbuf.size())), 1316);
+        EXPECT_EQ(rbuf[0], char(i));
+        EXPECT_EQ(rbuf[1315], char(i));
+    }
+
+    // The ACK for the last packets comes in at most one ACK period.
+    for (int i = 0; i < 100; ++i)
+    {
+        {
+            lock_guard<mutex> lk(completions.lock);
+            if (completions.acked.size() == size_t(nmsgs))
+                break;
+        }
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+
+    lock_guard<mutex> lk(completions.lock);
+    ASSERT_EQ(completions.acked.size(), size_t(nmsgs));
+    for (int i = 0; i < nmsgs; ++i)
+        EXPECT_EQ(completions.acked[i], msgs[i].data());
+    EXPECT_EQ(completions.others, 0);
+}
+
+// Messages received with srt_recvmsg_zc are exposed in place
+// and the receiver memory is given back on release.
+TEST(RecvMsgZeroCopy, LiveTransmission)
+{
+    srt::TestInit srtinit;
+
+    MAKE_UNIQUE_SOCK(listener, "listener", srt_create_socket());
+    MAKE_UNIQUE_SOCK(caller, "caller", srt_create_socket());
+
+    srt::sockaddr_any sa = srt::CreateAddr("127.0.0.1", 5211, AF_INET);
+    ASSERT_NE(srt_bind(listener, sa.get(), sa.size()), SRT_ERROR);
+    ASSERT_NE(srt_listen(listener, 1), SRT_ERROR);
+    ASSERT_NE(srt_connect(caller, sa.get(), sa.size()), SRT_ERROR);
+
+    MAKE_UNIQUE_SOCK(accepted, "accepted", srt_accept(listener, NULL, NULL));
+
+    const int nmsgs = 50;
+    array<char, 1316> msg;
+    for (int i = 0; i < nmsgs; ++i)
+    {
+        msg.fill(char(i));
+        ASSERT_EQ(srt_sendmsg(caller, msg.data(), int(msg.size()), -1, true), int(msg.size()));
+    }
+
+    SRT_PKTVIEW views[2];
+    EXPECT_EQ(srt_recvmsg_zc(accepted, views, 0, NULL), SRT_ERROR);
+    for (int i = 0; i < nmsgs; ++i)
+    {
+        SRT_MSGCTRL mctrl = srt_msgctrl_default;
+        ASSERT_EQ(srt_recvmsg_zc(accepted, views, 2, &mctrl), 1);
+        EXPECT_EQ(mctrl.msgno, i + 1);
+        ASSERT_EQ(views[0].len, 1316);
+        EXPECT_EQ(views[0].data[0], char(i));
+        EXPECT_EQ(views[0].data[1315], char(i));
+        EXPECT_EQ(srt_recvmsg_zc_release(accepted, views, 1), 1);
+    }
+
+    // Views can't be released twice.
+    EXPECT_EQ(srt_recvmsg_zc_release(accepted, views, 1), 0);
+}